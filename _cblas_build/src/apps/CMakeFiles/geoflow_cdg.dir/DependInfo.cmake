@@ -0,0 +1,21 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/apps/geoflow_cdg.cpp" "src/apps/CMakeFiles/geoflow_cdg.dir/geoflow_cdg.cpp.o" "gcc" "src/apps/CMakeFiles/geoflow_cdg.dir/geoflow_cdg.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_cblas_build/src/cdg/CMakeFiles/cdg.dir/DependInfo.cmake"
+  "/root/repo/_cblas_build/src/tbox/CMakeFiles/tbox.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
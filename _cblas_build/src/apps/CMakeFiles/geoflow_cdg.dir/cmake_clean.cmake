@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/geoflow_cdg.dir/geoflow_cdg.cpp.o"
+  "CMakeFiles/geoflow_cdg.dir/geoflow_cdg.cpp.o.d"
+  "geoflow_cdg"
+  "geoflow_cdg.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/geoflow_cdg.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
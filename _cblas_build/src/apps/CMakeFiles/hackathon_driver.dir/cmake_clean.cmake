@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/hackathon_driver.dir/hackathon_driver.cpp.o"
+  "CMakeFiles/hackathon_driver.dir/hackathon_driver.cpp.o.d"
+  "hackathon_driver"
+  "hackathon_driver.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hackathon_driver.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,112 @@
+# Install script for directory: /root/repo/src/apps
+
+# Set the install prefix
+if(NOT DEFINED CMAKE_INSTALL_PREFIX)
+  set(CMAKE_INSTALL_PREFIX "/usr/local")
+endif()
+string(REGEX REPLACE "/$" "" CMAKE_INSTALL_PREFIX "${CMAKE_INSTALL_PREFIX}")
+
+# Set the install configuration name.
+if(NOT DEFINED CMAKE_INSTALL_CONFIG_NAME)
+  if(BUILD_TYPE)
+    string(REGEX REPLACE "^[^A-Za-z0-9_]+" ""
+           CMAKE_INSTALL_CONFIG_NAME "${BUILD_TYPE}")
+  else()
+    set(CMAKE_INSTALL_CONFIG_NAME "Release")
+  endif()
+  message(STATUS "Install configuration: \"${CMAKE_INSTALL_CONFIG_NAME}\"")
+endif()
+
+# Set the component getting installed.
+if(NOT CMAKE_INSTALL_COMPONENT)
+  if(COMPONENT)
+    message(STATUS "Install component: \"${COMPONENT}\"")
+    set(CMAKE_INSTALL_COMPONENT "${COMPONENT}")
+  else()
+    set(CMAKE_INSTALL_COMPONENT)
+  endif()
+endif()
+
+# Install shared libraries without execute permission?
+if(NOT DEFINED CMAKE_INSTALL_SO_NO_EXE)
+  set(CMAKE_INSTALL_SO_NO_EXE "1")
+endif()
+
+# Is this installation the result of a crosscompile?
+if(NOT DEFINED CMAKE_CROSSCOMPILING)
+  set(CMAKE_CROSSCOMPILING "FALSE")
+endif()
+
+# Set default install directory permissions.
+if(NOT DEFINED CMAKE_OBJDUMP)
+  set(CMAKE_OBJDUMP "/usr/bin/objdump")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  list(APPEND CMAKE_ABSOLUTE_DESTINATION_FILES
+   "/root/repo/_cblas_build/bin/")
+  if(CMAKE_WARN_ON_ABSOLUTE_INSTALL_DESTINATION)
+    message(WARNING "ABSOLUTE path INSTALL DESTINATION : ${CMAKE_ABSOLUTE_DESTINATION_FILES}")
+  endif()
+  if(CMAKE_ERROR_ON_ABSOLUTE_INSTALL_DESTINATION)
+    message(FATAL_ERROR "ABSOLUTE path INSTALL DESTINATION forbidden (by caller): ${CMAKE_ABSOLUTE_DESTINATION_FILES}")
+  endif()
+  file(INSTALL DESTINATION "/root/repo/_cblas_build/bin" TYPE DIRECTORY FILES "/root/repo/src/apps/" FILES_MATCHING REGEX "/[^/]*\\.jsn$")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  if(EXISTS "$ENV{DESTDIR}/root/repo/_cblas_build/bin/hackathon_driver" AND
+     NOT IS_SYMLINK "$ENV{DESTDIR}/root/repo/_cblas_build/bin/hackathon_driver")
+    file(RPATH_CHECK
+         FILE "$ENV{DESTDIR}/root/repo/_cblas_build/bin/hackathon_driver"
+         RPATH "")
+  endif()
+  list(APPEND CMAKE_ABSOLUTE_DESTINATION_FILES
+   "/root/repo/_cblas_build/bin/hackathon_driver")
+  if(CMAKE_WARN_ON_ABSOLUTE_INSTALL_DESTINATION)
+    message(WARNING "ABSOLUTE path INSTALL DESTINATION : ${CMAKE_ABSOLUTE_DESTINATION_FILES}")
+  endif()
+  if(CMAKE_ERROR_ON_ABSOLUTE_INSTALL_DESTINATION)
+    message(FATAL_ERROR "ABSOLUTE path INSTALL DESTINATION forbidden (by caller): ${CMAKE_ABSOLUTE_DESTINATION_FILES}")
+  endif()
+  file(INSTALL DESTINATION "/root/repo/_cblas_build/bin" TYPE EXECUTABLE FILES "/root/repo/_cblas_build/src/apps/hackathon_driver")
+  if(EXISTS "$ENV{DESTDIR}/root/repo/_cblas_build/bin/hackathon_driver" AND
+     NOT IS_SYMLINK "$ENV{DESTDIR}/root/repo/_cblas_build/bin/hackathon_driver")
+    file(RPATH_CHANGE
+         FILE "$ENV{DESTDIR}/root/repo/_cblas_build/bin/hackathon_driver"
+         OLD_RPATH "/usr/lib/x86_64-linux-gnu/openmpi/lib:"
+         NEW_RPATH "")
+    if(CMAKE_INSTALL_DO_STRIP)
+      execute_process(COMMAND "/usr/bin/strip" "$ENV{DESTDIR}/root/repo/_cblas_build/bin/hackathon_driver")
+    endif()
+  endif()
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  if(EXISTS "$ENV{DESTDIR}/root/repo/_cblas_build/bin/geoflow_cdg" AND
+     NOT IS_SYMLINK "$ENV{DESTDIR}/root/repo/_cblas_build/bin/geoflow_cdg")
+    file(RPATH_CHECK
+         FILE "$ENV{DESTDIR}/root/repo/_cblas_build/bin/geoflow_cdg"
+         RPATH "")
+  endif()
+  list(APPEND CMAKE_ABSOLUTE_DESTINATION_FILES
+   "/root/repo/_cblas_build/bin/geoflow_cdg")
+  if(CMAKE_WARN_ON_ABSOLUTE_INSTALL_DESTINATION)
+    message(WARNING "ABSOLUTE path INSTALL DESTINATION : ${CMAKE_ABSOLUTE_DESTINATION_FILES}")
+  endif()
+  if(CMAKE_ERROR_ON_ABSOLUTE_INSTALL_DESTINATION)
+    message(FATAL_ERROR "ABSOLUTE path INSTALL DESTINATION forbidden (by caller): ${CMAKE_ABSOLUTE_DESTINATION_FILES}")
+  endif()
+  file(INSTALL DESTINATION "/root/repo/_cblas_build/bin" TYPE EXECUTABLE FILES "/root/repo/_cblas_build/src/apps/geoflow_cdg")
+  if(EXISTS "$ENV{DESTDIR}/root/repo/_cblas_build/bin/geoflow_cdg" AND
+     NOT IS_SYMLINK "$ENV{DESTDIR}/root/repo/_cblas_build/bin/geoflow_cdg")
+    file(RPATH_CHANGE
+         FILE "$ENV{DESTDIR}/root/repo/_cblas_build/bin/geoflow_cdg"
+         OLD_RPATH "/usr/lib/x86_64-linux-gnu/openmpi/lib:"
+         NEW_RPATH "")
+    if(CMAKE_INSTALL_DO_STRIP)
+      execute_process(COMMAND "/usr/bin/strip" "$ENV{DESTDIR}/root/repo/_cblas_build/bin/geoflow_cdg")
+    endif()
+  endif()
+endif()
+
@@ -0,0 +1,65 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  "Fortran"
+  )
+# The set of files for implicit dependencies of each language:
+set(CMAKE_DEPENDS_CHECK_Fortran
+  "/root/repo/src/cdg/blas/cff_blas.F" "/root/repo/_cblas_build/src/cdg/CMakeFiles/cdg.dir/blas/cff_blas.F.o"
+  "/root/repo/src/cdg/blas/dmxmp.F" "/root/repo/_cblas_build/src/cdg/CMakeFiles/cdg.dir/blas/dmxmp.F.o"
+  "/root/repo/src/cdg/blas/fmxmp.F" "/root/repo/_cblas_build/src/cdg/CMakeFiles/cdg.dir/blas/fmxmp.F.o"
+  "/root/repo/src/cdg/blas/qmxmp.F" "/root/repo/_cblas_build/src/cdg/CMakeFiles/cdg.dir/blas/qmxmp.F.o"
+  )
+set(CMAKE_Fortran_COMPILER_ID "GNU")
+set(CMAKE_Fortran_SUBMODULE_SEP "@")
+set(CMAKE_Fortran_SUBMODULE_EXT ".smod")
+
+# Preprocessor definitions for this target.
+set(CMAKE_TARGET_DEFINITIONS_Fortran
+  "BOOST_ALL_NO_LIB"
+  "CBLAS_HAS_CGEMM3M"
+  "CBLAS_HAS_ZGEMM3M"
+  )
+
+# The include file search paths:
+set(CMAKE_Fortran_TARGET_INCLUDE_PATH
+  "/root/repo/src/cdg/include"
+  "/root/repo/src/cdg/blas"
+  "/root/repo/src/cdg/comm"
+  "/root/repo/src/cdg/grid"
+  "/root/repo/src/cdg/config"
+  "/root/repo/src/cdg/io"
+  "/root/repo/src/cdg/pdes"
+  "/root/repo/src/cdg/sem"
+  "/root/repo/src/cdg/solvers"
+  "/root/repo/src/cdg/user/bdy"
+  "/root/repo/src/cdg/user/force"
+  "/root/repo/src/cdg/user/state"
+  "/root/repo/src/cdg/user/terrain"
+  "/root/repo/src/cdg/utils"
+  "/root/repo/src"
+  "src"
+  "/usr/include"
+  "/usr/lib/x86_64-linux-gnu/openmpi/include"
+  "/usr/lib/x86_64-linux-gnu/openmpi/include/openmpi"
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/cdg/blas/gcblas.cpp" "src/cdg/CMakeFiles/cdg.dir/blas/gcblas.cpp.o" "gcc" "src/cdg/CMakeFiles/cdg.dir/blas/gcblas.cpp.o.d"
+  "/root/repo/src/cdg/comm/gcomm.cpp" "src/cdg/CMakeFiles/cdg.dir/comm/gcomm.cpp.o" "gcc" "src/cdg/CMakeFiles/cdg.dir/comm/gcomm.cpp.o.d"
+  "/root/repo/src/cdg/sem/gelem_base.cpp" "src/cdg/CMakeFiles/cdg.dir/sem/gelem_base.cpp.o" "gcc" "src/cdg/CMakeFiles/cdg.dir/sem/gelem_base.cpp.o.d"
+  "/root/repo/src/cdg/utils/gbitblock.cpp" "src/cdg/CMakeFiles/cdg.dir/utils/gbitblock.cpp.o" "gcc" "src/cdg/CMakeFiles/cdg.dir/utils/gbitblock.cpp.o.d"
+  "/root/repo/src/cdg/utils/gutils.cpp" "src/cdg/CMakeFiles/cdg.dir/utils/gutils.cpp.o" "gcc" "src/cdg/CMakeFiles/cdg.dir/utils/gutils.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_cblas_build/src/tbox/CMakeFiles/tbox.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
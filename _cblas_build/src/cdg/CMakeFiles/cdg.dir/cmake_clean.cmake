@@ -0,0 +1,23 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/cdg.dir/blas/cff_blas.F.o"
+  "CMakeFiles/cdg.dir/blas/dmxmp.F.o"
+  "CMakeFiles/cdg.dir/blas/fmxmp.F.o"
+  "CMakeFiles/cdg.dir/blas/gcblas.cpp.o"
+  "CMakeFiles/cdg.dir/blas/gcblas.cpp.o.d"
+  "CMakeFiles/cdg.dir/blas/qmxmp.F.o"
+  "CMakeFiles/cdg.dir/comm/gcomm.cpp.o"
+  "CMakeFiles/cdg.dir/comm/gcomm.cpp.o.d"
+  "CMakeFiles/cdg.dir/sem/gelem_base.cpp.o"
+  "CMakeFiles/cdg.dir/sem/gelem_base.cpp.o.d"
+  "CMakeFiles/cdg.dir/utils/gbitblock.cpp.o"
+  "CMakeFiles/cdg.dir/utils/gbitblock.cpp.o.d"
+  "CMakeFiles/cdg.dir/utils/gutils.cpp.o"
+  "CMakeFiles/cdg.dir/utils/gutils.cpp.o.d"
+  "libcdg.a"
+  "libcdg.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX Fortran)
+  include(CMakeFiles/cdg.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,95 @@
+/*
+ * configure.hpp
+ *
+ *  Created on: Oct 23, 2018
+ *      Author: bflynt
+ */
+#ifndef GEOFLOW_CONFIG_HPP_IN_
+#define GEOFLOW_CONFIG_HPP_IN_
+
+//
+// To be filled in by CMake
+//
+#define GDIM 2
+#define GEOFLOW_USE_MPI
+/* #undef GEOFLOW_USE_OPENMP */
+/* #undef GEOFLOW_USE_CUDA */
+#define GEOFLOW_USE_CBLAS
+/* #undef GEOFLOW_USE_CUBLAS */
+/* #undef GEOFLOW_USE_OPENACC */
+/* #undef GEOFLOW_TRACER_USE_NVTX */
+/* #undef GEOFLOW_TRACER_USE_PIO */
+/* #undef GEOFLOW_TRACER_USE_GPTL */
+#define GEOFLOW_USE_NEUMANN_HACK
+
+#define GEOFLOW_ASSERT_HANG
+#define GEOFLOW_ASSERT_CORE
+#define GEOFLOW_ASSERT_STACK
+
+#if defined(GEOFLOW_USE_CBLAS) && defined(GEOFLOW_USE_CUBLAS)
+#warning "Both CBLAS and cuBLAS Selected (Defaulted to CBLAS)"
+#undef GEOFLOW_USE_CUBLAS
+#endif
+
+//
+// GIT Configure/Compilation Records
+//
+#define GIT_LONG_HASH "7a969c1e52cf2c2af607ce83f20cd6b854533aa2"
+#define GIT_SHORT_HASH "7a969c1"
+#define GIT_COMMIT_TIME "2026-10-17 05:52:51 +0000"
+#define CONFIGURE_TIME "2026-10-17 05:52:56 +0000"
+#define COMPILE_DATE __DATE__
+#define COMPILE_TIME __TIME__
+#define PROJECT_VERSION "0.0.0.1"
+
+//====================================================
+//                    Debug Flags
+//====================================================
+
+// If the standard library flag is set then turn ON 
+#if !defined(NDEBUG)
+#define GEOFLOW_USE_STATIC_ASSERTIONS  // Turn on static assertions.
+#define GEOFLOW_USE_RUNTIME_ASSERTIONS // Turn on runtime assertions.
+#endif
+
+/** Insure empty loops are not optimized away
+ */
+#define GEOFLOW_INSURE_LOOP
+
+/** Insure unused variables do not report as errors
+ */
+#define GEOFLOW_INSURE_USE
+
+//====================================================
+//                    Clock Settings
+//====================================================
+
+// Clock mechanism
+//#define USE_POSIX_TIME
+//#define USE_BOOST_TIME
+//#define USE_C11_TIME
+#define USE_C_TIME
+
+//====================================================
+//           Voodoo set using other Flags
+//====================================================
+
+/** Turn on Tracer if its needed by another tool
+ */
+#if defined(GEOFLOW_TRACER_USE_NVTX) || defined(GEOFLOW_TRACER_USE_PIO) || defined(GEOFLOW_TRACER_USE_GPTL)
+#define GEOFLOW_USE_TRACER
+#endif
+
+// Constants to compare against
+#define CPP_INT_TWO 2
+#define CPP_INT_THREE 3
+
+#if GDIM == CPP_INT_TWO
+	#define _G_IS2D
+#elif GDIM == CPP_INT_THREE
+	#define _G_IS3D
+#else
+	#error Unrecognized GDIM Value
+#endif
+
+#endif /* GEOFLOW_CONFIG_HPP_IN_ */
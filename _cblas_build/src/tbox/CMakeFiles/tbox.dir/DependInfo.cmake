@@ -0,0 +1,29 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/tbox/clock.cpp" "src/tbox/CMakeFiles/tbox.dir/clock.cpp.o" "gcc" "src/tbox/CMakeFiles/tbox.dir/clock.cpp.o.d"
+  "/root/repo/src/tbox/command_line.cpp" "src/tbox/CMakeFiles/tbox.dir/command_line.cpp.o" "gcc" "src/tbox/CMakeFiles/tbox.dir/command_line.cpp.o.d"
+  "/root/repo/src/tbox/display_header.cpp" "src/tbox/CMakeFiles/tbox.dir/display_header.cpp.o" "gcc" "src/tbox/CMakeFiles/tbox.dir/display_header.cpp.o.d"
+  "/root/repo/src/tbox/error_handler.cpp" "src/tbox/CMakeFiles/tbox.dir/error_handler.cpp.o" "gcc" "src/tbox/CMakeFiles/tbox.dir/error_handler.cpp.o.d"
+  "/root/repo/src/tbox/global_manager.cpp" "src/tbox/CMakeFiles/tbox.dir/global_manager.cpp.o" "gcc" "src/tbox/CMakeFiles/tbox.dir/global_manager.cpp.o.d"
+  "/root/repo/src/tbox/input_manager.cpp" "src/tbox/CMakeFiles/tbox.dir/input_manager.cpp.o" "gcc" "src/tbox/CMakeFiles/tbox.dir/input_manager.cpp.o.d"
+  "/root/repo/src/tbox/io_buffer.cpp" "src/tbox/CMakeFiles/tbox.dir/io_buffer.cpp.o" "gcc" "src/tbox/CMakeFiles/tbox.dir/io_buffer.cpp.o.d"
+  "/root/repo/src/tbox/mpixx.cpp" "src/tbox/CMakeFiles/tbox.dir/mpixx.cpp.o" "gcc" "src/tbox/CMakeFiles/tbox.dir/mpixx.cpp.o.d"
+  "/root/repo/src/tbox/pio.cpp" "src/tbox/CMakeFiles/tbox.dir/pio.cpp.o" "gcc" "src/tbox/CMakeFiles/tbox.dir/pio.cpp.o.d"
+  "/root/repo/src/tbox/property_tree.cpp" "src/tbox/CMakeFiles/tbox.dir/property_tree.cpp.o" "gcc" "src/tbox/CMakeFiles/tbox.dir/property_tree.cpp.o.d"
+  "/root/repo/src/tbox/tracer.cpp" "src/tbox/CMakeFiles/tbox.dir/tracer.cpp.o" "gcc" "src/tbox/CMakeFiles/tbox.dir/tracer.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
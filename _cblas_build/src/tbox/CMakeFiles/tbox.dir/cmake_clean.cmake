@@ -0,0 +1,31 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tbox.dir/clock.cpp.o"
+  "CMakeFiles/tbox.dir/clock.cpp.o.d"
+  "CMakeFiles/tbox.dir/command_line.cpp.o"
+  "CMakeFiles/tbox.dir/command_line.cpp.o.d"
+  "CMakeFiles/tbox.dir/display_header.cpp.o"
+  "CMakeFiles/tbox.dir/display_header.cpp.o.d"
+  "CMakeFiles/tbox.dir/error_handler.cpp.o"
+  "CMakeFiles/tbox.dir/error_handler.cpp.o.d"
+  "CMakeFiles/tbox.dir/global_manager.cpp.o"
+  "CMakeFiles/tbox.dir/global_manager.cpp.o.d"
+  "CMakeFiles/tbox.dir/input_manager.cpp.o"
+  "CMakeFiles/tbox.dir/input_manager.cpp.o.d"
+  "CMakeFiles/tbox.dir/io_buffer.cpp.o"
+  "CMakeFiles/tbox.dir/io_buffer.cpp.o.d"
+  "CMakeFiles/tbox.dir/mpixx.cpp.o"
+  "CMakeFiles/tbox.dir/mpixx.cpp.o.d"
+  "CMakeFiles/tbox.dir/pio.cpp.o"
+  "CMakeFiles/tbox.dir/pio.cpp.o.d"
+  "CMakeFiles/tbox.dir/property_tree.cpp.o"
+  "CMakeFiles/tbox.dir/property_tree.cpp.o.d"
+  "CMakeFiles/tbox.dir/tracer.cpp.o"
+  "CMakeFiles/tbox.dir/tracer.cpp.o.d"
+  "libtbox.a"
+  "libtbox.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/tbox.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
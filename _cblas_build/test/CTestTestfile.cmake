@@ -0,0 +1,11 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/test
+# Build directory: /root/repo/_cblas_build/test
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("sandbox/cdg/data")
+subdirs("sandbox/cdg/src")
+subdirs("sandbox/tbox")
+subdirs("actions/cdg")
+subdirs("actions/tbox")
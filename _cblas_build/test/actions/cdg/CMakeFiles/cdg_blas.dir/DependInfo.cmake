@@ -0,0 +1,21 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/test/actions/cdg/cdg_blas.cpp" "test/actions/cdg/CMakeFiles/cdg_blas.dir/cdg_blas.cpp.o" "gcc" "test/actions/cdg/CMakeFiles/cdg_blas.dir/cdg_blas.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_cblas_build/src/cdg/CMakeFiles/cdg.dir/DependInfo.cmake"
+  "/root/repo/_cblas_build/src/tbox/CMakeFiles/tbox.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
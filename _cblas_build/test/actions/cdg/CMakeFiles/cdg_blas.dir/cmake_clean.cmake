@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/cdg_blas.dir/cdg_blas.cpp.o"
+  "CMakeFiles/cdg_blas.dir/cdg_blas.cpp.o.d"
+  "cdg_blas"
+  "cdg_blas.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/cdg_blas.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/cdg_cg.dir/cdg_cg.cpp.o"
+  "CMakeFiles/cdg_cg.dir/cdg_cg.cpp.o.d"
+  "cdg_cg"
+  "cdg_cg.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/cdg_cg.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
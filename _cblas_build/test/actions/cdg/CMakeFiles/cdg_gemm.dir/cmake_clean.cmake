@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/cdg_gemm.dir/cdg_gemm.cpp.o"
+  "CMakeFiles/cdg_gemm.dir/cdg_gemm.cpp.o.d"
+  "cdg_gemm"
+  "cdg_gemm.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/cdg_gemm.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/cdg_ggfx.dir/cdg_ggfx.cpp.o"
+  "CMakeFiles/cdg_ggfx.dir/cdg_ggfx.cpp.o.d"
+  "cdg_ggfx"
+  "cdg_ggfx.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/cdg_ggfx.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
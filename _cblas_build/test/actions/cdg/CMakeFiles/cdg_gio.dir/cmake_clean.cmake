@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/cdg_gio.dir/cdg_gio.cpp.o"
+  "CMakeFiles/cdg_gio.dir/cdg_gio.cpp.o.d"
+  "cdg_gio"
+  "cdg_gio.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/cdg_gio.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
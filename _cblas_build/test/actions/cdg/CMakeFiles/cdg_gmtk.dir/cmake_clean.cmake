@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/cdg_gmtk.dir/cdg_gmtk.cpp.o"
+  "CMakeFiles/cdg_gmtk.dir/cdg_gmtk.cpp.o.d"
+  "cdg_gmtk"
+  "cdg_gmtk.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/cdg_gmtk.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/cdg_mass.dir/cdg_mass.cpp.o"
+  "CMakeFiles/cdg_mass.dir/cdg_mass.cpp.o.d"
+  "cdg_mass"
+  "cdg_mass.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/cdg_mass.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
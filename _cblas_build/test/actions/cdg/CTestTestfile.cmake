@@ -0,0 +1,20 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/test/actions/cdg
+# Build directory: /root/repo/_cblas_build/test/actions/cdg
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(cdg_blas "mpirun" "-np" "4" "--oversubscribe" "/root/repo/_cblas_build/test/actions/cdg/cdg_blas")
+set_tests_properties(cdg_blas PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/actions/cdg/CMakeLists.txt;77;add_test;/root/repo/test/actions/cdg/CMakeLists.txt;0;")
+add_test(cdg_cg "mpirun" "-np" "4" "--oversubscribe" "/root/repo/_cblas_build/test/actions/cdg/cdg_cg")
+set_tests_properties(cdg_cg PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/actions/cdg/CMakeLists.txt;77;add_test;/root/repo/test/actions/cdg/CMakeLists.txt;0;")
+add_test(cdg_ggfx "mpirun" "-np" "4" "--oversubscribe" "/root/repo/_cblas_build/test/actions/cdg/cdg_ggfx")
+set_tests_properties(cdg_ggfx PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/actions/cdg/CMakeLists.txt;77;add_test;/root/repo/test/actions/cdg/CMakeLists.txt;0;")
+add_test(cdg_gio "mpirun" "-np" "4" "--oversubscribe" "/root/repo/_cblas_build/test/actions/cdg/cdg_gio")
+set_tests_properties(cdg_gio PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/actions/cdg/CMakeLists.txt;77;add_test;/root/repo/test/actions/cdg/CMakeLists.txt;0;")
+add_test(cdg_gmtk "mpirun" "-np" "4" "--oversubscribe" "/root/repo/_cblas_build/test/actions/cdg/cdg_gmtk")
+set_tests_properties(cdg_gmtk PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/actions/cdg/CMakeLists.txt;77;add_test;/root/repo/test/actions/cdg/CMakeLists.txt;0;")
+add_test(cdg_mass "mpirun" "-np" "4" "--oversubscribe" "/root/repo/_cblas_build/test/actions/cdg/cdg_mass")
+set_tests_properties(cdg_mass PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/actions/cdg/CMakeLists.txt;77;add_test;/root/repo/test/actions/cdg/CMakeLists.txt;0;")
+add_test(cdg_gemm "mpirun" "-np" "4" "--oversubscribe" "/root/repo/_cblas_build/test/actions/cdg/cdg_gemm")
+set_tests_properties(cdg_gemm PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/actions/cdg/CMakeLists.txt;77;add_test;/root/repo/test/actions/cdg/CMakeLists.txt;0;")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/enumerate.dir/enumerate.cpp.o"
+  "CMakeFiles/enumerate.dir/enumerate.cpp.o.d"
+  "enumerate"
+  "enumerate.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/enumerate.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/indices.dir/indices.cpp.o"
+  "CMakeFiles/indices.dir/indices.cpp.o.d"
+  "indices"
+  "indices.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/indices.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/input_manager.dir/input_manager.cpp.o"
+  "CMakeFiles/input_manager.dir/input_manager.cpp.o.d"
+  "input_manager"
+  "input_manager.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/input_manager.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/morton.dir/morton.cpp.o"
+  "CMakeFiles/morton.dir/morton.cpp.o.d"
+  "morton"
+  "morton.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/morton.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
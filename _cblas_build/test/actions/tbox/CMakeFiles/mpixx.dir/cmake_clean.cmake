@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/mpixx.dir/mpixx.cpp.o"
+  "CMakeFiles/mpixx.dir/mpixx.cpp.o.d"
+  "mpixx"
+  "mpixx.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/mpixx.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
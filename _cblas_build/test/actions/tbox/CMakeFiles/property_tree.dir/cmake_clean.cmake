@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/property_tree.dir/property_tree.cpp.o"
+  "CMakeFiles/property_tree.dir/property_tree.cpp.o.d"
+  "property_tree"
+  "property_tree.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/property_tree.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
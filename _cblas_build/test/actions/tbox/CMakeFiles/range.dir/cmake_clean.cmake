@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/range.dir/range.cpp.o"
+  "CMakeFiles/range.dir/range.cpp.o.d"
+  "range"
+  "range.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/range.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
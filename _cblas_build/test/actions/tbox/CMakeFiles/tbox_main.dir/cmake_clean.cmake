@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tbox_main.dir/tbox_main.cpp.o"
+  "CMakeFiles/tbox_main.dir/tbox_main.cpp.o.d"
+  "tbox_main"
+  "tbox_main.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/tbox_main.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/zip.dir/zip.cpp.o"
+  "CMakeFiles/zip.dir/zip.cpp.o.d"
+  "zip"
+  "zip.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/zip.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,24 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/test/actions/tbox
+# Build directory: /root/repo/_cblas_build/test/actions/tbox
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(enumerate "mpirun" "-np" "4" "--oversubscribe" "/root/repo/_cblas_build/test/actions/tbox/enumerate")
+set_tests_properties(enumerate PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/actions/tbox/CMakeLists.txt;67;add_test;/root/repo/test/actions/tbox/CMakeLists.txt;0;")
+add_test(indices "mpirun" "-np" "4" "--oversubscribe" "/root/repo/_cblas_build/test/actions/tbox/indices")
+set_tests_properties(indices PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/actions/tbox/CMakeLists.txt;67;add_test;/root/repo/test/actions/tbox/CMakeLists.txt;0;")
+add_test(input_manager "mpirun" "-np" "4" "--oversubscribe" "/root/repo/_cblas_build/test/actions/tbox/input_manager")
+set_tests_properties(input_manager PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/actions/tbox/CMakeLists.txt;67;add_test;/root/repo/test/actions/tbox/CMakeLists.txt;0;")
+add_test(morton "mpirun" "-np" "4" "--oversubscribe" "/root/repo/_cblas_build/test/actions/tbox/morton")
+set_tests_properties(morton PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/actions/tbox/CMakeLists.txt;67;add_test;/root/repo/test/actions/tbox/CMakeLists.txt;0;")
+add_test(mpixx "mpirun" "-np" "4" "--oversubscribe" "/root/repo/_cblas_build/test/actions/tbox/mpixx")
+set_tests_properties(mpixx PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/actions/tbox/CMakeLists.txt;67;add_test;/root/repo/test/actions/tbox/CMakeLists.txt;0;")
+add_test(property_tree "mpirun" "-np" "4" "--oversubscribe" "/root/repo/_cblas_build/test/actions/tbox/property_tree")
+set_tests_properties(property_tree PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/actions/tbox/CMakeLists.txt;67;add_test;/root/repo/test/actions/tbox/CMakeLists.txt;0;")
+add_test(range "mpirun" "-np" "4" "--oversubscribe" "/root/repo/_cblas_build/test/actions/tbox/range")
+set_tests_properties(range PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/actions/tbox/CMakeLists.txt;67;add_test;/root/repo/test/actions/tbox/CMakeLists.txt;0;")
+add_test(tbox_main "mpirun" "-np" "4" "--oversubscribe" "/root/repo/_cblas_build/test/actions/tbox/tbox_main")
+set_tests_properties(tbox_main PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/actions/tbox/CMakeLists.txt;67;add_test;/root/repo/test/actions/tbox/CMakeLists.txt;0;")
+add_test(zip "mpirun" "-np" "4" "--oversubscribe" "/root/repo/_cblas_build/test/actions/tbox/zip")
+set_tests_properties(zip PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/actions/tbox/CMakeLists.txt;67;add_test;/root/repo/test/actions/tbox/CMakeLists.txt;0;")
@@ -30,9 +30,11 @@ int main(int argc, char **argv) {
     GINT iopt;
     GSIZET itindex = 0;            // restart flag/index
     GSIZET icycle = 0;             // curr time cycle
+    GBOOL bbalance;                // do dynamic load balancing?
     std::vector<GINT> pstd(GDIM);  // order in each direction
     GTMatrix<GINT> p;              // needed for restart, but is dummy
     ObsTraitsType binobstraits;
+    LoadBalance::Traits lbtraits;
     CommandLine cline_;
 
     typename MyTypes::Time t = 0;
@@ -70,6 +72,8 @@ int main(int argc, char **argv) {
     pio::pout << "geoflow: build grid..." << std::endl;
     ObserverFactory<MyTypes>::get_traits(ptree_, "gio_observer", binobstraits);
     comm_ = world;
+    bbalance = init_balance(ptree_, lbtraits);
+    LoadBalance lb(lbtraits, comm_);
     grid_ = GGridFactory<MyTypes>::build(ptree_, gbasis_, pIO_, binobstraits, comm_);
     pio::pout << "geoflow: grid built." << std::endl;
 
@@ -150,7 +154,11 @@ int main(int argc, char **argv) {
     GComm::Synch();
     pio::pout << "geoflow: do time stepping..." << std::endl;
 
-    pIntegrator_->time_integrate(t, uf_, u_);
+    if (bbalance) {
+        balanced_integrate(ptree_, lb, binobstraits, t);
+    } else {
+        pIntegrator_->time_integrate(t, uf_, u_);
+    }
 
     pio::pout << "geoflow: time stepping done." << std::endl;
 
@@ -159,6 +167,10 @@ int main(int argc, char **argv) {
     //***************************************************
     compare(ptree_, *grid_, pEqn_, t, utmp_, u_);
 
+    // Complete any outstanding (async) output:
+    if (pIO_ != NULLPTR) pIO_->flush();
+    GDiagAggregator<Ftype>::instance().flush();
+
     //***************************************************
     // Do shutdown, cleaning:
     //***************************************************
@@ -772,3 +784,166 @@ void init_ggfx(PropertyTree &ptree, Grid &grid, GGFX<Ftype> *&ggfx) {
     ggfx->init(maxdups, static_cast<Ftype>(0.001)*grid.minnodedist(), xyz);
 
 }  // end method init_ggfx
+
+//**********************************************************************************
+//**********************************************************************************
+// METHOD: init_balance
+// DESC  : Configure dynamic load balancing from optional "load_balance"
+//         block of main prop tree. Rebalancing requires cycle-based
+//         integration, and a grid that is not read from restart data
+//         with variable p. If active, and grid uses the "default"
+//         partitioner, an SFC partitioner is selected, since that
+//         is the one whose weights can be adjusted.
+// ARGS  : ptree   : main prop tree; may be modified
+//         lbtraits: load balancer traits, returned
+// RETURNS: TRUE if load balancing is active; else FALSE
+//**********************************************************************************
+GBOOL init_balance(PropertyTree &ptree, LoadBalance::Traits &lbtraits) {
+    GEOFLOW_TRACE();
+    GBOOL bactive;
+    GString gname, itype, ptype, spart;
+    PropertyTree lbptree, gridptree, intptree;
+
+    if (!ptree.isPropertyTree("load_balance")) return FALSE;
+
+    lbptree = ptree.getPropertyTree("load_balance");
+    bactive = lbptree.getValue<GBOOL>("active", FALSE);
+    lbtraits.cycle_interval = lbptree.getValue<GSIZET>("cycle_interval", lbtraits.cycle_interval);
+    lbtraits.threshold = lbptree.getValue<Ftype>("threshold", lbtraits.threshold);
+    if (!bactive) return FALSE;
+
+    intptree = ptree.getPropertyTree("time_integration");
+    itype = intptree.getValue<GString>("integ_type", "cycle");
+    ptype = ptree.getValue<GString>("exp_order_type", "constant");
+    if ("cycle" != itype || "constant" != ptype) {
+        pio::pout << "geoflow: load balancing requires cycle integration and constant p; disabled" << std::endl;
+        return FALSE;
+    }
+    assert(lbtraits.cycle_interval > 0 && lbtraits.threshold >= 1.0);
+
+    gname = ptree.getValue<GString>("grid_type");
+    gridptree = ptree.getPropertyTree(gname);
+    spart = gridptree.getValue<GString>("partitioner", "default");
+    if ("default" == spart) {
+        ptree.setValue<GString>(gname + ".partitioner", "sfc_hilbert");
+    }
+
+    return TRUE;
+
+}  // end of method init_balance
+
+//**********************************************************************************
+//**********************************************************************************
+// METHOD: balanced_integrate
+// DESC  : Do time integration in segments of lb.cycle_interval cycles,
+//         measuring the cost of each task in each segment, and 
+//         rebalancing the grid between segments if the measured
+//         imbalance exceeds threshold.
+// ARGS  : ptree    : main prop tree
+//         lb       : load balancer
+//         obstraits: observer traits used to build grid
+//         t        : initial time; final time on return
+//**********************************************************************************
+void balanced_integrate(PropertyTree &ptree, LoadBalance &lb, ObsTraitsType &obstraits, Time &t) {
+    GEOFLOW_TRACE();
+    GSIZET cycle_end = pIntegrator_->get_traits().cycle_end;
+    Time dt = pIntegrator_->get_traits().dt;
+
+    while (pIntegrator_->get_traits().cycle < cycle_end) {
+        typename IntegratorBase::Traits &itraits = pIntegrator_->get_traits();
+        itraits.cycle_end = MIN(itraits.cycle + lb.get_traits().cycle_interval, cycle_end);
+        itraits.observe_end = itraits.cycle_end == cycle_end;
+
+        lb.start(ggfx_);
+        pIntegrator_->time_integrate(t, uf_, u_);
+        lb.stop();
+
+        // Next segment continues from current cycle and step size:
+        itraits.cycle = itraits.cycle_end;
+        itraits.dt = pIntegrator_->get_dt_last();
+        if (itraits.cycle < cycle_end && lb.need_rebalance()) {
+            rebalance(ptree, lb, obstraits);
+        }
+    }
+    pIntegrator_->get_traits().cycle_end = cycle_end;
+    pIntegrator_->get_traits().dt = dt;
+
+}  // end of method balanced_integrate
+
+//**********************************************************************************
+//**********************************************************************************
+// METHOD: rebalance
+// DESC  : Replace grid with one partitioned according to measured
+//         costs, and migrate state, forcing, and base state to it.
+//         Objects that depend on the grid partition are rebuilt, or
+//         re-targeted to the new grid.
+// ARGS  : ptree    : main prop tree
+//         lb       : load balancer
+//         obstraits: observer traits used to build grid
+//**********************************************************************************
+void rebalance(PropertyTree &ptree, LoadBalance &lb, ObsTraitsType &obstraits) {
+    GEOFLOW_TRACE();
+    size_t nsteps;
+    Grid *gold = grid_;
+    EqnBasePtr pold = pEqn_;
+    State unew;
+    GMConv<MyTypes> *mcold, *mcnew;
+    typename IntegratorBase::Traits itraits;
+
+    itraits = pIntegrator_->get_traits();
+    nsteps = pIntegrator_->get_numsteps();
+    if (pIO_ != NULLPTR) pIO_->flush();
+
+    grid_ = lb.rebalance(ptree, *gold, gbasis_, pIO_, obstraits);
+
+    // Migrate state and forcing:
+    unew.resize(u_.size());
+    for (auto j = 0; j < u_.size(); j++) unew[j] = new GTVector<Ftype>(grid_->ndof());
+    LoadBalance::migrate(*gold, u_, *grid_, unew);
+    for (auto j = 0; j < u_.size(); j++) {
+        delete u_[j];
+        u_[j] = unew[j];
+    }
+    for (GINT j = 0; j < c_.size(); j++) c_[j] = u_[j + 1];
+
+    unew.resize(uf_.size());
+    for (auto j = 0; j < uf_.size(); j++) {
+        unew[j] = uf_[j] != NULLPTR ? new GTVector<Ftype>(grid_->ndof()) : NULLPTR;
+    }
+    LoadBalance::migrate(*gold, uf_, *grid_, unew);
+    for (auto j = 0; j < uf_.size(); j++) {
+        if (uf_[j] != NULLPTR) delete uf_[j];
+        uf_[j] = unew[j];
+    }
+
+    for (auto j = 0; j < utmp_.size(); j++) utmp_[j]->resize(grid_->ndof());
+
+    // Set up new grid as in main:
+    delete ggfx_;
+    ggfx_ = NULLPTR;
+    init_ggfx(ptree, *grid_, ggfx_);
+    grid_->set_ggfx(*ggfx_);
+    do_terrain(ptree, *grid_);
+
+    // Rebuild equation; its base state, if any, is migrated:
+    create_equation(ptree, pEqn_);
+    pEqn_->init(u_, utmp_);
+    mcold = dynamic_cast<GMConv<MyTypes> *>(pold.get());
+    mcnew = dynamic_cast<GMConv<MyTypes> *>(pEqn_.get());
+    if (mcold != NULLPTR && mcnew != NULLPTR) {
+        LoadBalance::migrate(*gold, mcold->get_base_state(), *grid_, mcnew->get_base_state());
+    }
+    create_mixer(ptree, pMixer_);
+
+    // Re-target IO and observers, and rebuild integrator,
+    // continuing from current cycle:
+    if (pIO_ != NULLPTR) pIO_->set_grid(*grid_);
+    for (auto j = 0; j < pObservers_->size(); j++) (*pObservers_)[j]->set_grid(pEqn_, *grid_);
+    pIntegrator_ = IntegratorFactory<MyTypes>::build(ptree, pEqn_, pMixer_, pObservers_, *grid_);
+    pIntegrator_->get_traits() = itraits;
+    pIntegrator_->get_numsteps() = nsteps;
+
+    pold.reset();
+    delete gold;
+
+}  // end of method rebalance
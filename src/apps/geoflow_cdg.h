@@ -30,12 +30,14 @@
 #include "gburgers.hpp"
 #include "gmconv.hpp"
 #include "gio.hpp"
+#include "gdiag_aggregator.hpp"
 #include "gstateinfo.hpp"
 //#include "ggrid.hpp"
 //#include "ggrid_box.hpp"
 //#include "ggrid_icos.hpp"
 #include "ghelmholtz.hpp"
 #include "ggrid_factory.hpp"
+#include "gload_balance.hpp"
 #include "ginitstate_factory.hpp"
 #include "ginitforce_factory.hpp"
 #include "gupdatebdy_factory.hpp"
@@ -106,6 +108,7 @@ using IntegratorPtr = std::shared_ptr<IntegratorBase>; // Integrator ptr
                                                   // Integrator ptr
 using ObsBase       = ObserverBase<EqnBase>;      // Observer Base type
 using ObsTraitsType = ObserverBase<MyTypes>::Traits;
+using LoadBalance   = GLoadBalance<MyTypes>;      // Load balancer
 using BasisBase     = GTVector<GNBasis<GCTYPE,GFTYPE>*>; 
                                                   // Basis pool type
 
@@ -153,6 +156,9 @@ void init_ggfx        (PropertyTree &ptree, Grid &grid, GGFX<GFTYPE> *&ggfx);
 void gresetart        (PropertyTree &ptree);
 void compare          (const PropertyTree &ptree, Grid &, EqnBasePtr &pEqn, Time &t, State &utmp, State &u);
 void do_restart       (const PropertyTree &ptree, Grid &, State &u, GTMatrix<GINT>&p,  GSIZET &cycle, Time &t);
+GBOOL init_balance    (PropertyTree &ptree, LoadBalance::Traits &lbtraits);
+void balanced_integrate(PropertyTree &ptree, LoadBalance &lb, ObsTraitsType &obstraits, Time &t);
+void rebalance        (PropertyTree &ptree, LoadBalance &lb, ObsTraitsType &obstraits);
 
 //#include "init_pde.h"
 
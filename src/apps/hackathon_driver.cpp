@@ -25,6 +25,7 @@
 #include "tbox/tracer.hpp"
 
 #include <cassert>
+#include <chrono>
 //#include <cstdio>
 #include <cstdlib>
 #include <iostream>
@@ -78,7 +79,7 @@ GINT szMatCache_ = _G_MAT_CACHE_SIZE;
 GINT szVecCache_ = _G_VEC_CACHE_SIZE;
 
 
-#define NMETH 2
+#define NMETH 4
 
 
 int main(int argc, char **argv)
@@ -88,7 +89,7 @@ int main(int argc, char **argv)
     GINT    errcode=0 ;
     GINT    nc=GDIM; // no. coords
     GFTYPE  eps=100.0*std::numeric_limits<GFTYPE>::epsilon();
-    GFTYPE  dnorm, told=0.0, tnew=0.0;
+    GFTYPE  dnorm, told=0.0, tnew=0.0, tspec=0.0, tgrad=0.0;
     GString sgrid;// name of JSON grid object to use
     GTVector<GINT>
             pvec;
@@ -142,15 +143,18 @@ int main(int argc, char **argv)
     // Create state and tmp space:
     State     utmp (3);
     State     da   (nc);
-    State     du   (nc);
-    StateComp diff, dunew, duold, u;
+    State     du   (NMETH);
+    State     dgrad(GDIM);
+    StateComp diff, dunew, duold, duspec, u;
     
     for ( auto j=0; j<utmp .size(); j++ ) utmp [j] = new StateComp(grid_->size());
     for ( auto j=0; j<da   .size(); j++ ) da   [j] = new StateComp(grid_->size());
+    for ( auto j=0; j<dgrad.size(); j++ ) dgrad[j] = new StateComp(grid_->size());
     u    .resize(grid_->size());
     diff .resize(grid_->size());
     dunew.resize(grid_->size());
     duold.resize(grid_->size());
+    duspec.resize(grid_->size());
     du = NULLPTR;
 
     /////////////////////////////////////////////////////////////////
@@ -189,18 +193,43 @@ int main(int argc, char **argv)
 
     // Compute numerical derivs of u in each direction, using
     // different methods:
+    std::chrono::steady_clock::time_point tstart;
+    std::chrono::duration<double>         tdiff;
+
     grid_->set_derivtype(GGrid<Types>::GDV_VARP); // variable order
     GEOFLOW_TRACE_START("old_deriv");
+    tstart = std::chrono::steady_clock::now();
     for ( auto n=0; n<ncyc; n++ ) {
        grid_->deriv(u, idir, *utmp[0], duold);
     }
+    tdiff = std::chrono::steady_clock::now() - tstart; told = tdiff.count();
     GEOFLOW_TRACE_STOP();
 
     grid_->set_derivtype(GGrid<Types>::GDV_CONSTP); // const order
     GEOFLOW_TRACE_START("new_deriv");
+    tstart = std::chrono::steady_clock::now();
     for ( auto n=0; n<ncyc; n++ ) {
        grid_->deriv(u, idir, *utmp[0], dunew);
     }
+    tdiff = std::chrono::steady_clock::now() - tstart; tnew = tdiff.count();
+    GEOFLOW_TRACE_STOP();
+
+    grid_->set_derivtype(GGrid<Types>::GDV_SPECP); // const order, specialized
+    GEOFLOW_TRACE_START("spec_deriv");
+    tstart = std::chrono::steady_clock::now();
+    for ( auto n=0; n<ncyc; n++ ) {
+       grid_->deriv(u, idir, *utmp[0], duspec);
+    }
+    tdiff = std::chrono::steady_clock::now() - tstart; tspec = tdiff.count();
+    GEOFLOW_TRACE_STOP();
+
+    // Fused gradient computes all components in one pass:
+    GEOFLOW_TRACE_START("fused_grad");
+    tstart = std::chrono::steady_clock::now();
+    for ( auto n=0; n<ncyc; n++ ) {
+       grid_->grad(u, TRUE, *utmp[0], dgrad);
+    }
+    tdiff = std::chrono::steady_clock::now() - tstart; tgrad = tdiff.count();
     GEOFLOW_TRACE_STOP();
 
 //cout << "da_y  =" << *da   [idir-1] << endl;
@@ -209,13 +238,13 @@ int main(int argc, char **argv)
     // Find inf-norm and L2-norm errors for each method::
     GTMatrix<GFTYPE> errs(NMETH,2); // for each method, Linf and L2 errs
     StateComp        lnorm(2), gnorm(2);
-    std::string      smethod[NMETH] = {"old", "new"};
+    std::string      smethod[NMETH] = {"old", "new", "specialized", "fused_grad"};
 
     /////////////////////////////////////////////////////////////////
     //////////////////////// Compute Errors /////////////////////////
     /////////////////////////////////////////////////////////////////
-    du[0] = &duold; du[1] = &dunew;
-    for ( auto n=0; n<NMETH; n++ ) { // over old and new methods
+    du[0] = &duold; du[1] = &dunew; du[2] = &duspec; du[3] = dgrad[idir-1];
+    for ( auto n=0; n<NMETH; n++ ) { // over old, new, specialized, fused methods
       diff     = (*da[idir-1]) - (*du[n]);
      *utmp [0] = diff;                   // for inf-norm
      *utmp [1] = diff; utmp[1]->rpow(2); // for L2 norm
@@ -236,7 +265,7 @@ int main(int argc, char **argv)
         }
       }
 
-    } // end, new-old method loop
+    } // end, method loop
 
 
     // Print convergence data to file:
@@ -247,7 +276,7 @@ int main(int argc, char **argv)
 
     // Write header, if required:
     if ( itst.peek() == std::ofstream::traits_type::eof() ) {
-    ios << "#  idir   p      num_elems  ncyc  inf_err_old  L2_err_old  t_old   inf_err_new  L2_err_new   t_new" << std::endl;
+    ios << "#  idir   p      num_elems  ncyc  inf_err_old  L2_err_old  t_old   inf_err_new  L2_err_new   t_new   inf_err_spec  L2_err_spec   t_spec   inf_err_grad  L2_err_grad   t_grad(all)" << std::endl;
     }
     itst.close();
 
@@ -257,6 +286,8 @@ int main(int argc, char **argv)
         << "  " << ncyc
         << "  " << errs(0,0) << "  " << errs(0,1) << "  " << told
         << "  " << errs(1,0) << "  " << errs(1,1) << "  " << tnew
+        << "  " << errs(2,0) << "  " << errs(2,1) << "  " << tspec
+        << "  " << errs(3,0) << "  " << errs(3,1) << "  " << tgrad
         << std::endl;
     ios.close();
  
@@ -19,6 +19,10 @@
   #include "cublas_v2.h"
 #endif
 
+#if !defined(GCBLAS_SMALL_MAXK)
+  # define GCBLAS_SMALL_MAXK 13 // max. inner dimension for small-GEMM kernels
+#endif
+
 namespace GCBLAS
 {
 
@@ -76,6 +80,15 @@ void batched_gemm( cuMatBlockDat &cudat,
           const T *B, const int ldb, const T beta,
           T *C, const int ldc);
 
+// Register-blocked kernels for batches of small GEMMs with
+// constant, square B, C_e = alpha A_e B + beta C_e, on CPU:
+template<typename T, GINT K>
+void small_batched_gemm(const int M, const T alpha, const T *A, 
+                        const T *B, const T beta, T *C, GSIZET nbatch);
+template<typename T, GINT K>
+GBOOL small_batched_gemm_dispatch(const int Kr, const int M, const T alpha, const T *A, 
+                        const T *B, const T beta, T *C, GSIZET nbatch);
+
 
 } // end, namespace GCBLAS
 
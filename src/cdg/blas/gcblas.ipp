@@ -87,7 +87,10 @@ void gemm(GBlasHandle h,
 // METHOD : batched_gemm
 // DESC   : Args should be the matrix specs for a singe 'element';
 //          A, C are of same dimension and layout; B is constant,
-//         'small' 1d matrix
+//         'small' 1d matrix. On the CPU (CBLAS) path, column-major
+//          products with square B of size <= GCBLAS_SMALL_MAXK are 
+//          done for the whole batch by small_batched_gemm, rather 
+//          than by one BLAS call per element.
 // ARGS   : 
 // RETURNS: 
 //**********************************************************************************
@@ -103,19 +106,28 @@ void batched_gemm(cuMatBlockDat &cudat,
 {
   GEOFLOW_TRACE();
   GINT   nstreams=cudat.pStream.size();
-  GSIZET iastart, iastride, ibstride, szblk;
+  GSIZET iastart, iastride, ibstride, szblka, szblkc;
  
 #if defined(GEOFLOW_USE_CBLAS)
 
-  szblk = M * K;
+  if ( Order  == CblasColMajor && TransA == CblasNoTrans 
+    && TransB == CblasNoTrans  && N == K 
+    && lda == M && ldb == K && ldc == M
+    && small_batched_gemm_dispatch<T,1>(K, M, alpha, A, B, beta, C, cudat.nbatch) ) {
+    return;
+  }
+
+  // No small-GEMM kernel applies; one BLAS call per element:
+  szblka = M * K;
+  szblkc = M * N;
 
-#pragma omp parallel for
-  for ( auto j=0; j < cudat.nbatch; j++ ) {
+  GEXEC_PARALLEL_FOR_ELEMS(cudat.nbatch)
+  for ( GLLONG j=0; j < cudat.nbatch; j++ ) {
     GCBLAS::gemm<T>( cudat.hcublas, Order, TransA, TransB,
                      M, N, K,
-                     alpha, A+j*szblk, lda,
+                     alpha, A+j*szblka, lda,
                      B, ldb, beta,
-                     C+j*szblk, ldc);
+                     C+j*szblkc, ldc);
 
   }
 
@@ -171,6 +183,90 @@ void batched_gemm(cuMatBlockDat &cudat,
 } // end, bacthed_gemm
 
 
+//**********************************************************************************
+//**********************************************************************************
+// METHOD : small_batched_gemm
+// DESC   : Compute column-major products
+//            C_e = alpha A_e B + beta C_e, e = 0, ..., nbatch-1,
+//          where A_e, C_e are M X K, stored contiguously one after
+//          the other, and B is a constant K X K matrix. K is known at
+//          compile time, so the inner product is unrolled and each 
+//          column of B held in registers while the M rows of A_e are 
+//          streamed (and vectorized) over.
+// ARGS   : M     : number of rows in A_e, C_e
+//          alpha : factor multiplying A_e B
+//          A     : batch of A_e
+//          B     : constant K X K matrix
+//          beta  : factor multiplying C_e on entry
+//          C     : batch of C_e; may not alias A
+//          nbatch: number of elements in batch
+// RETURNS: none
+//**********************************************************************************
+template<typename T, GINT K>
+void small_batched_gemm(const int M, const T alpha, const T *A, 
+                        const T *B, const T beta, T *C, GSIZET nbatch)
+{
+  GEOFLOW_TRACE();
+  GSIZET szblk = M * K;
+  T      b[K*K];
+
+  for ( auto j=0; j<K*K; j++ ) b[j] = B[j];
+
+  GEXEC_PARALLEL_FOR_ELEMS(nbatch)
+  for ( GLLONG e=0; e<nbatch; e++ ) {
+    const T *a = A + e*szblk;
+          T *c = C + e*szblk;
+    for ( auto n=0; n<K; n++ ) {
+      const T *bn = b + n*K;
+            T *cn = c + n*M;
+      if ( beta == static_cast<T>(0) ) { // C_e not read
+        for ( auto m=0; m<M; m++ ) {
+          T acc = a[m]*bn[0];
+          for ( auto k=1; k<K; k++ ) acc += a[m+k*M]*bn[k];
+          cn[m] = alpha*acc;
+        }
+      }
+      else {
+        for ( auto m=0; m<M; m++ ) {
+          T acc = a[m]*bn[0];
+          for ( auto k=1; k<K; k++ ) acc += a[m+k*M]*bn[k];
+          cn[m] = alpha*acc + beta*cn[m];
+        }
+      }
+    }
+  }
+
+} // end, small_batched_gemm
+
+
+//**********************************************************************************
+//**********************************************************************************
+// METHOD : small_batched_gemm_dispatch
+// DESC   : Find compile-time small_batched_gemm kernel matching runtime
+//          inner dimension, Kr, starting search at K
+// ARGS   : Kr  : runtime inner dimension
+//          rest: see small_batched_gemm
+// RETURNS: TRUE if a kernel was found and applied; FALSE if Kr is
+//          not in [K, GCBLAS_SMALL_MAXK], in which case C is unchanged
+//**********************************************************************************
+template<typename T, GINT K>
+GBOOL small_batched_gemm_dispatch(const int Kr, const int M, const T alpha, const T *A, 
+                                  const T *B, const T beta, T *C, GSIZET nbatch)
+{
+  if constexpr ( K > GCBLAS_SMALL_MAXK ) {
+    return FALSE;
+  }
+  else {
+    if ( Kr == K ) {
+      small_batched_gemm<T,K>(M, alpha, A, B, beta, C, nbatch);
+      return TRUE;
+    }
+    return small_batched_gemm_dispatch<T,K+1>(Kr, M, alpha, A, B, beta, C, nbatch);
+  }
+
+} // end, small_batched_gemm_dispatch
+
+
 } // end, namespace GCUDA
 
 
@@ -12,6 +12,7 @@
 #include <assert.h>
 #include <limits>
 #include "gtypes.h"
+#include "gexec.h"
 #include "cff_blas.h"
 
 #include "gtvector.hpp"
@@ -199,6 +200,9 @@ namespace GMTK
   template<typename Grid, typename T>
   void    grad(Grid &grid, GTVector<T> &u, const GINT idir, 
                GTVector<GTVector<T>*> &tmp, GTVector<T> &grad);
+  template<typename Grid, typename T>
+  void    grad(Grid &grid, GTVector<T> &u, 
+               GTVector<GTVector<T>*> &tmp, GTVector<GTVector<T>*> &grad);
 
   template<typename Grid, typename T>
   void    curl(Grid &grid, const GTVector<GTVector<T>*> &u, const GINT idir, 
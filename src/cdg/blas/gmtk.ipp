@@ -1100,11 +1100,13 @@ void paxy(GTVector<T> &z, const GTVector<T> &x, T a, const GTVector<T> &y)
 {
 	GEOFLOW_TRACE();
   if ( y.size() > 1 ) {
+    GEXEC_PARALLEL_FOR(x.size())
     for ( auto j=0; j<x.size(); j++ ) { 
       z[j] = a*x[j]*y[j];
     }
   }
   else { // to make consistent with GTVector
+    GEXEC_PARALLEL_FOR(x.size())
     for ( auto j=0; j<x.size(); j++ ) { 
       z[j] = a*x[j]*y[0];
     }
@@ -1130,11 +1132,13 @@ void paxy(GTVector<T> &x, T a, const GTVector<T> &y)
 {
 	GEOFLOW_TRACE();
   if ( y.size() > 1 ) {
+    GEXEC_PARALLEL_FOR(x.size())
     for ( auto j=0; j<x.size(); j++ ) { 
       x[j] = a*x[j]*y[j];
     }
   }
   else { // to make consistent with GTVector
+    GEXEC_PARALLEL_FOR(x.size())
     for ( auto j=0; j<x.size(); j++ ) { 
       x[j] = a*x[j]*y[0];
     }
@@ -1160,11 +1164,13 @@ void saxpby(GTVector<T> &x, T a, GTVector<T> &y, T b)
 {
 	GEOFLOW_TRACE();
   if ( y.size() > 1 ) {
+    GEXEC_PARALLEL_FOR(x.size())
     for ( auto j=0; j<x.size(); j++ ) { 
       x[j] = a*x[j] + b*y[j];
     }
   }
   else { // to make consistent with GTVector
+    GEXEC_PARALLEL_FOR(x.size())
     for ( auto j=0; j<x.size(); j++ ) { 
       x[j] = a*x[j] + b*y[0];
     }
@@ -1191,11 +1197,13 @@ void saxpby(GTVector<T> &z, GTVector<T> &x, T a, GTVector<T> &y, T b)
 {
 	GEOFLOW_TRACE();
   if ( y.size() > 1 ) {
+    GEXEC_PARALLEL_FOR(x.size())
     for ( auto j=0; j<x.size(); j++ ) { 
       z[j] = a*x[j] + b*y[j];
     }
   }
   else { // to make consistent with GTVector
+    GEXEC_PARALLEL_FOR(x.size())
     for ( auto j=0; j<x.size(); j++ ) { 
       z[j] = a*x[j] + b*y[0];
     }
@@ -1255,6 +1263,7 @@ void zero(GTVector<T> &u)
 	GEOFLOW_TRACE();
   T tiny=std::numeric_limits<T>::epsilon();
 
+  GEXEC_PARALLEL_FOR(u.size())
   for ( auto j=0; j<u.size(); j++ ) {
     if ( fabs(u[j]) < tiny ) u[j] = 0.0;
   }
@@ -2689,7 +2698,7 @@ void matmat_prod(GTMatrix<T> &C, const GTMatrix<T> &A, const GTMatrix<T> &B)
 // ARGS   : 
 //          x  : first vector field; may be NULL or constant
 //          y  : second vector  field; may be NULL or constant
-//          tmp: tmp vector, of full size
+//          tmp: tmp vector, of full size; not used
 //          r  : scalar field containing injection rate, of full size
 // RETURNS: none.
 //**********************************************************************************
@@ -2699,24 +2708,28 @@ void dot(GTVector<GTVector<T>*> &x, GTVector<GTVector<T>*> &y, GTVector<T> &tmp,
 	GEOFLOW_TRACE();
    assert(x.size() == y.size());
 
+   // Products are accumulated directly into r:
    r = 0.0;
    for ( auto j=0; j<x.size(); j++ ) {
 
      if ( x[j] == NULLPTR || y[j] == NULLPTR ) continue;
-     if      ( x[j]->size() == 1 && y[j]->size() == 1 ) { // x , y constant
-       tmp =  (*x[j])[0] * (*y[j])[0];
+     GTVector<T> &xj = *x[j];
+     GTVector<T> &yj = *y[j];
+     if      ( xj.size() == 1 && yj.size() == 1 ) { // x , y constant
+       r += xj[0] * yj[0];
      }
-     else if ( x[j]->size() >  1 && y[j]->size() == 1 ) { // y constant
-       GMTK::saxpby<T>(tmp, 1.0, *x[j], (*y[j])[0]);  
-       
+     else if ( xj.size() >  1 && yj.size() == 1 ) { // y constant
+       GEXEC_PARALLEL_FOR(r.size())
+       for ( auto i=0; i<r.size(); i++ ) r[i] += xj[i]*yj[0];
      }
-     else if ( x[j]->size() == 1 && y[j]->size() >  1 ) { // x constant
-       GMTK::saxpby<T>(tmp, 1.0, *y[j], (*x[j])[0]);  
+     else if ( xj.size() == 1 && yj.size() >  1 ) { // x constant
+       GEXEC_PARALLEL_FOR(r.size())
+       for ( auto i=0; i<r.size(); i++ ) r[i] += xj[0]*yj[i];
      }
      else {                                               // x, y of full length
-       x[j]->pointProd(*y[j], tmp);
+       GEXEC_PARALLEL_FOR(r.size())
+       for ( auto i=0; i<r.size(); i++ ) r[i] += xj[i]*yj[i];
      }
-     r += tmp;
 
    }
 
@@ -2867,7 +2880,7 @@ void curl(Grid &grid, const GTVector<GTVector<T>*> &u, const GINT idir,
 
 //**********************************************************************************
 //**********************************************************************************
-// METHOD : grad
+// METHOD : grad (1)
 // DESC   : Compute gradient component, idir, of input vector field.
 //          Note: Don't really need this, as it's just another way
 //                to refer to the Cartesian 'deriv' method in Grid
@@ -2889,7 +2902,33 @@ void grad(Grid &grid, GTVector<T> &u, const GINT idir,
 
   grid.deriv(u, idir, *tmp[0], gradc);
 
-} // end of method grad
+} // end of method grad (1)
+
+
+//**********************************************************************************
+//**********************************************************************************
+// METHOD : grad (2)
+// DESC   : Compute all components of gradient of input field in one 
+//          call, allowing grid to fuse the reference derivatives 
+//          and metric terms.
+//          
+// ARGS   : grid : grid
+//          u    : input (scalar) field. 
+//          tmp  : tmp vector; must be of at least length 1.
+//          gradc: result; size determines number of components computed, 
+//                 and must be appropriate for problem dimension.
+// RETURNS: none.
+//**********************************************************************************
+template<typename Grid, typename T>
+void grad(Grid &grid, GTVector<T> &u, 
+          GTVector<GTVector<T>*> &tmp, GTVector<GTVector<T>*> &gradc)
+{
+  GEOFLOW_TRACE();
+  assert ( gradc.size() >= GDIM && gradc.size() <=3 && "Invalid compoment specified");
+
+  grid.grad(u, TRUE, *tmp[0], gradc);
+
+} // end of method grad (2)
 
 
 //**********************************************************************************
@@ -3752,10 +3791,12 @@ void domathop(Grid &grid, const GTVector<GTVector<T>*> &uin,  const GString sop,
     assert(uin  .size() >= 1   && "Incorrect no. input components");
     assert(uout .size() >= nxy && "Insufficient no. output components");
     iuout.resize(nxy); 
-      for ( auto j=0; j<nxy; j++ ) {
-      GMTK::grad(grid, *uin[0], j+1, utmp, *uout[j]);
+    tmp.resize(nxy);
+    for ( auto j=0; j<nxy; j++ ) {
+      tmp[j] = uout[j];
       iuout[j] = j; 
     }
+    GMTK::grad(grid, *uin[0], utmp, tmp); // all components at once
   }
   else if ( "gradmag" == sop ) {  // operates on a scalar field...
     // produces a scalar field:
@@ -0,0 +1,98 @@
+//==================================================================================
+// Module       : gtpderiv.hpp
+// Date         : 10/17/26
+// Description  : Namespace for tensor-product derivative kernels specialized
+//                at compile time on the 1d node count, N = p+1, for
+//                p = 1, ..., GTPDERIV_MAXORDER. Kernels operate on
+//                a contiguous batch of elements of constant, isotropic
+//                order, so that all inner loops have fixed trip counts,
+//                are fully unrolled and vectorize across nodes/elements.
+//                A runtime dispatcher selects the kernel from N.
+//                Fused gradient kernels compute all reference derivatives
+//                (and, optionally, apply the metric) a few elements at a 
+//                time, so that each element block is read from memory once.
+//                The fused Helmholtz kernel for regular elements likewise
+//                does gradient, scaling, transpose gradient, and mass term
+//                on each element block while it is in cache.
+// Copyright    : Copyright 2021. Colorado State University. All rights reserved.
+// Derived From : none.
+//==================================================================================
+#if !defined(_GTPDERIV_HPP)
+#define _GTPDERIV_HPP
+
+#include "gtypes.h"
+#include "gtvector.hpp"
+#include "gtmatrix.hpp"
+
+#if !defined(GTPDERIV_MAXORDER)
+  # define GTPDERIV_MAXORDER 12
+#endif
+#if !defined(GTPDERIV_BLKSIZE)
+  # define GTPDERIV_BLKSIZE  512 // nodes per block in fused kernels
+#endif
+
+
+namespace GTPDeriv
+{
+
+enum GTPDir    {GTP_D1=0, GTP_D2, GTP_D3};                      // direction of 1d operator
+enum GTPMetric {GTP_NOMETRIC=0, GTP_DIAGMETRIC, GTP_FULLMETRIC}; // metric applied to gradient
+
+// Element-batched kernels for fixed 1d size, N:
+template<typename T, GINT N>
+void tp_d1 (const T *D1 , const T *u, GSIZET nslab, T *y);    // y = (I X D1) u
+template<typename T, GINT N, GSIZET NI>
+void tp_dk (const T *DkT, const T *u, GSIZET nslab, T *y);    // y = (DkT^T X I_NI) u
+template<typename T, GINT N>
+void tp_d1_blk(const T *D, const T *u, GSIZET nslab, T *y);   // tp_d1, D local
+template<typename T, GINT N, GSIZET NI>
+void tp_dk_blk(const T *D, const T *u, GSIZET nslab, T *y);   // tp_dk, D local
+
+template<typename T, GINT N, GINT NDIM>
+void tp_grad(const T * const *D, const T *u, GSIZET Ne, 
+             GTPMetric mtype, const T * const *G, GINT nout, T * const *du);
+template<typename T, GINT N, GINT NDIM>
+void tp_helm(const T * const *D, const T * const *DT, const T *u, GSIZET Ne,
+             const T * const *G, const T *mass, const T *p, T pfact,
+             const T *q, T qfact, T *uo);
+
+// Runtime dispatchers; these return FALSE, without setting output, if
+// the order or dimension is unsupported, so that caller may fall back
+// on general kernels:
+inline
+GBOOL supported(GSIZET N) { return N >= 2 && N <= GTPDERIV_MAXORDER+1; }
+
+template<typename T>
+GBOOL I2_X_D1     (GTMatrix<T> &D1 , GTVector<T> &u,
+                  GSIZET N1, GSIZET N2, GSIZET Ne, GTVector<T> &y);
+template<typename T>
+GBOOL D2_X_I1     (GTMatrix<T> &D2T, GTVector<T> &u,
+                  GSIZET N1, GSIZET N2, GSIZET Ne, GTVector<T> &y);
+template<typename T>
+GBOOL I3_X_I2_X_D1(GTMatrix<T> &D1 , GTVector<T> &u,
+                  GSIZET N1, GSIZET N2, GSIZET N3, GSIZET Ne, GTVector<T> &y);
+template<typename T>
+GBOOL I3_X_D2_X_I1(GTMatrix<T> &D2T, GTVector<T> &u,
+                  GSIZET N1, GSIZET N2, GSIZET N3, GSIZET Ne, GTVector<T> &y);
+template<typename T>
+GBOOL D3_X_I2_X_I1(GTMatrix<T> &D3T, GTVector<T> &u,
+                  GSIZET N1, GSIZET N2, GSIZET N3, GSIZET Ne, GTVector<T> &y);
+
+template<typename T>
+GBOOL grad        (GTVector<GTMatrix<T>*> &D, GTVector<T> &u, 
+                  GSIZET N, GSIZET Ne, GTPMetric mtype, 
+                  GTVector<GTVector<T>*> &G, GTVector<GTVector<T>*> &du);
+
+template<typename T>
+GBOOL helm        (GTVector<GTMatrix<T>*> &D, GTVector<GTMatrix<T>*> &DT,
+                  GTVector<T> &u, GSIZET N, GSIZET Ne, GSIZET ibeg,
+                  GTVector<GTVector<T>*> &G, GTVector<T> &mass,
+                  GTVector<T> *p, T pfact, GTVector<T> *q, T qfact,
+                  GTVector<T> &uo);
+
+} // end, namespace GTPDeriv
+
+#include "gtpderiv.ipp"
+
+#endif // !defined(_GTPDERIV_HPP)
+
@@ -0,0 +1,683 @@
+//==================================================================================
+// Module       : gtpderiv.ipp
+// Date         : 10/17/26
+// Description  : GTPDeriv namespace template definitions
+// Copyright    : Copyright 2021. Colorado State University. All rights reserved.
+// Derived From : none.
+//==================================================================================
+
+#include <cassert>
+#include "tbox/tracer.hpp"
+
+namespace GTPDeriv
+{
+
+//**********************************************************************************
+//**********************************************************************************
+// METHOD : tp_d1
+// DESC   : Apply 1d operator in the 1-direction to a batch of 'slabs':
+//            y(:,s) = D1 u(:,s), s = 0, ..., nslab-1
+//          where each slab is a contiguous column of N nodes. Since
+//          (I X D1) acts identically on each 1-line, nslab = N*Ne in 2d,
+//          and N*N*Ne in 3d.
+// ARGS   : D1   : 1-direction (dense) operator, N X N, column-major
+//          u    : operand, of size >= N*nslab
+//          nslab: number of 1-lines in u
+//          y    : result, of size >= N*nslab; may not alias u
+// RETURNS: none
+//**********************************************************************************
+template<typename T, GINT N>
+void tp_d1(const T *D1, const T *u, GSIZET nslab, T *y)
+{
+  T D[N*N];
+
+  for ( auto j=0; j<N*N; j++ ) D[j] = D1[j];
+
+  tp_d1_blk<T,N>(D, u, nslab, y);
+
+} // end, method tp_d1
+
+
+//**********************************************************************************
+//**********************************************************************************
+// METHOD : tp_d1_blk
+// DESC   : Kernel for tp_d1, operating on (local) copy of operator, so
+//          that it may be reused by callers over many small batches
+// ARGS   : see tp_d1
+// RETURNS: none
+//**********************************************************************************
+template<typename T, GINT N>
+inline void tp_d1_blk(const T *D, const T *u, GSIZET nslab, T *y)
+{
+  T acc[N];
+
+  for ( GSIZET s=0; s<nslab; s++ ) {
+    const T *us = u + s*N;
+          T *ys = y + s*N;
+    for ( auto i=0; i<N; i++ ) acc[i] = D[i]*us[0];
+    for ( auto l=1; l<N; l++ ) {
+      for ( auto i=0; i<N; i++ ) acc[i] += D[i+l*N]*us[l];
+    }
+    for ( auto i=0; i<N; i++ ) ys[i] = acc[i];
+  }
+
+} // end, method tp_d1_blk
+
+
+//**********************************************************************************
+//**********************************************************************************
+// METHOD : tp_dk
+// DESC   : Apply 1d operator in an 'outer' direction to a batch of slabs,
+//          each consisting of N contiguous blocks of NI nodes:
+//            y(i,j,s) = Sum_l u(i,l,s) DkT(l,j)
+//          For the 2-direction, NI = N (2d and 3d, with nslab = Ne and
+//          N*Ne, respectively); for the 3-direction NI = N*N, and
+//          nslab = Ne. The i-loop is contiguous, so vectorizes.
+// ARGS   : DkT  : transpose of k-direction (dense) operator, N X N
+//          u    : operand, of size >= NI*N*nslab
+//          nslab: number of slabs in u
+//          y    : result, of size >= NI*N*nslab; may not alias u
+// RETURNS: none
+//**********************************************************************************
+template<typename T, GINT N, GSIZET NI>
+void tp_dk(const T *DkT, const T *u, GSIZET nslab, T *y)
+{
+  T D[N*N];
+
+  for ( auto j=0; j<N*N; j++ ) D[j] = DkT[j];
+
+  tp_dk_blk<T,N,NI>(D, u, nslab, y);
+
+} // end, method tp_dk
+
+
+//**********************************************************************************
+//**********************************************************************************
+// METHOD : tp_dk_blk
+// DESC   : Kernel for tp_dk, operating on (local) copy of operator, so
+//          that it may be reused by callers over many small batches
+// ARGS   : see tp_dk
+// RETURNS: none
+//**********************************************************************************
+template<typename T, GINT N, GSIZET NI>
+inline void tp_dk_blk(const T *D, const T *u, GSIZET nslab, T *y)
+{
+  T sum;
+
+  for ( GSIZET s=0; s<nslab; s++ ) {
+    const T *us = u + s*NI*N;
+          T *ys = y + s*NI*N;
+    for ( auto j=0; j<N; j++ ) {
+      for ( GSIZET i=0; i<NI; i++ ) {
+        sum = 0;
+        for ( auto l=0; l<N; l++ ) sum += us[i+l*NI]*D[l+j*N];
+        ys[i+j*NI] = sum;
+      }
+    }
+  }
+
+} // end, method tp_dk_blk
+
+
+//**********************************************************************************
+//**********************************************************************************
+// METHOD : tp_grad
+// DESC   : Compute all NDIM reference derivatives of u, one small block
+//          of elements at a time, and optionally apply the metric while 
+//          the block is still in cache:
+//            GTP_NOMETRIC  : du_k = D_k u
+//            GTP_DIAGMETRIC: du_k = G_k D_k u
+//            GTP_FULLMETRIC: du_i = Sum_j G_(j,i) D_j u, i < nout
+// ARGS   : D    : 1d operators, D1, D2T (, D3T), each N X N
+//          u    : operand, of size >= N^NDIM*Ne
+//          Ne   : number of elements
+//          mtype: metric type
+//          G    : metric; for GTP_DIAGMETRIC, NDIM pointers, one for 
+//                 each direction; for GTP_FULLMETRIC, NDIM*nout pointers, 
+//                 with G_(j,i) = G[j+NDIM*i]. Each of size >= N^NDIM*Ne.
+//                 Not used for GTP_NOMETRIC
+//          nout : number of output components; = NDIM unless 
+//                 mtype == GTP_FULLMETRIC
+//          du   : nout output components; may not alias u
+// RETURNS: none
+//**********************************************************************************
+template<typename T, GINT N, GINT NDIM>
+void tp_grad(const T * const *D, const T *u, GSIZET Ne, 
+             GTPMetric mtype, const T * const *G, GINT nout, T * const *du)
+{
+  constexpr GSIZET NN = NDIM == 2 ? N*N : N*N*N;
+  constexpr GSIZET NB = NN >= GTPDERIV_BLKSIZE ? 1 : GTPDERIV_BLKSIZE/NN; // elems per block
+  GSIZET           off, nb, nn;
+  T                Dl[NDIM][N*N];
+  T                r[NDIM][NB*NN];
+  T               *rk[NDIM];
+  T               *d;
+  const T         *g;
+
+  for ( auto k=0; k<NDIM; k++ ) {
+    for ( auto j=0; j<N*N; j++ ) Dl[k][j] = D[k][j];
+  }
+
+  // Process blocks of nb elements, small enough that
+  // operand and all ref. derivatives remain in cache:
+  for ( GSIZET e=0; e<Ne; e+=NB ) {
+    off = e*NN;
+    nb  = Ne-e < NB ? Ne-e : NB;
+    nn  = nb*NN;
+
+    // Write ref. derivs to output directly, unless they
+    // must be combined:
+    for ( auto k=0; k<NDIM; k++ ) {
+      rk[k] = mtype == GTP_FULLMETRIC ? r[k] : du[k] + off;
+    }
+
+    tp_d1_blk<T,N>      (Dl[0], u+off, nn/N, rk[0]);
+    tp_dk_blk<T,N,N>    (Dl[1], u+off, nn/(N*N), rk[1]);
+    if constexpr ( NDIM == 3 ) {
+      tp_dk_blk<T,N,N*N>(Dl[2], u+off, nb, rk[2]);
+    }
+
+    switch ( mtype ) {
+      case GTP_NOMETRIC:
+        break;
+      case GTP_DIAGMETRIC:
+        for ( auto k=0; k<NDIM; k++ ) {
+          g = G[k] + off;
+          for ( GSIZET n=0; n<nn; n++ ) rk[k][n] *= g[n];
+        }
+        break;
+      case GTP_FULLMETRIC:
+        for ( auto i=0; i<nout; i++ ) {
+          d = du[i] + off;
+          g = G[NDIM*i] + off;
+          for ( GSIZET n=0; n<nn; n++ ) d[n] = g[n]*r[0][n];
+          for ( auto j=1; j<NDIM; j++ ) {
+            g = G[j+NDIM*i] + off;
+            for ( GSIZET n=0; n<nn; n++ ) d[n] += g[n]*r[j][n];
+          }
+        }
+        break;
+      default:
+        assert(FALSE && "Invalid metric type");
+    }
+  }
+
+} // end, method tp_grad
+
+
+//**********************************************************************************
+//**********************************************************************************
+// METHOD : tp_helm
+// DESC   : Apply SEM Helmholtz operator for regular elements,
+//            uo = pfact Sum_k DT_k (p G_k M D_k u) + qfact q M u,
+//          one small block of elements at a time, so that the operand, 
+//          its reference derivatives, and the result remain in cache.
+//          Here, M is the (diagonal) mass, and G_k the (diagonal) metric.
+// ARGS   : D    : 1d operators, D1, D2T (, D3T), each N X N
+//          DT   : 1d transpose operators, D1T, D2 (, D3), each N X N
+//          u    : operand, of size >= N^NDIM*Ne
+//          Ne   : number of elements
+//          G    : NDIM diagonal metric components; NULLPTR if none
+//          mass : mass, including Jacobian
+//          p    : variable Laplacian factor; NULLPTR if none
+//          pfact: constant Laplacian factor
+//          q    : variable mass factor; NULLPTR if none
+//          qfact: constant mass factor; mass term is omitted if 
+//                 q == NULLPTR and qfact == 0
+//          uo   : result; may not alias u
+//          All of G, mass, p, q, are of size >= N^NDIM*Ne.
+// RETURNS: none
+//**********************************************************************************
+template<typename T, GINT N, GINT NDIM>
+void tp_helm(const T * const *D, const T * const *DT, const T *u, GSIZET Ne,
+             const T * const *G, const T *mass, const T *p, T pfact,
+             const T *q, T qfact, T *uo)
+{
+  constexpr GSIZET NN = NDIM == 2 ? N*N : N*N*N;
+  constexpr GSIZET NB = NN >= GTPDERIV_BLKSIZE ? 1 : GTPDERIV_BLKSIZE/NN; // elems per block
+  GBOOL            bmass = q != NULLPTR || qfact != 0;
+  GSIZET           off, nb, nn;
+  T                Dl[NDIM][N*N], DTl[NDIM][N*N];
+  T                r[NDIM][NB*NN];
+  T                w[NB*NN];
+  const T         *ub;
+  T               *ob;
+
+  for ( auto k=0; k<NDIM; k++ ) {
+    for ( auto j=0; j<N*N; j++ ) { Dl[k][j] = D[k][j]; DTl[k][j] = DT[k][j]; }
+  }
+
+  for ( GSIZET e=0; e<Ne; e+=NB ) {
+    off = e*NN;
+    nb  = Ne-e < NB ? Ne-e : NB;
+    nn  = nb*NN;
+    ub  = u  + off;
+    ob  = uo + off;
+
+    // Reference derivatives:
+    tp_d1_blk<T,N>      (Dl[0], ub, nn/N, r[0]);
+    tp_dk_blk<T,N,N>    (Dl[1], ub, nn/(N*N), r[1]);
+    if constexpr ( NDIM == 3 ) {
+      tp_dk_blk<T,N,N*N>(Dl[2], ub, nb, r[2]);
+    }
+
+    // Scale by mass, variable p, and metric:
+    for ( GSIZET n=0; n<nn; n++ ) w[n] = mass[off+n];
+    if ( p != NULLPTR ) {
+      for ( GSIZET n=0; n<nn; n++ ) w[n] *= p[off+n];
+    }
+    for ( auto k=0; k<NDIM; k++ ) {
+      if ( G != NULLPTR ) {
+        for ( GSIZET n=0; n<nn; n++ ) r[k][n] *= w[n]*G[k][off+n];
+      }
+      else {
+        for ( GSIZET n=0; n<nn; n++ ) r[k][n] *= w[n];
+      }
+    }
+
+    // Transpose derivatives, summed:
+    tp_d1_blk<T,N>      (DTl[0], r[0], nn/N, ob);
+    tp_dk_blk<T,N,N>    (DTl[1], r[1], nn/(N*N), w);
+    for ( GSIZET n=0; n<nn; n++ ) ob[n] += w[n];
+    if constexpr ( NDIM == 3 ) {
+      tp_dk_blk<T,N,N*N>(DTl[2], r[2], nb, w);
+      for ( GSIZET n=0; n<nn; n++ ) ob[n] += w[n];
+    }
+
+    // Constant p, and mass term:
+    if ( pfact != 1 ) {
+      for ( GSIZET n=0; n<nn; n++ ) ob[n] *= pfact;
+    }
+    if ( q != NULLPTR ) {
+      for ( GSIZET n=0; n<nn; n++ ) ob[n] += q[off+n]*mass[off+n]*ub[n];
+    }
+    else if ( bmass ) {
+      for ( GSIZET n=0; n<nn; n++ ) ob[n] += qfact*mass[off+n]*ub[n];
+    }
+  }
+
+} // end, method tp_helm
+
+
+//**********************************************************************************
+//**********************************************************************************
+// METHOD : tp_apply
+// DESC   : Select kernel for fixed N from direction and problem dimension
+// ARGS   : dir : operator direction
+//          ndim: problem dimension (2 or 3)
+//          D   : 1d operator (D1 for dir == GTP_D1, else transpose)
+//          u   : operand for Ne elements
+//          Ne  : number of elements
+//          y   : result
+// RETURNS: TRUE if dir is valid for ndim; else FALSE, and y is not set
+//**********************************************************************************
+template<typename T, GINT N>
+GBOOL tp_apply(GTPDir dir, GINT ndim, const T *D, const T *u, GSIZET Ne, T *y)
+{
+  if ( ndim == 2 ) {
+    switch ( dir ) {
+      case GTP_D1:
+        tp_d1<T,N>     (D, u, N*Ne, y);
+        break;
+      case GTP_D2:
+        tp_dk<T,N,N>   (D, u, Ne, y);
+        break;
+      default:
+        return FALSE;
+    }
+  }
+  else {
+    switch ( dir ) {
+      case GTP_D1:
+        tp_d1<T,N>     (D, u, N*N*Ne, y);
+        break;
+      case GTP_D2:
+        tp_dk<T,N,N>   (D, u, N*Ne, y);
+        break;
+      case GTP_D3:
+        tp_dk<T,N,N*N> (D, u, Ne, y);
+        break;
+      default:
+        return FALSE;
+    }
+  }
+
+  return TRUE;
+
+} // end, method tp_apply
+
+
+//**********************************************************************************
+//**********************************************************************************
+// METHOD : tp_dispatch
+// DESC   : Find compile-time kernel matching runtime 1d size, Nr,
+//          starting search at N
+// ARGS   : Nr  : runtime 1d size
+//          rest: see tp_apply
+// RETURNS: TRUE if a kernel was applied; else FALSE, and y is not set
+//**********************************************************************************
+template<typename T, GINT N>
+GBOOL tp_dispatch(GSIZET Nr, GTPDir dir, GINT ndim, const T *D, const T *u, GSIZET Ne, T *y)
+{
+  if constexpr ( N > GTPDERIV_MAXORDER+1 ) {
+    return FALSE; // unsupported order
+  }
+  else {
+    if ( Nr == N ) return tp_apply<T,N>(dir, ndim, D, u, Ne, y);
+    else           return tp_dispatch<T,N+1>(Nr, dir, ndim, D, u, Ne, y);
+  }
+
+} // end, method tp_dispatch
+
+
+//**********************************************************************************
+//**********************************************************************************
+// METHOD : tp_grad_dispatch
+// DESC   : Find compile-time fused gradient kernel matching runtime 1d 
+//          size, Nr, starting search at N
+// ARGS   : Nr  : runtime 1d size
+//          ndim: problem dimension (2 or 3)
+//          rest: see tp_grad
+// RETURNS: TRUE if a kernel was applied; else FALSE, and du is not set
+//**********************************************************************************
+template<typename T, GINT N>
+GBOOL tp_grad_dispatch(GSIZET Nr, GINT ndim, const T * const *D, const T *u, GSIZET Ne,
+                       GTPMetric mtype, const T * const *G, GINT nout, T * const *du)
+{
+  if constexpr ( N > GTPDERIV_MAXORDER+1 ) {
+    return FALSE; // unsupported order
+  }
+  else {
+    if ( Nr != N ) {
+      return tp_grad_dispatch<T,N+1>(Nr, ndim, D, u, Ne, mtype, G, nout, du);
+    }
+    else if ( ndim == 2 ) {
+      tp_grad<T,N,2>(D, u, Ne, mtype, G, nout, du);
+    }
+    else {
+      tp_grad<T,N,3>(D, u, Ne, mtype, G, nout, du);
+    }
+  }
+
+  return TRUE;
+
+} // end, method tp_grad_dispatch
+
+
+//**********************************************************************************
+//**********************************************************************************
+// METHOD : tp_helm_dispatch
+// DESC   : Find compile-time fused Helmholtz kernel matching runtime 1d 
+//          size, Nr, starting search at N
+// ARGS   : Nr  : runtime 1d size
+//          ndim: problem dimension (2 or 3)
+//          rest: see tp_helm
+// RETURNS: TRUE if a kernel was applied; else FALSE, and uo is not set
+//**********************************************************************************
+template<typename T, GINT N>
+GBOOL tp_helm_dispatch(GSIZET Nr, GINT ndim, const T * const *D, const T * const *DT, 
+                       const T *u, GSIZET Ne, const T * const *G, const T *mass, 
+                       const T *p, T pfact, const T *q, T qfact, T *uo)
+{
+  if constexpr ( N > GTPDERIV_MAXORDER+1 ) {
+    return FALSE; // unsupported order
+  }
+  else {
+    if ( Nr != N ) {
+      return tp_helm_dispatch<T,N+1>(Nr, ndim, D, DT, u, Ne, G, mass, p, pfact, q, qfact, uo);
+    }
+    else if ( ndim == 2 ) {
+      tp_helm<T,N,2>(D, DT, u, Ne, G, mass, p, pfact, q, qfact, uo);
+    }
+    else {
+      tp_helm<T,N,3>(D, DT, u, Ne, G, mass, p, pfact, q, qfact, uo);
+    }
+  }
+  return TRUE;
+
+} // end, method tp_helm_dispatch
+
+
+//**********************************************************************************
+//**********************************************************************************
+// METHOD : I2_X_D1
+// DESC   : Apply tensor product operator to Ne elements:
+//            y = I2 X D1 u
+// ARGS   : D1  : 1-direction (dense) operator
+//          u   : operand vector consisting of Ne 'elements'
+//                each of size N1 X N2
+//          N1-2: element dimensions; must be equal
+//          Ne  : number of 'elements' in u
+//          y   : return vector result
+// RETURNS: TRUE on success; FALSE if sizes are unsupported (see
+//          supported), in which case y is not set, and caller must 
+//          use a general kernel
+//**********************************************************************************
+template<typename T>
+GBOOL I2_X_D1(GTMatrix<T> &D1, GTVector<T> &u,
+             GSIZET N1, GSIZET N2, GSIZET Ne, GTVector<T> &y)
+{
+  GEOFLOW_TRACE();
+  if ( !(N1 == N2 && supported(N1)) ) return FALSE;
+  ASSERT_MSG((u.size() >= N1*N2*Ne && y.size() >= N1*N2*Ne), "GTPDeriv::I2_X_D1 incompatible size");
+
+  return tp_dispatch<T,2>(N1, GTP_D1, 2, D1.data().data(), u.data(), Ne, y.data());
+
+} // end of method I2_X_D1
+
+
+//**********************************************************************************
+//**********************************************************************************
+// METHOD : D2_X_I1
+// DESC   : Apply tensor product operator to Ne elements:
+//            y = D2 X I1 u
+// ARGS   : D2T : 2-direction (dense) operator transpose
+//          u   : operand vector consisting of Ne 'elements'
+//                each of size N1 X N2
+//          N1-2: element dimensions; must be equal
+//          Ne  : number of 'elements' in u
+//          y   : return vector result
+// RETURNS: TRUE on success; FALSE if sizes are unsupported (see
+//          supported), in which case y is not set, and caller must 
+//          use a general kernel
+//**********************************************************************************
+template<typename T>
+GBOOL D2_X_I1(GTMatrix<T> &D2T, GTVector<T> &u,
+             GSIZET N1, GSIZET N2, GSIZET Ne, GTVector<T> &y)
+{
+  GEOFLOW_TRACE();
+  if ( !(N1 == N2 && supported(N1)) ) return FALSE;
+  ASSERT_MSG((u.size() >= N1*N2*Ne && y.size() >= N1*N2*Ne), "GTPDeriv::D2_X_I1 incompatible size");
+
+  return tp_dispatch<T,2>(N1, GTP_D2, 2, D2T.data().data(), u.data(), Ne, y.data());
+
+} // end of method D2_X_I1
+
+
+//**********************************************************************************
+//**********************************************************************************
+// METHOD : I3_X_I2_X_D1
+// DESC   : Apply tensor product operator to Ne elements:
+//            y = I3 X I2 X D1 u
+// ARGS   : D1    : 1-direction (dense) operator
+//          u     : operand vector consisting of Ne 'elements'
+//                  each of size N1 X N2 X N3
+//          N1-N3 : element dimensions; must be equal
+//          Ne    : number of 'elements' in u
+//          y     : return vector result
+// RETURNS: TRUE on success; FALSE if sizes are unsupported (see
+//          supported), in which case y is not set, and caller must 
+//          use a general kernel
+//**********************************************************************************
+template<typename T>
+GBOOL I3_X_I2_X_D1(GTMatrix<T> &D1, GTVector<T> &u,
+                  GSIZET N1, GSIZET N2, GSIZET N3, GSIZET Ne, GTVector<T> &y)
+{
+  GEOFLOW_TRACE();
+  if ( !(N1 == N2 && N1 == N3 && supported(N1)) ) return FALSE;
+  ASSERT_MSG((u.size() >= N1*N2*N3*Ne && y.size() >= N1*N2*N3*Ne), "GTPDeriv::I3_X_I2_X_D1 incompatible size");
+
+  return tp_dispatch<T,2>(N1, GTP_D1, 3, D1.data().data(), u.data(), Ne, y.data());
+
+} // end of method I3_X_I2_X_D1
+
+
+//**********************************************************************************
+//**********************************************************************************
+// METHOD : I3_X_D2_X_I1
+// DESC   : Apply tensor product operator to Ne elements:
+//            y = I3 X D2 X I1 u
+// ARGS   : D2T   : 2-direction (dense) operator transpose
+//          u     : operand vector consisting of Ne 'elements'
+//                  each of size N1 X N2 X N3
+//          N1-N3 : element dimensions; must be equal
+//          Ne    : number of 'elements' in u
+//          y     : return vector result
+// RETURNS: TRUE on success; FALSE if sizes are unsupported (see
+//          supported), in which case y is not set, and caller must 
+//          use a general kernel
+//**********************************************************************************
+template<typename T>
+GBOOL I3_X_D2_X_I1(GTMatrix<T> &D2T, GTVector<T> &u,
+                  GSIZET N1, GSIZET N2, GSIZET N3, GSIZET Ne, GTVector<T> &y)
+{
+  GEOFLOW_TRACE();
+  if ( !(N1 == N2 && N1 == N3 && supported(N1)) ) return FALSE;
+  ASSERT_MSG((u.size() >= N1*N2*N3*Ne && y.size() >= N1*N2*N3*Ne), "GTPDeriv::I3_X_D2_X_I1 incompatible size");
+
+  return tp_dispatch<T,2>(N1, GTP_D2, 3, D2T.data().data(), u.data(), Ne, y.data());
+
+} // end of method I3_X_D2_X_I1
+
+
+//**********************************************************************************
+//**********************************************************************************
+// METHOD : D3_X_I2_X_I1
+// DESC   : Apply tensor product operator to Ne elements:
+//            y = D3 X I2 X I1 u
+// ARGS   : D3T   : 3-direction (dense) operator transpose
+//          u     : operand vector consisting of Ne 'elements'
+//                  each of size N1 X N2 X N3
+//          N1-N3 : element dimensions; must be equal
+//          Ne    : number of 'elements' in u
+//          y     : return vector result
+// RETURNS: TRUE on success; FALSE if sizes are unsupported (see
+//          supported), in which case y is not set, and caller must 
+//          use a general kernel
+//**********************************************************************************
+template<typename T>
+GBOOL D3_X_I2_X_I1(GTMatrix<T> &D3T, GTVector<T> &u,
+                  GSIZET N1, GSIZET N2, GSIZET N3, GSIZET Ne, GTVector<T> &y)
+{
+  GEOFLOW_TRACE();
+  if ( !(N1 == N2 && N1 == N3 && supported(N1)) ) return FALSE;
+  ASSERT_MSG((u.size() >= N1*N2*N3*Ne && y.size() >= N1*N2*N3*Ne), "GTPDeriv::D3_X_I2_X_I1 incompatible size");
+
+  return tp_dispatch<T,2>(N1, GTP_D3, 3, D3T.data().data(), u.data(), Ne, y.data());
+
+} // end of method D3_X_I2_X_I1
+
+
+//**********************************************************************************
+//**********************************************************************************
+// METHOD : grad
+// DESC   : Compute fused gradient of u over Ne elements of constant,
+//          isotropic 1d size, N. Problem dimension is taken from D.size().
+//          See tp_grad for metric options.
+// ARGS   : D    : 1d operators, {D1, D2T (, D3T)}
+//          u    : operand vector
+//          N    : 1d element size
+//          Ne   : number of elements
+//          mtype: metric type
+//          G    : metric vectors (see tp_grad); may be empty for
+//                 GTP_NOMETRIC
+//          du   : output vectors; number of components is du.size()
+//                 for GTP_FULLMETRIC, else D.size()
+// RETURNS: TRUE on success; FALSE if N or D.size() are unsupported,
+//          in which case du is not set, and caller must use a 
+//          general kernel
+//**********************************************************************************
+template<typename T>
+GBOOL grad(GTVector<GTMatrix<T>*> &D, GTVector<T> &u, 
+          GSIZET N, GSIZET Ne, GTPMetric mtype, 
+          GTVector<GTVector<T>*> &G, GTVector<GTVector<T>*> &du)
+{
+  GEOFLOW_TRACE();
+  GINT ndim = D.size();
+  GINT nout = mtype == GTP_FULLMETRIC ? du.size() : ndim;
+  GINT ng   = mtype == GTP_FULLMETRIC ? ndim*nout
+            : (mtype == GTP_DIAGMETRIC ? ndim : 0);
+  T   *pd  [GDIM+1];
+  T   *pdu [GDIM+1];
+  T   *pg  [(GDIM+1)*(GDIM+1)];
+
+  if ( !((ndim == 2 || ndim == 3) && supported(N)) ) return FALSE;
+  if ( mtype != GTP_NOMETRIC && mtype != GTP_DIAGMETRIC 
+    && mtype != GTP_FULLMETRIC ) return FALSE;
+  assert(du.size() >= nout && G.size() >= ng && nout <= GDIM+1 && "Insufficient data");
+
+  for ( auto k=0; k<ndim; k++ ) pd [k] = D [k]->data().data();
+  for ( auto k=0; k<nout; k++ ) pdu[k] = du[k]->data();
+  for ( auto k=0; k<ng  ; k++ ) pg [k] = G [k]->data();
+
+  return tp_grad_dispatch<T,2>(N, ndim, pd, u.data(), Ne, mtype, pg, nout, pdu);
+
+} // end of method grad
+
+
+//**********************************************************************************
+//**********************************************************************************
+// METHOD : helm
+// DESC   : Apply fused Helmholtz operator (see tp_helm) to Ne elements of
+//          constant, isotropic 1d size, N, starting at global index ibeg. 
+//          Problem dimension is taken from D.size().
+// ARGS   : D    : 1d operators, {D1, D2T (, D3T)}
+//          DT   : 1d transpose operators, {D1T, D2 (, D3)}
+//          u    : operand vector
+//          N    : 1d element size
+//          Ne   : number of elements
+//          ibeg : global index of first node of first element; applies 
+//                 to all vector arguments
+//          G    : diagonal metric vectors, one for each direction; 
+//                 may be empty, if no metric is to be applied
+//          mass : mass vector, including Jacobian
+//          p    : variable Laplacian factor; NULLPTR if none
+//          pfact: constant Laplacian factor
+//          q    : variable mass factor; NULLPTR if none
+//          qfact: constant mass factor
+//          uo   : output vector
+// RETURNS: TRUE on success; FALSE if N or D.size() are unsupported,
+//          in which case uo is not set, and caller must use a 
+//          general kernel
+//**********************************************************************************
+template<typename T>
+GBOOL helm(GTVector<GTMatrix<T>*> &D, GTVector<GTMatrix<T>*> &DT,
+          GTVector<T> &u, GSIZET N, GSIZET Ne, GSIZET ibeg,
+          GTVector<GTVector<T>*> &G, GTVector<T> &mass,
+          GTVector<T> *p, T pfact, GTVector<T> *q, T qfact,
+          GTVector<T> &uo)
+{
+  GEOFLOW_TRACE();
+  GINT ndim = D.size();
+  T   *pd  [3];
+  T   *pdt [3];
+  T   *pg  [3];
+
+  if ( !((ndim == 2 || ndim == 3) && supported(N)) ) return FALSE;
+  assert(DT.size() >= ndim && (G.size() == 0 || G.size() >= ndim) && "Insufficient data");
+  for ( auto k=0; k<ndim; k++ ) {
+    pd [k] = D [k]->data().data();
+    pdt[k] = DT[k]->data().data();
+  }
+  for ( auto k=0; k<G.size() && k<ndim; k++ ) pg[k] = G[k]->data() + ibeg;
+  return tp_helm_dispatch<T,2>(N, ndim, pd, pdt, u.data()+ibeg, Ne, 
+                               G.size() > 0 ? pg : NULLPTR, mass.data()+ibeg,
+                               p != NULLPTR ? p->data()+ibeg : NULLPTR, pfact,
+                               q != NULLPTR ? q->data()+ibeg : NULLPTR, qfact,
+                               uo.data()+ibeg);
+
+} // end of method helm
+
+
+} // end, namespace GTPDeriv
+
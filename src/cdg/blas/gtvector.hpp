@@ -25,6 +25,7 @@
 #include <vector>
 
 #include "gtypes.h"
+#include "gexec.h"
 #include "gindex.hpp"
 #include "cff_blas.h"
 #include "gcomm.hpp"
@@ -277,7 +277,7 @@ GTVector<T>::~GTVector()
 {
   GEOFLOW_TRACE();
 #if defined(GEOFLOW_USE_CUBLAS)
-    cudaFree(data_);
+  if ( data_  != NULLPTR  && bdatalocal_ ) cudaFree(data_);
 #else
   if ( data_  != NULLPTR  && bdatalocal_ ) delete [] data_;
 #endif
@@ -796,6 +796,7 @@ template<class T>
 void GTVector<T>::operator=(T a)
 {
   GEOFLOW_TRACE();
+  GEXEC_PARALLEL_FOR(this->size())
   for ( auto j=gindex_.beg(); j<=gindex_.end(); j+=gindex_.stride() ) {
     data_[j] = a;
   }
@@ -861,6 +862,7 @@ template<class T>
 void GTVector<T>::set(T a)
 { 
   GEOFLOW_TRACE();
+  GEXEC_PARALLEL_FOR(this->size())
   for ( auto j=gindex_.beg(); j<=gindex_.end(); j+=gindex_.stride() ) {
     data_[j] = a;
   }
@@ -1087,6 +1089,7 @@ T GTVector<T>::dot(const GTVector &obj)
     "Invalid template type: GVector<T>::dot()");
 
   T ret = 0;
+  GEXEC_PARALLEL_FOR_REDUCE(this->size(),(+:ret))
   for ( auto j=this->gindex_.beg(); j<=this->gindex_.end(); j+=this->gindex_.stride() ) {
     ret += this->data_[j] * obj[j];
   }
@@ -1142,6 +1145,7 @@ T GTVector<T>::gdot(const GTVector &b, const GTVector &c, GC_COMM comm)
   T lret=0.0; 
   T gret;
 
+  GEXEC_PARALLEL_FOR_REDUCE(this->size(),(+:lret))
   for ( auto j=gindex_.beg(); j<=gindex_.end(); j+=gindex_.stride() ) {
     lret += data_[j]*b[j]*c[j];
   }
@@ -1165,6 +1169,7 @@ void
 GTVector<T>::operator+=(const T b)
 {
   GEOFLOW_TRACE();
+  GEXEC_PARALLEL_FOR(this->size())
   for ( auto j=this->gindex_.beg(); j<=this->gindex_.end(); j+=this->gindex_.stride() ) {
     this->data_[j] += b;
   }
@@ -1187,6 +1192,7 @@ void
 GTVector<T>::operator-=(const T b)
 {
   GEOFLOW_TRACE();
+  GEXEC_PARALLEL_FOR(this->size())
   for ( auto j=this->gindex_.beg(); j<=this->gindex_.end(); j+=this->gindex_.stride() ) {
     this->data_[j] -= b;
   }
@@ -1209,6 +1215,7 @@ void
 GTVector<T>::operator*=(const T b)
 {
   GEOFLOW_TRACE();
+  GEXEC_PARALLEL_FOR(this->size())
   for ( auto j=this->gindex_.beg(); j<=this->gindex_.end(); j+=this->gindex_.stride() ) {
     this->data_[j] *= b;
   }
@@ -1234,11 +1241,13 @@ GTVector<T>::operator+=(const GTVector &obj)
 {
   GEOFLOW_TRACE();
   if ( obj.size() > 1 ) {
+    GEXEC_PARALLEL_FOR(this->size())
     for ( auto j=this->gindex_.beg(); j<=this->gindex_.end(); j+=this->gindex_.stride() ) {
       this->data_[j] += obj[j-this->gindex_.beg()];
     }
   }
   else {
+    GEXEC_PARALLEL_FOR(this->size())
     for ( auto j=this->gindex_.beg(); j<=this->gindex_.end(); j+=this->gindex_.stride() ) {
       this->data_[j] += obj[0];
     }
@@ -1265,11 +1274,13 @@ GTVector<T>::operator-=(const GTVector &obj)
 {
   GEOFLOW_TRACE();
   if ( obj.size() > 1 ) {
+    GEXEC_PARALLEL_FOR(this->size())
     for ( auto j=this->gindex_.beg(); j<=this->gindex_.end(); j+=this->gindex_.stride() ) {
       this->data_[j] -= obj[j-this->gindex_.beg()];
     }
   }
   else {
+    GEXEC_PARALLEL_FOR(this->size())
     for ( auto j=this->gindex_.beg(); j<=this->gindex_.end(); j+=this->gindex_.stride() ) {
       this->data_[j] -= obj[0];
     }
@@ -1296,11 +1307,13 @@ GTVector<T>::operator*=(const GTVector &obj)
 {
   GEOFLOW_TRACE();
   if ( obj.size() > 1 ) {
+    GEXEC_PARALLEL_FOR(this->size())
     for ( auto j=this->gindex_.beg(); j<=this->gindex_.end(); j+=this->gindex_.stride() ) {
       this->data_[j] *= obj[j-this->gindex_.beg()];
     }
   }
   else {
+    GEXEC_PARALLEL_FOR(this->size())
     for ( auto j=this->gindex_.beg(); j<=this->gindex_.end(); j+=this->gindex_.stride() ) {
       this->data_[j] *= obj[0];
     }
@@ -1326,11 +1339,13 @@ GTVector<T>::operator/=(const GTVector &obj)
 {
   GEOFLOW_TRACE();
   if ( obj.size() > 1 ) {
+    GEXEC_PARALLEL_FOR(this->size())
     for ( auto j=this->gindex_.beg(); j<=this->gindex_.end(); j+=this->gindex_.stride() ) {
       this->data_[j] /= obj[j-this->gindex_.beg()];
     }
   }
   else {
+    GEXEC_PARALLEL_FOR(this->size())
     for ( auto j=this->gindex_.beg(); j<=this->gindex_.end(); j+=this->gindex_.stride() ) {
       this->data_[j] /= obj[0];
     }
@@ -1660,13 +1675,21 @@ GTVector<T>::pointProd(const GTVector<T> &obj, GTVector<T> &ret )
   ASSERT(!( (obj.size() > 1 && obj.size() < this->size()) || ret.size() < this->size() ));
 
   if ( obj.size() > 1 ) {
+#if defined(GEOFLOW_USE_OPENACC)
 #pragma acc parallel loop
+#else
+    GEXEC_PARALLEL_FOR(this->size())
+#endif
     for ( auto j=this->gindex_.beg(); j<=this->gindex_.end(); j+=this->gindex_.stride() ) {
       ret[j] = this->data_[j-gindex_.beg()] * obj[j-gindex_.beg()];
     }
   }
   else {
+#if defined(GEOFLOW_USE_OPENACC)
 #pragma acc parallel loop
+#else
+    GEXEC_PARALLEL_FOR(this->size())
+#endif
     for ( auto j=this->gindex_.beg(); j<=this->gindex_.end(); j+=this->gindex_.stride() ) {
       ret[j] = this->data_[j-gindex_.beg()] * obj[0];
     }
@@ -1694,13 +1717,21 @@ GTVector<T>::pointProd(const T a, const GTVector<T> &obj, GTVector<T> &ret )
   ASSERT( (ret.size() >= this->size()) && (obj.size() >= this->size()) );
 
   if ( obj.size() > 1 ) {
+#if defined(GEOFLOW_USE_OPENACC)
 #pragma acc parallel loop
+#else
+    GEXEC_PARALLEL_FOR(this->size())
+#endif
     for ( auto j=this->gindex_.beg(); j<=this->gindex_.end(); j+=this->gindex_.stride() ) {
       ret[j] = a * this->data_[j-gindex_.beg()] * obj[j-gindex_.beg()];
     }
   }
   else {
+#if defined(GEOFLOW_USE_OPENACC)
 #pragma acc parallel loop
+#else
+    GEXEC_PARALLEL_FOR(this->size())
+#endif
     for ( auto j=this->gindex_.beg(); j<=this->gindex_.end(); j+=this->gindex_.stride() ) {
       ret[j] = a * this->data_[j-gindex_.beg()] * obj[0];
     }
@@ -1727,13 +1758,21 @@ GTVector<T>::pointProd(const GTVector<T> &obj)
 
   if ( obj.size() > 1 ) {
 
+#if defined(GEOFLOW_USE_OPENACC)
 #pragma acc parallel loop
+#else
+    GEXEC_PARALLEL_FOR(this->size())
+#endif
     for ( auto j=this->gindex_.beg(); j<=this->gindex_.end(); j+=this->gindex_.stride() ) {
       data_[j] *= obj[j-gindex_.beg()];
     }
   }
   else {
+#if defined(GEOFLOW_USE_OPENACC)
 #pragma acc parallel loop
+#else
+    GEXEC_PARALLEL_FOR(this->size())
+#endif
     for ( auto j=this->gindex_.beg(); j<=this->gindex_.end(); j+=this->gindex_.stride() ) {
       data_[j] *= obj[0];
     }
@@ -1760,11 +1799,13 @@ GTVector<T>::apointProd(const T a, const GTVector<T> &obj )
   ASSERT(!( (obj.size() != this->size()) && obj.size() != 1 ));
 
   if ( obj.size() > 1 ) {
+    GEXEC_PARALLEL_FOR(this->size())
     for ( auto j=this->gindex_.beg(); j<=this->gindex_.end(); j+=this->gindex_.stride() ) {
       (*this)[j] *= a * obj[j];
     }
   }
   else {
+    GEXEC_PARALLEL_FOR(this->size())
     for ( auto j=this->gindex_.beg(); j<=this->gindex_.end(); j+=this->gindex_.stride() ) {
       (*this)[j] *= a * obj[0];
     }
@@ -1790,6 +1831,7 @@ GTVector<T>::constProd(const T b, GTVector<T> &ret)
 
   T *dret=ret.data();
 
+  GEXEC_PARALLEL_FOR(this->size())
   for ( auto j=this->gindex_.beg(); j<=this->gindex_.end(); j+=this->gindex_.stride() ) {
     dret[j] = this->data_[j] * b;
   }
@@ -1834,6 +1876,7 @@ GTVector<T>::sum()
   GEOFLOW_TRACE();
   T      sum=static_cast<T>(0);
 
+  GEXEC_PARALLEL_FOR_REDUCE(this->size(),(+:sum))
   for ( auto j=this->gindex_.beg(); j<=this->gindex_.end(); j+=this->gindex_.stride() ) {
     sum +=  this->data_[j];
   }
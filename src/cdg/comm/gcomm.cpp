@@ -504,6 +504,64 @@ GINT  GComm::Allreduce(void  *operand, void *result, const GINT  count, GCommDat
 } // end of method Allreduce
 
 
+//**********************************************************************************
+//**********************************************************************************
+// METHOD     : IAllreduce
+// DESC       : Posts non-blocking reduction; result may not be
+//              used until hreq has been waited on (see Wait)
+// ARGS       : operand: local data; must not be modified until wait
+//              result : reduced data
+//              count  : no. items in operand, result
+//              itype  : data type
+//              iop    : reduction op
+//              hreq   : handle for posted reduction, returned
+//              comm   : communicator
+// RETURNS    : TRUE on success; else FALSE
+//**********************************************************************************
+GBOOL GComm::IAllreduce(void  *operand, void *result, const GINT  count, GCommDatatype itype, GC_OP iop, GCReqHandle *hreq, GC_COMM comm)
+{
+
+#if defined(GEOFLOW_USE_MPI)
+  GINT iret;
+
+  iret = MPI_Iallreduce(operand, result, count, itype, GC_Optype[iop], comm, hreq);
+
+  return iret == MPI_SUCCESS ? TRUE : FALSE;
+#else
+  GD_DATATYPE igtype = GCommData2Index(itype);
+  memcpy((GBYTE*)result, (GBYTE*)operand, count*GD_DATATYPE_SZ[igtype]);
+  *hreq = 0;
+
+  return TRUE;
+#endif
+
+} // end of method IAllreduce
+
+
+//**********************************************************************************
+//**********************************************************************************
+// METHOD     : Wait
+// DESC       : Performs blocking wait for non-blocking collectives
+// ARGS       : hreq: array of handles
+//              nreq: no. handles in hreq
+// RETURNS    : TRUE on success; else FALSE
+//**********************************************************************************
+GBOOL GComm::Wait(GCReqHandle *hreq, GINT nreq)
+{
+
+#if defined(GEOFLOW_USE_MPI)
+  GINT iret;
+
+  iret = MPI_Waitall(nreq, hreq, MPI_STATUSES_IGNORE);
+
+  return iret == MPI_SUCCESS ? TRUE : FALSE;
+#else
+  return TRUE;
+#endif
+
+} // end of method Wait
+
+
 //**********************************************************************************
 //**********************************************************************************
 // METHOD     : Allgather
@@ -540,6 +598,81 @@ GINT GComm::Allgather(void *operand, GINT  sendcount, GCommDatatype stype,
 } // end of method Allgather
 
 
+//**********************************************************************************
+//**********************************************************************************
+// METHOD     : Allgatherv
+// DESC       : Performs all-gather operation with variable no. items
+//              from each task
+// ARGS       : operand   : local data
+//              sendcount : no. local items
+//              stype     : local data type
+//              result    : gathered data, ordered by task
+//              recvcounts: no. items from each task
+//              rdispls   : offset in result of data from each task
+//              rtype     : gathered data type
+//              comm      : communicator
+// RETURNS    : MPI return code
+//**********************************************************************************
+GINT GComm::Allgatherv(void *operand, GINT  sendcount, GCommDatatype stype, 
+                       void *result , GINT *recvcounts, GINT *rdispls, GCommDatatype rtype, GC_COMM comm)
+{
+
+  GINT    iret=sendcount, rank=GComm::WorldRank(comm);
+
+#if defined(GEOFLOW_USE_MPI)
+  iret = MPI_Allgatherv(operand, sendcount, stype, result, recvcounts, rdispls, rtype, comm);
+#else
+  if ( recvcounts[rank] < sendcount ) return 0;
+  if ( operand == NULLPTR || result == NULLPTR ) return 0;
+  GD_DATATYPE irtype = GCommData2Index(rtype);
+  GD_DATATYPE istype = GCommData2Index(stype);
+  memcpy((GBYTE*)result+rdispls[rank]*GD_DATATYPE_SZ[irtype], 
+          (GBYTE*)operand  , sendcount*GD_DATATYPE_SZ[istype]);
+#endif
+
+  return iret;
+
+} // end of method Allgatherv
+
+
+//**********************************************************************************
+//**********************************************************************************
+// METHOD     : Alltoallv
+// DESC       : Performs all-to-all exchange with variable no. items
+//              to and from each task
+// ARGS       : operand   : data to send, ordered by destination task
+//              sendcounts: no. items to send to each task
+//              sdispls   : offset in operand of data for each task
+//              stype     : send data type
+//              result    : data received, ordered by source task
+//              recvcounts: no. items to receive from each task
+//              rdispls   : offset in result of data from each task
+//              rtype     : receive data type
+//              comm      : communicator
+// RETURNS    : MPI return code
+//**********************************************************************************
+GINT GComm::Alltoallv(void *operand, GINT *sendcounts, GINT *sdispls, GCommDatatype stype, 
+                      void *result , GINT *recvcounts, GINT *rdispls, GCommDatatype rtype, GC_COMM comm)
+{
+
+  GINT    iret=0, rank=GComm::WorldRank(comm);
+
+#if defined(GEOFLOW_USE_MPI)
+  iret = MPI_Alltoallv(operand, sendcounts, sdispls, stype, result, recvcounts, rdispls, rtype, comm);
+#else
+  if ( recvcounts[rank] < sendcounts[rank] ) return 0;
+  if ( sendcounts[rank] == 0 ) return 0;
+  GD_DATATYPE irtype = GCommData2Index(rtype);
+  GD_DATATYPE istype = GCommData2Index(stype);
+  memcpy((GBYTE*)result +rdispls[rank]*GD_DATATYPE_SZ[irtype], 
+         (GBYTE*)operand+sdispls[rank]*GD_DATATYPE_SZ[istype], sendcounts[rank]*GD_DATATYPE_SZ[istype]);
+#endif
+
+  return iret;
+
+} // end of method Alltoallv
+
+
 //**********************************************************************************
 //**********************************************************************************
 // METHOD     : DataTypeFromStruct
@@ -35,6 +35,13 @@ extern void *grstatus_;
 extern void *gsstatus_;
 #endif
 
+// Handle for a single non-blocking collective:
+#if defined(GEOFLOW_USE_MPI)
+typedef MPI_Request GCReqHandle;
+#else
+typedef GINT        GCReqHandle;
+#endif
+
 
 namespace GComm
 {
@@ -46,7 +53,11 @@ namespace GComm
                        GBOOL    ASendRecv  (void *RecvBuff, GINT nRecvBuff, GINT  *irecv, GINT RecvLen   , GCommDatatype rtype, GINT *source, GBOOL bUseSource, 
                                             void *SendBuff, GINT nSendBuff, GINT  *isend, GINT maxSendLen, GCommDatatype stype, GINT *dest, GC_COMM icomm=GC_COMM_WORLD   );
                        GINT Allreduce  (void *, void *, const GINT  count, GCommDatatype type, GC_OP op, GC_COMM icomm=GC_COMM_WORLD);
+                       GBOOL    IAllreduce (void *, void *, const GINT  count, GCommDatatype type, GC_OP op, GCReqHandle *hreq, GC_COMM icomm=GC_COMM_WORLD);
+                       GBOOL    Wait       (GCReqHandle *hreq, GINT nreq);
                        GINT Allgather  (void *operand, GINT  sendcount, GCommDatatype stype, void *result, GINT  recvcount, GCommDatatype gtype, GC_COMM icomm=GC_COMM_WORLD);
+                       GINT Allgatherv (void *operand, GINT  sendcount, GCommDatatype stype, void *result, GINT *recvcounts, GINT *rdispls, GCommDatatype gtype, GC_COMM icomm=GC_COMM_WORLD);
+                       GINT Alltoallv  (void *operand, GINT *sendcounts, GINT *sdispls, GCommDatatype stype, void *result, GINT *recvcounts, GINT *rdispls, GCommDatatype gtype, GC_COMM icomm=GC_COMM_WORLD);
 
                        GBOOL    BSend      (void *sbuff, GINT  buffcount, GCommDatatype stype, GINT dest, GC_COMM icomm=GC_COMM_WORLD  );
                        GBOOL    ISend      (void *sbuff, GINT  buffcount, GCommDatatype stype, GINT dest, void *hreq, GC_COMM icomm=GC_COMM_WORLD);
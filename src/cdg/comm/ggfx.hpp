@@ -12,12 +12,14 @@
 #define GGFX_HPP
 
 #include <array>
+#include <chrono>
 #include <boost/serialization/utility.hpp>
 #include <boost/serialization/vector.hpp>
 #include <limits>
 #include <map>
 #include <numeric>
 #include <set>
+#include <type_traits>
 #include <vector>
 
 #include "boost/mpi.hpp"
@@ -43,6 +45,12 @@ class GGFX {
                 return std::max(a, b);
             });
         }
+        template <typename V>
+        static constexpr V init() { return std::numeric_limits<V>::lowest(); }
+        template <typename V>
+        static V combine(const V a, const V b) { return std::max(a, b); }
+        template <typename V>
+        static V finalize(const V a, const std::size_t) { return a; }
     };
 
     struct Min {
@@ -55,6 +63,12 @@ class GGFX {
                 return std::min(a, b);
             });
         }
+        template <typename V>
+        static constexpr V init() { return std::numeric_limits<V>::max(); }
+        template <typename V>
+        static V combine(const V a, const V b) { return std::min(a, b); }
+        template <typename V>
+        static V finalize(const V a, const std::size_t) { return a; }
     };
 
     struct Smooth {
@@ -64,6 +78,12 @@ class GGFX {
             using value_type = typename VectorType::value_type;
             return std::accumulate(vec.begin(), vec.end(), value_type(0)) / vec.size();
         }
+        template <typename V>
+        static constexpr V init() { return V(0); }
+        template <typename V>
+        static V combine(const V a, const V b) { return a + b; }
+        template <typename V>
+        static V finalize(const V a, const std::size_t n) { return a / n; }
     };
 
     struct Sum {
@@ -73,6 +93,12 @@ class GGFX {
             using value_type = typename VectorType::value_type;
             return std::accumulate(vec.begin(), vec.end(), value_type(0));
         }
+        template <typename V>
+        static constexpr V init() { return V(0); }
+        template <typename V>
+        static V combine(const V a, const V b) { return a + b; }
+        template <typename V>
+        static V finalize(const V a, const std::size_t) { return a; }
     };
 
    public:
@@ -89,6 +115,18 @@ class GGFX {
     template <typename ValueArray, typename ReductionOp>
     GBOOL doOp(ValueArray& u, ReductionOp op);
 
+    template <typename ValueArray, typename ReductionOp>
+    GBOOL doOp_begin(ValueArray& u, ReductionOp op);
+
+    template <typename ValueArray>
+    GBOOL doOp_end(ValueArray& u);
+
+    template <typename ValueArray, typename ReductionOp>
+    GBOOL doOp(GTVector<ValueArray*>& u, ReductionOp op);
+
+    template <typename ValueArray, typename ReductionOp>
+    GBOOL doOp(GTVector<ValueArray*>& u, const std::size_t nfields, ReductionOp op);
+
     GC_COMM getComm() const;
 
     template <typename CountArray>
@@ -97,8 +135,16 @@ class GGFX {
     template <typename CountArray>
     void get_imult(CountArray& imult) const;
 
+    template <typename FlagArray>
+    void get_remote_flags(FlagArray& flags) const;
+
     void display() const;
 
+    // Wall time spent waiting for remote values, accumulated
+    // over all exchanges since construction or the last reset
+    double wait_time() const { return wait_time_; }
+    void reset_wait_time() { wait_time_ = 0.0; }
+
 	static constexpr std::size_t NDIM = 3;
 
    private:
@@ -106,13 +152,44 @@ class GGFX {
     using size_type = std::size_t;
     using value_type = ValueType;
     size_type max_duplicates_;
+    size_type num_local_;  // # local nodes given to init
+
+    // Exchange plan, compiled by init into flat (CSR) arrays:
+    std::vector<rank_type> send_ranks_;   // [1:Nsend_ranks] = Rank to send to
+    std::vector<size_type> send_ptr_;     // [1:Nsend_ranks+1] = Offset into send_ids_/send_buffer_
+    std::vector<size_type> send_ids_;     // [1:Nsend] = Local index to send
+    std::vector<rank_type> recv_ranks_;   // [1:Nrecv_ranks] = Rank to receive from
+    std::vector<size_type> recv_ptr_;     // [1:Nrecv_ranks+1] = Offset into recv_buffer_
+    std::vector<size_type> shared_ids_;   // [1:Nshared] = Local index with multiplicity > 1
+    std::vector<size_type> local_ptr_;    // [1:Nshared+1] = Offset into local_ids_
+    std::vector<size_type> local_ids_;    // [1:Nlocal_contrib] = Local index contributing
+    std::vector<size_type> remote_ptr_;   // [1:Nshared+1] = Offset into remote_ids_
+    std::vector<size_type> remote_ids_;   // [1:Nremote_contrib] = Index into recv_buffer_ contributing
+
+    std::vector<value_type> send_buffer_;    // [1:Nsend*Nfields] = Value sending
+    std::vector<value_type> recv_buffer_;    // [1:Nrecv*Nfields] = Value received
+    std::vector<value_type> result_buffer_;  // [1:Nshared] = Reduced value
+    std::vector<value_type> dup_buffer_;     // [1:Nreduce] = Values for generic reduction op
+
+    std::vector<boost::mpi::request> recv_requests_;  // [1:Nrecv_ranks] = Pending receives
+    std::vector<boost::mpi::request> send_requests_;  // [1:Nsend_ranks] = Pending sends
+    const void* pending_u_ = nullptr;                 // Array being reduced by doOp_begin/end
+    int pending_op_ = 0;                              // Reduction op tag (see op_tag_) for doOp_end
+    double wait_time_ = 0.0;                          // Accumulated time in wait_recv_
+
+    void wait_recv_();
+
+    template <typename ReductionOp>
+    static constexpr int op_tag_();
+
+    template <typename ValueArray>
+    void start_(ValueArray& u);
 
-    std::map<rank_type, std::set<size_type>> send_map_;                       // [Rank][1:Nsend] = Local Index
-    std::map<rank_type, std::map<size_type, std::set<size_type>>> recv_map_;  // [Rank][1:Nrecv][1:Nshare] = Local Index
+    template <typename ValueArray, typename ReductionOp>
+    void finish_(ValueArray& u, ReductionOp op);
 
-    std::map<rank_type, std::vector<value_type>> send_buffer_;  // [Rank][1:Nsend] = Value sending
-    std::map<rank_type, std::vector<value_type>> recv_buffer_;  // [Rank][1:Nrecv] = Value received
-    std::vector<std::vector<value_type>> reduction_buffer_;     // [1:Nlocal][1:Nreduce] = Value to reduce
+    template <typename ValueArray, typename ReductionOp>
+    void reduce_(ValueArray& u, ReductionOp op, const value_type* recv, const size_type stride);
 
     size_type get_max_mult_() const;
 };
@@ -126,23 +203,27 @@ void GGFX<T>::display() const {
     auto num_ranks = world.size();
     for (auto rank = 0; rank < num_ranks; ++rank) {
         if (my_rank == rank) {
-            pio::plog << "send_map_.size() = " << send_map_.size() << std::endl;
-            for (auto& [srank, vec] : send_map_) {
-                pio::plog << "  Sending to rank " << srank << " # nodes = " << vec.size() << std::endl;
-                for (auto& nid : vec) {
-                    pio::plog << " " << nid;
+            pio::plog << "send_ranks_.size() = " << send_ranks_.size() << std::endl;
+            for (size_type r = 0; r < send_ranks_.size(); ++r) {
+                pio::plog << "  Sending to rank " << send_ranks_[r] << " # nodes = " << send_ptr_[r + 1] - send_ptr_[r] << std::endl;
+                for (auto i = send_ptr_[r]; i < send_ptr_[r + 1]; ++i) {
+                    pio::plog << " " << send_ids_[i];
                 }
                 pio::plog << std::endl;
             }
-            pio::plog << "recv_map_.size() = " << recv_map_.size() << std::endl;
-            for (auto& [rrank, vec] : recv_map_) {
-                pio::plog << "  Receiving from rank " << rrank << " # nodes = " << vec.size() << std::endl;
-                for (auto& [remote_id, local_ids] : vec) {
-                    pio::plog << "  " << remote_id << " --> ";
-                    for (auto& local_id : local_ids) {
-                        pio::plog << " " << local_id;
-                    }
-                    pio::plog << std::endl;
+            pio::plog << "recv_ranks_.size() = " << recv_ranks_.size() << std::endl;
+            for (size_type r = 0; r < recv_ranks_.size(); ++r) {
+                pio::plog << "  Receiving from rank " << recv_ranks_[r] << " # nodes = " << recv_ptr_[r + 1] - recv_ptr_[r] << std::endl;
+            }
+            pio::plog << "shared_ids_.size() = " << shared_ids_.size() << std::endl;
+            for (size_type k = 0; k < shared_ids_.size(); ++k) {
+                pio::plog << "  " << shared_ids_[k] << " <-- ";
+                for (auto j = local_ptr_[k]; j < local_ptr_[k + 1]; ++j) {
+                    pio::plog << " " << local_ids_[j];
+                }
+                pio::plog << " |";
+                for (auto j = remote_ptr_[k]; j < remote_ptr_[k + 1]; ++j) {
+                    pio::plog << " r" << remote_ids_[j];
                 }
                 pio::plog << std::endl;
             }
@@ -164,12 +245,28 @@ struct pair_extractor {
 };
 }  // namespace detail_extractor
 
+namespace detail_ggfx {
+// Reduction ops providing init/combine/finalize may be applied
+// directly, without gathering duplicate values into a vector
+template <typename Op, typename V, typename = void>
+struct is_streaming_op : std::false_type {};
+
+template <typename Op, typename V>
+struct is_streaming_op<Op, V, std::void_t<decltype(Op::template combine<V>(V(), V()))>>
+    : std::true_type {};
+}  // namespace detail_ggfx
+
 template <typename T>
 template <typename Coordinates>
 GBOOL GGFX<T>::init(const std::size_t max_duplicates, const T tolerance, Coordinates& xyz) {
     GEOFLOW_TRACE();
     using namespace geoflow::tbox;
     max_duplicates_ = max_duplicates;
+    num_local_ = xyz.size();
+
+    // Maps used to build exchange plan
+    std::map<rank_type, std::set<size_type>> send_map;                        // [Rank][1:Nsend] = Local Index
+    std::map<rank_type, std::map<size_type, std::set<size_type>>> recv_map;   // [Rank][1:Nrecv][1:Nshare] = Local Index
 
     // Types
     using index_bound_type = tbox::spatial::bound::Box<value_type, NDIM>;
@@ -221,7 +318,7 @@ GBOOL GGFX<T>::init(const std::size_t max_duplicates, const T tolerance, Coordin
     // - Matching local bounds
     //
     GEOFLOW_TRACE_START("Index Local Nodes");
-    auto& my_rank_recv_map = recv_map_[my_rank];
+    auto& my_rank_recv_map = recv_map[my_rank];
     std::vector<bool> local_already_mapped(local_bounds_by_id.size(), false);
     for (size_type id = 0; id < local_bounds_by_id.size(); ++id) {
         // Search for local mapping if not already found
@@ -311,8 +408,8 @@ GBOOL GGFX<T>::init(const std::size_t max_duplicates, const T tolerance, Coordin
             local_bound_indexer.query(tbox::spatial::shared::predicate::Intersects(remote_bnd), std::back_inserter(search_results));
 
             for (auto& [local_bnd, local_id] : search_results) {
-                send_map_[rank].insert(local_id);
-                recv_map_[rank][remote_id].insert(local_id);
+                send_map[rank].insert(local_id);
+                recv_map[rank][remote_id].insert(local_id);
             }
         }
     }
@@ -321,20 +418,67 @@ GBOOL GGFX<T>::init(const std::size_t max_duplicates, const T tolerance, Coordin
     }
     GEOFLOW_TRACE_STOP();
 
-    GEOFLOW_TRACE_START("Allocate Buffers");
-    // Allocate Buffers for Send/Receive in the future
-    for (auto& [rank, send_ids] : send_map_) {
-        send_buffer_[rank].resize(send_ids.size());
+    GEOFLOW_TRACE_START("Compile Plan");
+    // Flatten send lists
+    send_ranks_.clear();
+    send_ids_.clear();
+    send_ptr_.assign(1, 0);
+    for (auto& [rank, send_ids] : send_map) {
+        send_ranks_.push_back(rank);
+        send_ids_.insert(send_ids_.end(), send_ids.begin(), send_ids.end());
+        send_ptr_.push_back(send_ids_.size());
     }
-    for (auto& [rank, recv_id_pairs] : recv_map_) {
-        recv_buffer_[rank].resize(recv_id_pairs.size());
+
+    // Flatten receive lists, and invert maps to find contributors
+    // to each local node, in the order they are to be reduced
+    std::vector<std::vector<size_type>> local_contrib(num_local_);
+    std::vector<std::vector<size_type>> remote_contrib(num_local_);
+    for (auto& [local_id, local_id_set] : recv_map[my_rank]) {
+        for (auto& id : local_id_set) {
+            local_contrib[id].push_back(local_id);
+        }
+    }
+    recv_ranks_.clear();
+    recv_ptr_.assign(1, 0);
+    for (auto& [rank, remote_local_map] : recv_map) {
+        if (rank != my_rank) {
+            size_type n = recv_ptr_.back();
+            for (auto& [remote_id, local_id_set] : remote_local_map) {
+                for (auto& id : local_id_set) {
+                    remote_contrib[id].push_back(n);
+                }
+                ++n;
+            }
+            recv_ranks_.push_back(rank);
+            recv_ptr_.push_back(n);
+        }
     }
-    reduction_buffer_.resize(xyz.size());
-    for (auto& buf : reduction_buffer_) {
-        buf.reserve(max_duplicates_);
+
+    // Keep only nodes that change under reduction
+    shared_ids_.clear();
+    local_ids_.clear();
+    remote_ids_.clear();
+    local_ptr_.assign(1, 0);
+    remote_ptr_.assign(1, 0);
+    for (size_type id = 0; id < num_local_; ++id) {
+        if (local_contrib[id].size() + remote_contrib[id].size() > 1) {
+            shared_ids_.push_back(id);
+            local_ids_.insert(local_ids_.end(), local_contrib[id].begin(), local_contrib[id].end());
+            remote_ids_.insert(remote_ids_.end(), remote_contrib[id].begin(), remote_contrib[id].end());
+            local_ptr_.push_back(local_ids_.size());
+            remote_ptr_.push_back(remote_ids_.size());
+        }
     }
     GEOFLOW_TRACE_STOP();
 
+    GEOFLOW_TRACE_START("Allocate Buffers");
+    // Allocate Buffers for Send/Receive in the future
+    send_buffer_.resize(send_ids_.size());
+    recv_buffer_.resize(recv_ptr_.back());
+    result_buffer_.resize(shared_ids_.size());
+    dup_buffer_.reserve(max_duplicates_);
+    GEOFLOW_TRACE_STOP();
+
     world.barrier();  // TODO: Remove
 
 	ASSERT(get_max_mult_() <= max_duplicates_);
@@ -344,104 +488,266 @@ GBOOL GGFX<T>::init(const std::size_t max_duplicates, const T tolerance, Coordin
 template <typename T>
 template <typename ValueArray, typename ReductionOp>
 GBOOL GGFX<T>::doOp(ValueArray& u, ReductionOp oper) {
+    GEOFLOW_TRACE();
+    ASSERT(pending_u_ == nullptr);
+    start_(u);
+    finish_(u, oper);
+    return true;
+}
+
+//
+// Tag identifying the built-in reduction ops, so doOp_end can
+// complete the reduction started by doOp_begin without storing
+// a type-erased callable (0 = not a built-in op)
+//
+template <typename T>
+template <typename ReductionOp>
+constexpr int GGFX<T>::op_tag_() {
+    if constexpr (std::is_same_v<ReductionOp, Sum>) return 1;
+    else if constexpr (std::is_same_v<ReductionOp, Max>) return 2;
+    else if constexpr (std::is_same_v<ReductionOp, Min>) return 3;
+    else if constexpr (std::is_same_v<ReductionOp, Smooth>) return 4;
+    else return 0;
+}
+
+//
+// Start the exchange for doOp: post receives, and pack and
+// send shared values. Until doOp_end is called, only values
+// of u that are not shared with other ranks (see
+// get_remote_flags) may be modified.
+//
+template <typename T>
+template <typename ValueArray, typename ReductionOp>
+GBOOL GGFX<T>::doOp_begin(ValueArray& u, ReductionOp) {
+    GEOFLOW_TRACE();
+    static_assert(op_tag_<ReductionOp>() != 0, "doOp_begin requires a built-in GGFX reduction op");
+    ASSERT(pending_u_ == nullptr);
+
+    start_(u);
+
+    // Save reduction to be completed by doOp_end
+    pending_u_ = &u;
+    pending_op_ = op_tag_<ReductionOp>();
+
+    return true;
+}
+
+//
+// Post receives, and pack and send shared values of u
+//
+template <typename T>
+template <typename ValueArray>
+void GGFX<T>::start_(ValueArray& u) {
     GEOFLOW_TRACE();
     using namespace geoflow::tbox;
 
     // Get size of data being used
     const auto N = u.size();
+    ASSERT(num_local_ <= N);
 
     // Get MPI communicator, etc.
     namespace mpi = boost::mpi;
     mpi::communicator world;
     auto my_rank = world.rank();
-    auto num_ranks = world.size();
 
     // Submit the Non-Blocking receive requests
     GEOFLOW_TRACE_START("Submit Receive Requests");
-    std::vector<mpi::request> recv_requests;
-    for (auto& [rank, mapping] : recv_map_) {
-        if (rank != my_rank) {
-            auto tag = rank + my_rank;
-            auto req = world.irecv(rank, tag, recv_buffer_[rank]);
-            recv_requests.emplace_back(req);
-        }
+    recv_requests_.clear();
+    for (size_type r = 0; r < recv_ranks_.size(); ++r) {
+        auto rank = recv_ranks_[r];
+        auto tag = rank + my_rank;
+        recv_requests_.emplace_back(world.irecv(rank, tag, recv_buffer_.data() + recv_ptr_[r],
+                                                static_cast<int>(recv_ptr_[r + 1] - recv_ptr_[r])));
     }
     GEOFLOW_TRACE_STOP();
 
     // Copy values into Send Buffers & Non-Block Send
-    std::vector<mpi::request> send_requests;
     GEOFLOW_TRACE_START("Pack Send Buffers");
-    for (auto& [rank, local_ids_to_send] : send_map_) {
-        // Pack into sending buffer
-        size_type i = 0;
-        auto& buffer_to_send = send_buffer_[rank];
-        buffer_to_send.resize(local_ids_to_send.size());
-        for (auto& id : local_ids_to_send) {
-            ASSERT(id < N);
-            buffer_to_send[i++] = u[id];
-        }
-
-        // Send buffer to receiving processor
+    for (size_type i = 0; i < send_ids_.size(); ++i) {
+        ASSERT(send_ids_[i] < N);
+        send_buffer_[i] = u[send_ids_[i]];
+    }
+    send_requests_.clear();
+    for (size_type r = 0; r < send_ranks_.size(); ++r) {
+        auto rank = send_ranks_[r];
         auto tag = rank + my_rank;
-        auto req = world.isend(rank, tag, buffer_to_send);
-        send_requests.emplace_back(req);
+        send_requests_.emplace_back(world.isend(rank, tag, send_buffer_.data() + send_ptr_[r],
+                                                static_cast<int>(send_ptr_[r + 1] - send_ptr_[r])));
     }
     GEOFLOW_TRACE_STOP();
+}
 
-    //	// Prepare the buffer used for the reduction
-    //	// - This should only resize during first call
-    reduction_buffer_.resize(N);
-    for (auto& buf : reduction_buffer_) {
-        buf.resize(0);
-        buf.reserve(max_duplicates_);
+//
+// Complete the exchange started by doOp_begin on the same array,
+// and reduce all shared values
+//
+template <typename T>
+template <typename ValueArray>
+GBOOL GGFX<T>::doOp_end(ValueArray& u) {
+    GEOFLOW_TRACE();
+    ASSERT(pending_u_ == &u);
+
+    switch (pending_op_) {
+        case op_tag_<Sum>(): finish_(u, Sum()); break;
+        case op_tag_<Max>(): finish_(u, Max()); break;
+        case op_tag_<Min>(): finish_(u, Min()); break;
+        case op_tag_<Smooth>(): finish_(u, Smooth()); break;
+        default: ASSERT(false); return false;
     }
+    pending_u_ = nullptr;
+    pending_op_ = 0;
 
-    // Insert local data into the reduction buffer
-    GEOFLOW_TRACE_START("Pack Local Data");
-    for (auto& [local_id, local_id_set] : recv_map_[my_rank]) {
-        for (auto& id : local_id_set) {
-            reduction_buffer_[id].push_back(u[local_id]);
-        }
+    return true;
+}
+
+//
+// Wait for the exchange posted by start_, and reduce all
+// shared values of u with oper
+//
+template <typename T>
+template <typename ValueArray, typename ReductionOp>
+void GGFX<T>::finish_(ValueArray& u, ReductionOp oper) {
+    GEOFLOW_TRACE();
+    namespace mpi = boost::mpi;
+
+    // Wait for all global data
+    wait_recv_();
+
+    reduce_(u, oper, recv_buffer_.data(), 1);
+
+    // Clear all send requests
+    mpi::wait_all(send_requests_.begin(), send_requests_.end());
+}
+
+//
+// Wait for all posted receives, and accumulate the time spent
+// waiting (e.g., on less loaded ranks)
+//
+template <typename T>
+void GGFX<T>::wait_recv_() {
+    GEOFLOW_TRACE();
+    namespace mpi = boost::mpi;
+
+    const auto tstart = std::chrono::steady_clock::now();
+    mpi::wait_all(recv_requests_.begin(), recv_requests_.end());
+    wait_time_ += std::chrono::duration<double>(std::chrono::steady_clock::now() - tstart).count();
+}
+
+//
+// Reduce each of the first nfields arrays of u, as doOp does for
+// a single array, but exchange values of all fields in a single
+// message per neighbor rank. Messages are packed node-major,
+// i.e., the nfields values of each shared node are contiguous.
+//
+template <typename T>
+template <typename ValueArray, typename ReductionOp>
+GBOOL GGFX<T>::doOp(GTVector<ValueArray*>& u, ReductionOp oper) {
+    return doOp(u, u.size(), oper);
+}
+
+template <typename T>
+template <typename ValueArray, typename ReductionOp>
+GBOOL GGFX<T>::doOp(GTVector<ValueArray*>& u, const std::size_t nfields, ReductionOp oper) {
+    GEOFLOW_TRACE();
+    using namespace geoflow::tbox;
+    namespace mpi = boost::mpi;
+    ASSERT(pending_u_ == nullptr);
+    ASSERT(nfields <= u.size());
+    if (nfields == 0) return true;
+    for (size_type f = 0; f < nfields; ++f) {
+        ASSERT(u[f] != nullptr);
+        ASSERT(num_local_ <= u[f]->size());
     }
-    GEOFLOW_TRACE_STOP();
 
-    // Insert global data into the reduction buffer
-    GEOFLOW_TRACE_START("Pack Global Data");
-    size_type recv_count = 0;
-    for (auto& [rank, remote_local_map] : recv_map_) {
-        if (rank != my_rank) {
-            recv_requests[recv_count++].wait();
-            auto& buffer_for_rank = recv_buffer_[rank];
+    // Get MPI communicator, etc.
+    mpi::communicator world;
+    auto my_rank = world.rank();
 
-            // Loop over each value received from rank
-            size_type n = 0;
-            for (auto& [remote_id, local_id_set] : remote_local_map) {
-                // Loop over each local ID the value is used in
-                for (auto& id : local_id_set) {
-                    ASSERT(reduction_buffer_.size() > id);
-                    ASSERT(reduction_buffer_[id].size() < max_duplicates_);
-                    reduction_buffer_[id].push_back(buffer_for_rank[n]);
-                }
-                ++n;
-            }
-        }
+    // Grow buffers to hold all fields
+    const size_type nf = nfields;
+    if (send_buffer_.size() < nf * send_ids_.size()) send_buffer_.resize(nf * send_ids_.size());
+    if (recv_buffer_.size() < nf * recv_ptr_.back()) recv_buffer_.resize(nf * recv_ptr_.back());
+
+    // Submit the Non-Blocking receive requests
+    GEOFLOW_TRACE_START("Submit Receive Requests");
+    recv_requests_.clear();
+    for (size_type r = 0; r < recv_ranks_.size(); ++r) {
+        auto rank = recv_ranks_[r];
+        auto tag = rank + my_rank;
+        recv_requests_.emplace_back(world.irecv(rank, tag, recv_buffer_.data() + nf * recv_ptr_[r],
+                                                static_cast<int>(nf * (recv_ptr_[r + 1] - recv_ptr_[r]))));
     }
     GEOFLOW_TRACE_STOP();
 
-    // Call the Reduction Operation on each
-    GEOFLOW_TRACE_START("Reduce");
-    size_type i = 0;
-    for (auto& dup_values : reduction_buffer_) {
-        u[i++] = oper(dup_values);
+    // Copy values of all fields into Send Buffers & Non-Block Send
+    GEOFLOW_TRACE_START("Pack Send Buffers");
+    for (size_type f = 0; f < nf; ++f) {
+        auto& uf = *u[f];
+        for (size_type i = 0; i < send_ids_.size(); ++i) {
+            send_buffer_[nf * i + f] = uf[send_ids_[i]];
+        }
+    }
+    send_requests_.clear();
+    for (size_type r = 0; r < send_ranks_.size(); ++r) {
+        auto rank = send_ranks_[r];
+        auto tag = rank + my_rank;
+        send_requests_.emplace_back(world.isend(rank, tag, send_buffer_.data() + nf * send_ptr_[r],
+                                                static_cast<int>(nf * (send_ptr_[r + 1] - send_ptr_[r]))));
     }
     GEOFLOW_TRACE_STOP();
 
+    // Wait for all global data
+    wait_recv_();
+
+    for (size_type f = 0; f < nf; ++f) {
+        reduce_(*u[f], oper, recv_buffer_.data() + f, nf);
+    }
+
     // Clear all send requests
-    mpi::wait_all(send_requests.begin(), send_requests.end());
+    mpi::wait_all(send_requests_.begin(), send_requests_.end());
 
     return true;
 }
 
+template <typename T>
+template <typename ValueArray, typename ReductionOp>
+void GGFX<T>::reduce_(ValueArray& u, ReductionOp oper, const value_type* recv, const size_type stride) {
+    GEOFLOW_TRACE();
+    using namespace geoflow::tbox;
+
+    // Call the Reduction Operation on each shared node;
+    // all other nodes are unchanged by the reduction.
+    // Received value n for this array is recv[stride*n]
+    const auto nshared = shared_ids_.size();
+    if constexpr (detail_ggfx::is_streaming_op<ReductionOp, value_type>::value) {
+        for (size_type k = 0; k < nshared; ++k) {
+            auto acc = ReductionOp::template init<value_type>();
+            for (size_type j = local_ptr_[k]; j < local_ptr_[k + 1]; ++j) {
+                acc = ReductionOp::combine(acc, static_cast<value_type>(u[local_ids_[j]]));
+            }
+            for (size_type j = remote_ptr_[k]; j < remote_ptr_[k + 1]; ++j) {
+                acc = ReductionOp::combine(acc, recv[stride * remote_ids_[j]]);
+            }
+            result_buffer_[k] = ReductionOp::finalize(acc, local_ptr_[k + 1] - local_ptr_[k] + remote_ptr_[k + 1] - remote_ptr_[k]);
+        }
+    } else {
+        for (size_type k = 0; k < nshared; ++k) {
+            dup_buffer_.clear();
+            for (size_type j = local_ptr_[k]; j < local_ptr_[k + 1]; ++j) {
+                dup_buffer_.push_back(u[local_ids_[j]]);
+            }
+            for (size_type j = remote_ptr_[k]; j < remote_ptr_[k + 1]; ++j) {
+                dup_buffer_.push_back(recv[stride * remote_ids_[j]]);
+            }
+            ASSERT(dup_buffer_.size() <= max_duplicates_);
+            result_buffer_[k] = oper(dup_buffer_);
+        }
+    }
+    for (size_type k = 0; k < nshared; ++k) {
+        u[shared_ids_[k]] = result_buffer_[k];
+    }
+}
+
 template <typename T>
 GC_COMM
 GGFX<T>::getComm() const {
@@ -458,17 +764,14 @@ void GGFX<T>::get_mult(CountArray& mult) const {
         mult[i] = 0;
     }
 
-    // Accumulate the counts in each index
-    // - Loop over buffers received from each rank
-    // - Loop over each value within the buffer
-    // - Loop over each local index that value contributes to
-    for (auto& [rank, matrix_map] : recv_map_) {
-        for (auto& [remote_id, local_id_set] : matrix_map) {
-            for (auto& id : local_id_set) {
-                ASSERT(id < mult.size());
-                ++(mult[id]);
-            }
-        }
+    // Each local node is its own contributor, unless
+    // shared, in which case get counts from the plan
+    for (size_type i = 0; i < num_local_; ++i) {
+        ASSERT(i < mult.size());
+        mult[i] = 1;
+    }
+    for (size_type k = 0; k < shared_ids_.size(); ++k) {
+        mult[shared_ids_[k]] = (local_ptr_[k + 1] - local_ptr_[k]) + (remote_ptr_[k + 1] - remote_ptr_[k]);
     }
 }
 
@@ -486,11 +789,32 @@ void GGFX<T>::get_imult(CountArray& imult) const {
     }
 }
 
+template <typename T>
+template <typename FlagArray>
+void GGFX<T>::get_remote_flags(FlagArray& flags) const {
+    GEOFLOW_TRACE();
+
+    // Flag each local index that is sent to, or receives
+    // a contribution from, another rank
+    for (size_type i = 0; i < num_local_; ++i) {
+        ASSERT(i < flags.size());
+        flags[i] = 0;
+    }
+    for (auto& id : send_ids_) {
+        flags[id] = 1;
+    }
+    for (size_type k = 0; k < shared_ids_.size(); ++k) {
+        if (remote_ptr_[k + 1] > remote_ptr_[k]) {
+            flags[shared_ids_[k]] = 1;
+        }
+    }
+}
+
 template <typename T>
 typename GGFX<T>::size_type
 GGFX<T>::get_max_mult_() const {
     using namespace ::geoflow::tbox;
-    std::vector<std::size_t> mults(reduction_buffer_.size());
+    std::vector<std::size_t> mults(num_local_);
     get_mult(mults);
     auto it = std::max_element(std::begin(mults), std::end(mults));
     //pio::perr << "Max Multiplicity = " << *it << std::endl;
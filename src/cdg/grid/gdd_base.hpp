@@ -26,7 +26,7 @@ public:
 
                           GDD_base(GINT nprocs);
                           GDD_base(const GDD_base &);
-                         ~GDD_base();
+virtual                  ~GDD_base();
 
 virtual  GDD_base        &operator=(const GDD_base &g) { nprocs_ = g.nprocs_; return *this; }
 
@@ -34,7 +34,7 @@ virtual  GDD_base        &operator=(const GDD_base &g) { nprocs_ = g.nprocs_; re
 virtual  GSIZET           doDD(const GTVector<GTVector<T>> &x, GINT irank, GTVector<GINT> &iret );
 virtual  GSIZET           doDD(const GTVector<GTPoint<T>>  &x, GINT irank, GTVector<GINT> &iret);
 
-private:
+protected:
 
 GINT               nprocs_ ;  // number of tasks/ranks to partition into
 
@@ -12,6 +12,7 @@
 
 
 #include "gtypes.h"
+#include "gexec.h"
 #include <iostream>
 #include <memory>
 #include <cmath>
@@ -24,10 +25,13 @@
 #include "gllbasis.hpp"
 #include "gelem_base.hpp"
 #include "gdd_base.hpp"
+#include "gsfc_dd.hpp"
 #include "gcblas.hpp"
 #include "gutils.hpp"
 #include "gcg.hpp"
 #include "gmtk.hpp"
+#include "gmorton_keygen.hpp"
+#include "gtpderiv.hpp"
 #include "ghelmholtz.hpp"
 #include "glinop_base.hpp"
 
@@ -54,7 +58,8 @@ template<typename TypePack>
 class GGrid 
 {
 public:
-                             enum GDerivType {GDV_VARP=0, GDV_CONSTP}; 
+                             enum GDerivType {GDV_VARP=0, GDV_CONSTP, GDV_SPECP}; 
+                             enum GElemClass {GEC_SHARED=0, GEC_INTERIOR, GEC_MAX}; 
                              struct CGTypePack { // define terrain typepack
                                      using Operator         = class GHelmholtz<TypePack>;
                                      using Preconditioner   = GLinOpBase<TypePack>;
@@ -113,6 +118,7 @@ virtual void                 do_elems() = 0;                           // comput
 virtual void                 do_elems(GTMatrix<GINT> &p,
                                GTVector<GTVector<Ftype>> &xnodes) = 0;// compute grid on restart
 //virtual void               set_partitioner(GDD_base<GTICOS> *d) = 0; // set and use GDD object
+virtual GDD_base<Ftype>     *get_partitioner() = 0;                    // get GDD object
 
 #if 0
 virtual void                 set_bdy_callback(
@@ -142,12 +148,15 @@ virtual void                 print(const GString &filename){}          // print
         GTVector<GSIZET>    &itype(GElemType i) { return itype_[i]; } // indices for type i    
         GElemType            gtype() { return gtype_; }               // get unique elem type on grid       
         GBOOL                ispconst();                              // is order constant?
+        GBOOL                isspecp();                               // may use GTPDeriv kernels?
         void                 dealias(StateComp &v1, StateComp &v2, 
                                      StateComp &prod);                // dealias for quadratic nonlinearity
         void                 deriv(GTVector<Ftype> &u, GINT idir, GTVector<Ftype> &tmp,
                                    GTVector<Ftype> &du );             // derivative of global vector
         void                 deriv(GTVector<Ftype> &u, GINT idir, GBOOL dotrans, GTVector<Ftype> &tmp,
                                    GTVector<Ftype> &du );            // derivative of global vector
+        void                 grad(GTVector<Ftype> &u, GBOOL bmetric, GTVector<Ftype> &tmp,
+                                  GTVector<GTVector<Ftype>*> &du);   // gradient of global vector
        void                  wderiv(GTVector<Ftype> &q, GINT idir, GBOOL bwghts, 
                                    GTVector<Ftype> &utmp, GTVector<Ftype> &du); // weak derivative
                            
@@ -223,7 +232,12 @@ virtual void                 print(const GString &filename){}          // print
 
         GGFX<Ftype>         &get_ggfx() { return *ggfx_; }             // get GGFX op
         void                 set_ggfx(GGFX<Ftype> &ggfx) 
-                               { ggfx_ = &ggfx; }                      // set GGFX op    
+                               { ggfx_ = &ggfx; classify_elems(ggfx); }// set GGFX op    
+        void                 classify_elems(GGFX<Ftype> &ggfx);       // find shared/interior elems
+        GBOOL                elems_classified(GGFX<Ftype> &ggfx)
+                               { return eclass_ggfx_ == &ggfx; }      // classified w/ ggfx?
+        GTVector<GSIZET>    &elem_runs(GElemClass ec) 
+                               { return erun_[ec]; }                   // [beg,end) elem runs in class
         GTVector<Ftype>     &get_mask() { return mask_; }              // get mask
 
         void                 smooth(GTVector<Ftype> &tmp, 
@@ -236,10 +250,16 @@ virtual void                 print(const GString &filename){}          // print
 
         void                 compute_grefderivs(GTVector<Ftype> &u, GTVector<Ftype> &etmp,
                                                 GBOOL btrans, GTVector<GTVector<Ftype>*> &du);
+        void                 compute_grefderivs(GTVector<Ftype> &u, GTVector<Ftype> &etmp,
+                                                GBOOL btrans, GTVector<GTVector<Ftype>*> &du,
+                                                GSIZET ebeg, GSIZET eend);
         void                 compute_grefderivsW(GTVector<Ftype> &u, GTVector<Ftype> &etmp,
                                                  GBOOL btrans, GTVector<GTVector<Ftype>*> &du);
         void                 compute_grefdiv(GTVector<GTVector<Ftype>*> &u, GTVector<Ftype> &etmp,
                                               GBOOL btrans, GTVector<Ftype> &divu);
+        void                 compute_grefdiv(GTVector<GTVector<Ftype>*> &u, GTVector<Ftype> &etmp,
+                                              GBOOL btrans, GTVector<Ftype> &divu,
+                                              GSIZET ebeg, GSIZET eend);
 
          GTVector<GINT>     &testid() { return testid_; }
          GTVector<GINT>     &testty() { return testty_; }
@@ -256,6 +276,8 @@ protected:
                                               GINT idir, GBOOL dotrans, GTVector<Ftype> &du);
         void                 grefderiv_constp(GTVector<Ftype> &u, GTVector<Ftype> &etmp,
                                               GINT idir, GBOOL dotrans, GTVector<Ftype> &du);
+        void                 grefderiv_specp (GTVector<Ftype> &u, GTVector<Ftype> &etmp,
+                                              GINT idir, GBOOL dotrans, GTVector<Ftype> &du);
 virtual void                 config_gbdy(const PropertyTree &ptree, 
                                GBOOL                         bterrain,
                                GTVector<GTVector<GSIZET>>   &igbdyf, 
@@ -338,6 +360,8 @@ virtual void                 elem_face_data(
         GTVector<GTVector<Ftype>>   qdtmp_;            // quadratic dealias tmp space
         PropertyTree                ptree_;            // main prop tree
         GGFX<Ftype>                *ggfx_;             // connectivity operator
+        GGFX<Ftype>                *eclass_ggfx_;      // connectivity op used to classify elems
+        GTVector<GTVector<GSIZET>>  erun_;             // [beg,end) runs of elems in each GElemClass
         typename LinSolverBase<CGTypePack>::Traits
                                     cgtraits_;         // GCG operator traits
 
@@ -40,6 +40,7 @@ comm_                            (comm),
 mass_                         (NULLPTR),
 imass_                        (NULLPTR),
 ggfx_                         (NULLPTR),
+eclass_ggfx_                  (NULLPTR),
 ptree_                          (ptree),
 bdy_apply_callback_           (NULLPTR)
 {
@@ -55,6 +56,8 @@ bdy_apply_callback_           (NULLPTR)
   cgtraits_.tol   = gridptree.getValue<GDOUBLE>("tol", 1.0e-8);
   snorm           = gridptree.getValue<GString>("norm_type", "GCG_NORM_INF");
   cgtraits_.normtype = LinSolverBase<CGTypePack>::str2normtype(snorm);
+  cgtraits_.pipelined = gridptree.getValue<GBOOL>("pipelined_cg", FALSE);
+  cgtraits_.nproject  = gridptree.getValue<GINT>("cg_nproject", 0);
 
   cudat_.nstreams = ptree.getValue<GINT>("nstreams",1);
   cudat_.nstreams = MAX(cudat_.nstreams,1);
@@ -466,6 +469,11 @@ void GGrid<Types>::grid_init()
 
   bpconst_ = ispconst();
 
+  // Use order-specialized derivative kernels whenever
+  // possible; may be changed with set_derivtype:
+  gderivtype_ = isspecp() ? GDV_SPECP 
+              : ( bpconst_ ? GDV_CONSTP : GDV_VARP );
+
   GComm::Synch(comm_);
 
   do_typing(); // do element-typing check
@@ -554,6 +562,10 @@ void GGrid<Types>::grid_init(GTMatrix<GINT> &p,
 
   do_elems(p, xnodes); // generate element list from derived class
 
+  bpconst_    = ispconst();
+  gderivtype_ = isspecp() ? GDV_SPECP 
+              : ( bpconst_ ? GDV_CONSTP : GDV_VARP );
+
   GComm::Synch(comm_);
 
   do_typing(); // do element-typing check
@@ -1190,6 +1202,92 @@ void GGrid<Types>::deriv(GTVector<Ftype> &u, GINT idir, GTVector<Ftype> &utmp,
     
 } // end of method deriv (1)
 
+//**********************************************************************************
+//**********************************************************************************
+// METHOD : grad
+// DESC   : Compute (collocated) spatial gradient of u, du_i = du/dx_i, 
+//          for all coordinate directions at once. If specialized 
+//          derivatives are selected (GDV_SPECP, the default for 
+//          constant, isotropic, supported order), all reference 
+//          derivatives and the metric are applied in a single 
+//          pass over elements; else, defaults to deriv in each direction.
+// ARGS   : u      : 'global' integral argument
+//          bmetric: if TRUE, apply metric, and return physical gradient;
+//                   else, return reference derivatives, D_j u
+//          utmp   : tmp vector of same size as u
+//          du     : gradient components, returned. Must be of size GDIM
+//                   for GE_REGULAR, or if bmetric is FALSE; else,
+//                   size determines number of components computed 
+//                   (up to GDIM+1 for GE_2DEMBEDDED).
+// RETURNS: none.
+//**********************************************************************************
+template<typename Types>
+void GGrid<Types>::grad(GTVector<Ftype> &u, GBOOL bmetric, 
+                 GTVector<Ftype> &utmp, GTVector<GTVector<Ftype>*> &du)
+{
+  GEOFLOW_TRACE();
+  assert(bInitialized_ && "Object not inititialized");
+
+  GBOOL                       bret;
+  GINT                        nxy = gtype_ == GE_2DEMBEDDED ? GDIM+1 : GDIM;
+  GINT                        nout;
+  GTVector<GTMatrix<Ftype>*>  Di(GDIM);
+  GTVector<GTVector<Ftype>*>  G;
+  GTPDeriv::GTPMetric         mtype;
+  GTMatrix<GTVector<Ftype>>  *dXidX = &this->dXidX();
+
+  if ( !bmetric ) {
+    compute_grefderivs(u, etmp_, FALSE, du);
+    return;
+  }
+
+  nout = gtype_ == GE_REGULAR ? GDIM : MIN(du.size(), nxy);
+  assert(du.size() >= nout && "Insufficient number of derivatives specified");
+
+  if ( gderivtype_ != GDV_SPECP || gelems_.size() == 0 ) {
+    for ( auto i=0; i<nout; i++ ) {
+      deriv(u, i+1, utmp, *du[i]);
+    }
+    return;
+  }
+
+  // Set metric: G[j+GDIM*i] = dXi^j/dX^i:
+  if ( gtype_ == GE_REGULAR ) {
+    mtype = GTPDeriv::GTP_DIAGMETRIC;
+    G.resize(GDIM);
+    for ( auto j=0; j<GDIM; j++ ) G[j] = &(*dXidX)(j,0);
+  }
+  else {
+    mtype = GTPDeriv::GTP_FULLMETRIC;
+    G.resize(GDIM*nout);
+    for ( auto i=0; i<nout; i++ ) {
+      for ( auto j=0; j<GDIM; j++ ) G[j+GDIM*i] = &(*dXidX)(j,i);
+    }
+  }
+
+  Di[0] = gelems_[0]->gbasis(0)->getDerivMatrix(FALSE);
+  for ( auto k=1; k<GDIM; k++ ) {
+    Di[k] = gelems_[0]->gbasis(k)->getDerivMatrix(TRUE);
+  }
+
+  if ( mtype == GTPDeriv::GTP_FULLMETRIC && du.size() != nout ) {
+    GTVector<GTVector<Ftype>*> dd(nout);
+    for ( auto i=0; i<nout; i++ ) dd[i] = du[i];
+    bret = GTPDeriv::grad<Ftype>(Di, u, gelems_[0]->size(0), gelems_.size(), mtype, G, dd);
+  }
+  else {
+    bret = GTPDeriv::grad<Ftype>(Di, u, gelems_[0]->size(0), gelems_.size(), mtype, G, du);
+  }
+
+  if ( !bret ) { // order unsupported by fused kernel
+    for ( auto i=0; i<nout; i++ ) {
+      deriv(u, i+1, utmp, *du[i]);
+    }
+  }
+    
+} // end of method grad
+
+
 //**********************************************************************************
 //**********************************************************************************
 // METHOD : wderiv 
@@ -1846,6 +1944,27 @@ void GGrid<Types>::compute_grefderivsW(GTVector<Ftype> &u, GTVector<Ftype> &etmp
 template<typename Types>
 void GGrid<Types>::compute_grefdiv(GTVector<GTVector<Ftype>*> &u, GTVector<Ftype> &etmp,
                             GBOOL dotrans, GTVector<Ftype> &divu)
+{
+  compute_grefdiv(u, etmp, dotrans, divu, 0, gelems_.size());
+
+} // end, method compute_grefdiv
+
+
+//**********************************************************************************
+//**********************************************************************************
+// METHOD : compute_grefdiv (2)
+// DESC   : As compute_grefdiv, but restricted to the elements 
+//          ebeg <= e < eend. Only the nodes of these elements are
+//          written in divu.
+// ARGS   : u, etmp, dotrans, divu: see compute_grefdiv
+//          ebeg   : first element 
+//          eend   : one past last element 
+// RETURNS:  none
+//**********************************************************************************
+template<typename Types>
+void GGrid<Types>::compute_grefdiv(GTVector<GTVector<Ftype>*> &u, GTVector<Ftype> &etmp,
+                            GBOOL dotrans, GTVector<Ftype> &divu,
+                            GSIZET ebeg, GSIZET eend)
 {
        GEOFLOW_TRACE();
   GBOOL                        bembedded;
@@ -1865,11 +1984,20 @@ void GGrid<Types>::compute_grefdiv(GTVector<GTVector<Ftype>*> &u, GTVector<Ftype
   && "Insufficient number of vector field components provided");
 #endif
 
-  divu = 0.0;
+  assert(ebeg <= eend && eend <= gelems->size() && "Invalid element range");
+  if ( ebeg == eend ) return;
+
+  if ( ebeg == 0 && eend == gelems->size() ) {
+    divu = 0.0;
+  }
+  else {
+    iend = (*gelems)[eend-1]->igend();
+    for ( auto j=(*gelems)[ebeg]->igbeg(); j<=iend; j++ ) divu[j] = 0.0;
+  }
 
 #if defined(_G_IS2D)
 
-  for ( auto e=0; e<gelems->size(); e++ ) {
+  for ( auto e=ebeg; e<eend; e++ ) {
     // restrict global vecs to local range
     ibeg = (*gelems)[e]->igbeg(); iend = (*gelems)[e]->igend();
     divu.range(ibeg,iend); 
@@ -1895,7 +2023,7 @@ void GGrid<Types>::compute_grefdiv(GTVector<GTVector<Ftype>*> &u, GTVector<Ftype
 
 #elif defined(_G_IS3D)
 
-  for ( auto e=0; e<gelems->size(); e++ ) {
+  for ( auto e=ebeg; e<eend; e++ ) {
     ibeg = (*gelems)[e]->igbeg(); iend = (*gelems)[e]->igend();
     divu.range(ibeg,iend); 
     for ( auto k=0; k<u.size(); k++ ) if (u[k]!=NULLPTR) u[k]->range(ibeg, iend); 
@@ -1924,7 +2052,7 @@ void GGrid<Types>::compute_grefdiv(GTVector<GTVector<Ftype>*> &u, GTVector<Ftype
 #endif
 
 
-} // end, method compute_grefdiv
+} // end, method compute_grefdiv (2)
 
 
 //**********************************************************************************
@@ -1953,6 +2081,27 @@ void GGrid<Types>::compute_grefdiv(GTVector<GTVector<Ftype>*> &u, GTVector<Ftype
 template<typename Types>
 void GGrid<Types>::compute_grefderivs(GTVector<Ftype> &u, GTVector<Ftype> &etmp,
                                GBOOL dotrans, GTVector<GTVector<Ftype>*> &du)
+{
+  compute_grefderivs(u, etmp, dotrans, du, 0, gelems_.size());
+
+} // end of method compute_grefderivs
+
+
+//**********************************************************************************
+//**********************************************************************************
+// METHOD : compute_grefderivs (2)
+// DESC   : As compute_grefderivs, but restricted to the elements
+//          ebeg <= e < eend. Only the nodes of these elements are
+//          written in du.
+// ARGS   : u, etmp, dotrans, du: see compute_grefderivs
+//          ebeg   : first element 
+//          eend   : one past last element 
+// RETURNS:  none
+//**********************************************************************************
+template<typename Types>
+void GGrid<Types>::compute_grefderivs(GTVector<Ftype> &u, GTVector<Ftype> &etmp,
+                               GBOOL dotrans, GTVector<GTVector<Ftype>*> &du,
+                               GSIZET ebeg, GSIZET eend)
 {
 	GEOFLOW_TRACE();
   assert(du.size() >= GDIM
@@ -1960,7 +2109,7 @@ void GGrid<Types>::compute_grefderivs(GTVector<Ftype> &u, GTVector<Ftype> &etmp,
   
 
 
-  GBOOL                        bembedded;
+  GBOOL                        bembedded, bret;
   GINT                         nxy;
   GSIZET                       ibeg, iend; // beg, end indices for global array
   GTVector<GSIZET>             N(GDIM);
@@ -1974,9 +2123,30 @@ void GGrid<Types>::compute_grefderivs(GTVector<Ftype> &u, GTVector<Ftype> &etmp,
 
   nxy = bembedded ? GDIM+1 : GDIM;
 
+  assert(ebeg <= eend && eend <= gelems->size() && "Invalid element range");
+  if ( ebeg == eend ) return;
+
+  if ( gderivtype_ == GDV_SPECP ) {
+    // Compute all ref. derivatives in one pass over elements:
+    GTVector<GTVector<Ftype>*> G;
+    ibeg = (*gelems)[ebeg]->igbeg(); iend = (*gelems)[eend-1]->igend();
+    u.range(ibeg, iend); 
+    for ( auto k=0; k<GDIM; k++ ) du[k]->range(ibeg, iend);
+    Di[0] = (*gelems)[0]->gbasis(0)->getDerivMatrix (dotrans);
+    for ( auto k=1; k<GDIM; k++ ) {
+      Di[k] = (*gelems)[0]->gbasis(k)->getDerivMatrix(!dotrans);
+    }
+    bret = GTPDeriv::grad<Ftype>(Di, u, (*gelems)[0]->size(0), eend-ebeg, 
+                                 GTPDeriv::GTP_NOMETRIC, G, du);
+    u.range_reset(); 
+    for ( auto k=0; k<GDIM; k++ ) du[k]->range_reset();
+    if ( bret ) return;
+    // ...else order unsupported; use general kernels below
+  }
+
 #if defined(_G_IS2D)
 
-  for ( auto e=0; e<gelems->size(); e++ ) {
+  for ( auto e=ebeg; e<eend; e++ ) {
     ibeg = (*gelems)[e]->igbeg(); iend = (*gelems)[e]->igend();
     u.range(ibeg, iend); // restrict global vecs to local range
     for ( auto k=0; k<nxy ; k++ ) du[k]->range(ibeg, iend);
@@ -1996,7 +2166,7 @@ void GGrid<Types>::compute_grefderivs(GTVector<Ftype> &u, GTVector<Ftype> &etmp,
 
 #elif defined(_G_IS3D)
 
-  for ( auto e=0; e<gelems->size(); e++ ) {
+  for ( auto e=ebeg; e<eend; e++ ) {
     ibeg = (*gelems)[e]->igbeg(); iend = (*gelems)[e]->igend();
     u.range(ibeg, iend); // restrict global vecs to local range
     for ( auto k=0; k<GDIM; k++ ) du[k]->range(ibeg, iend);
@@ -2013,7 +2183,7 @@ void GGrid<Types>::compute_grefderivs(GTVector<Ftype> &u, GTVector<Ftype> &etmp,
 
 #endif
 
-} // end of method compute_grefderivs
+} // end of method compute_grefderivs (2)
 
 
 //**********************************************************************************
@@ -2054,6 +2224,9 @@ void GGrid<Types>::compute_grefderiv(GTVector<Ftype> &u, GTVector<Ftype> &etmp,
     case GDV_CONSTP:
       grefderiv_constp (u, etmp, idir, dotrans, du);
       break;
+    case GDV_SPECP:
+      grefderiv_specp  (u, etmp, idir, dotrans, du);
+      break;
     default:
       assert(false);
   }
@@ -2095,95 +2268,148 @@ void GGrid<Types>::grefderiv_varp(GTVector<Ftype> &u, GTVector<Ftype> &etmp,
                              GINT idir, GBOOL dotrans, GTVector<Ftype> &du)
 {
 	GEOFLOW_TRACE();
-  GSIZET               ibeg, iend; // beg, end indices for global array
+  GElemList           *gelems = &this->elems();
+  GLLONG               ne     = gelems->size();
+
+  assert(idir >= 1 && idir <= 3 && "Invalid coordinate direction");
+
+#if defined(_G_IS2D)
+  if ( idir == 3 ) {
+    assert( GDIM == 3
+         && "Only GDIM reference derivatives");
+    du = 0.0; //u;
+    return;
+  }
+#endif
+
+  // Elements are independent, so may be done in parallel. Each
+  // operates on non-owning views of its part of u, du, rather 
+  // than on restricted ranges of the shared global vectors:
+  GEXEC_PARALLEL_FOR_ELEMS(ne)
+  for ( GLLONG e=0; e<ne; e++ ) {
+    GSIZET           ibeg = (*gelems)[e]->igbeg(); // beg, end indices for global array
+    GSIZET           nn   = (*gelems)[e]->igend() - ibeg + 1;
+    GTVector<Ftype>  ue (u .data()+ibeg, nn, 1, FALSE);
+    GTVector<Ftype>  due(du.data()+ibeg, nn, 1, FALSE);
+    GTMatrix<Ftype> *Di;         // element-based 1d derivative operator
+
+    // x-derivative uses D, others D^T:
+    Di = (*gelems)[e]->gbasis(idir-1)->getDerivMatrix(idir == 1 ? dotrans : !dotrans);
+#if defined(_G_IS2D)
+    if ( idir == 1 ) {
+      GMTK::I2_X_D1(*Di, ue, (*gelems)[e]->size(0), (*gelems)[e]->size(1), due); 
+    }
+    else {
+      GMTK::D2_X_I1(*Di, ue, (*gelems)[e]->size(0), (*gelems)[e]->size(1), due); 
+    }
+#elif defined(_G_IS3D)
+    switch (idir) {
+    case 1:
+      GMTK::I3_X_I2_X_D1(*Di, ue, (*gelems)[e]->size(0), (*gelems)[e]->size(1), 
+                         (*gelems)[e]->size(2), due); 
+      break;
+    case 2:
+      GMTK::I3_X_D2_X_I1(*Di, ue, (*gelems)[e]->size(0), (*gelems)[e]->size(1), 
+                         (*gelems)[e]->size(2), due); 
+      break;
+    case 3:
+      GMTK::D3_X_I2_X_I1(*Di, ue, (*gelems)[e]->size(0), (*gelems)[e]->size(1), 
+                         (*gelems)[e]->size(2), due); 
+      break;
+    }
+#endif
+  }
+
+} // end of method grefderiv_varp
+
+
+//**********************************************************************************
+//**********************************************************************************
+// METHOD : grefderiv_constp
+// DESC   : Compute tensor product derivative in specified direction
+//          of specified field, u, in ref space, using grid object.
+//          Compute
+//            du = [ I_X_I_X_Dx, or
+//                   I_X_Dy_X_I, or
+//                   Dz_X_I_X_I].
+//     
+//          depending on whether idir = 1, 2, or 3, respectively,
+//          where Dx, Dy, Dz are 1d derivative objects from basis functions     
+// ARGS   : 
+//          u      : input field whose derivative we want, allocated globally 
+//                   (e.g., for all elements).
+//          etmp   : tmp array (possibly resized here) for element-based ops.
+//                   Is not global.
+//          idir   : coordinate direction (1, 2,...,GDIM)
+//          dotrans: flag telling us to take transpose of deriv operators (TRUE) or
+//                   not (FALSE).
+//          du     : vector of length of u containing the derivative.
+//
+//          Computes matrix by formaulating tensor products over all
+//          elements elements. May be used for case when order doesn't vary
+//          amongh elements.
+//             
+// RETURNS:  none
+//**********************************************************************************
+template<typename Types>
+void GGrid<Types>::grefderiv_constp(GTVector<Ftype> &u, GTVector<Ftype> &etmp,
+                            GINT idir, GBOOL dotrans, GTVector<Ftype> &du)
+{
+	GEOFLOW_TRACE();
+  GSIZET               ibeg, iend, Ne,  NN; // beg, end indices for global array
   GTVector<GSIZET>     N(GDIM);
   GTMatrix<Ftype>     *Di;         // element-based 1d derivative operators
   GElemList           *gelems = &this->elems();
 
 
+  for ( auto k=0; k<GDIM; k++ ) N[k]= (*gelems)[0]->size(k);
+  Ne = gelems->size();
+
+
 #if defined(_G_IS2D)
   switch (idir) {
   case 1:
-    for ( auto e=0; e<gelems->size(); e++ ) {
-      ibeg = (*gelems)[e]->igbeg(); iend = (*gelems)[e]->igend();
-      u.range(ibeg, iend); // restrict global vecs to local range
-      du.range(ibeg, iend);
-      for ( auto k=0; k<GDIM; k++ ) N[k]= (*gelems)[e]->size(k);
-      Di = (*gelems)[e]->gbasis(0)->getDerivMatrix (dotrans);
-      GMTK::I2_X_D1(*Di, u, N[0], N[1], du); 
-    }
+    Di = (*gelems)[0]->gbasis(0)->getDerivMatrix (dotrans);
+    GMTK::I2_X_D1<Ftype>(*Di, u, N[0], N[1], Ne, cudat_, du); 
     break;
   case 2:
-    for ( auto e=0; e<gelems->size(); e++ ) {
-      ibeg = (*gelems)[e]->igbeg(); iend = (*gelems)[e]->igend();
-      u.range(ibeg, iend); // restrict global vecs to local range
-      du.range(ibeg, iend);
-      for ( auto k=0; k<GDIM; k++ ) N[k]= (*gelems)[e]->size(k);
-      Di = (*gelems)[e]->gbasis(1)->getDerivMatrix(!dotrans);
-      GMTK::D2_X_I1(*Di, u, N[0], N[1], du); 
-    }
-    break;
-  case 3:
-    assert( GDIM == 3
-         && "Only GDIM reference derivatives");
-    du = 0.0; //u;
+    Di = (*gelems)[0]->gbasis(1)->getDerivMatrix(!dotrans);
+    GMTK::D2_X_I1<Ftype>(*Di, u, N[0], N[1], Ne, cudat_, du); 
     break;
   default:
     assert(FALSE && "Invalid coordinate direction");
   }
-  u.range_reset(); // reset to global range
-  du.range_reset();
 
 #elif defined(_G_IS3D)
-
   switch (idir) {
   case 1:
-    for ( auto e=0; e<gelems->size(); e++ ) {
-      ibeg = (*gelems)[e]->igbeg(); iend = (*gelems)[e]->igend();
-      u.range(ibeg, iend); // restrict global vecs to local range
-      du.range(ibeg, iend);
-      for ( auto k=0; k<GDIM  ; k++ ) N[k]= (*gelems)[e]->size(k);
-      Di = (*gelems)[e]->gbasis(0)->getDerivMatrix (dotrans); 
-      GMTK::I3_X_I2_X_D1(*Di, u, N[0], N[1], N[2], du); 
-    }
+    Di = (*gelems)[0]->gbasis(0)->getDerivMatrix (dotrans); 
+    NN = N[2]*N[1] * Ne;
+    GMTK::I3_X_I2_X_D1<Ftype>(*Di, u, N[0], N[1], N[2], Ne, cudat_, du); 
     break;
 
   case 2:
-    for ( auto e=0; e<gelems->size(); e++ ) {
-      ibeg = (*gelems)[e]->igbeg(); iend = (*gelems)[e]->igend();
-      u.range(ibeg, iend); // restrict global vecs to local range
-      du.range(ibeg, iend);
-      for ( auto k=0; k<GDIM  ; k++ ) N[k]= (*gelems)[e]->size(k);
-      Di = (*gelems)[e]->gbasis(1)->getDerivMatrix(!dotrans); 
-      GMTK::I3_X_D2_X_I1(*Di, u, N[0], N[1], N[2], du); 
-    }
+    Di = (*gelems)[0]->gbasis(1)->getDerivMatrix(!dotrans); 
+    GMTK::I3_X_D2_X_I1<Ftype>(*Di, u, N[0], N[1], N[2], Ne, cudat_, du); 
     break;
 
   case 3:
-    for ( auto e=0; e<gelems->size(); e++ ) {
-      ibeg = (*gelems)[e]->igbeg(); iend = (*gelems)[e]->igend();
-      u.range(ibeg, iend); // restrict global vecs to local range
-      du.range(ibeg, iend);
-      for ( auto k=0; k<GDIM  ; k++ ) N[k]= (*gelems)[e]->size(k);
-      Di = (*gelems)[e]->gbasis(2)->getDerivMatrix(!dotrans); 
-      GMTK::D3_X_I2_X_I1(*Di, u, N[0], N[1], N[2], du); 
-    }
+    Di = (*gelems)[0]->gbasis(2)->getDerivMatrix(!dotrans); 
+    GMTK::D3_X_I2_X_I1<Ftype>(*Di, u, N[0], N[1], N[2], Ne, cudat_, du); 
     break;
 
   default:
     assert(FALSE && "Invalid coordinate direction");
   }
-  u.range_reset(); // reset global vec to globalrange
-  du.range_reset();
 
 #endif
 
-} // end of method grefderiv_varp
+} // end of method grefderiv_constp
 
 
 //**********************************************************************************
 //**********************************************************************************
-// METHOD : grefderiv_constp
+// METHOD : grefderiv_specp
 // DESC   : Compute tensor product derivative in specified direction
 //          of specified field, u, in ref space, using grid object.
 //          Compute
@@ -2203,18 +2429,21 @@ void GGrid<Types>::grefderiv_varp(GTVector<Ftype> &u, GTVector<Ftype> &etmp,
 //                   not (FALSE).
 //          du     : vector of length of u containing the derivative.
 //
-//          Computes matrix by formaulating tensor products over all
-//          elements elements. May be used for case when order doesn't vary
-//          amongh elements.
+//          Like grefderiv_constp, but uses the GTPDeriv kernels, which
+//          are specialized at compile time on the element order. May be 
+//          used only when order is constant among elements, and the
+//          same in each direction. Falls back to grefderiv_constp
+//          if the kernels do not support the order.
 //             
 // RETURNS:  none
 //**********************************************************************************
 template<typename Types>
-void GGrid<Types>::grefderiv_constp(GTVector<Ftype> &u, GTVector<Ftype> &etmp,
+void GGrid<Types>::grefderiv_specp(GTVector<Ftype> &u, GTVector<Ftype> &etmp,
                             GINT idir, GBOOL dotrans, GTVector<Ftype> &du)
 {
 	GEOFLOW_TRACE();
-  GSIZET               ibeg, iend, Ne,  NN; // beg, end indices for global array
+  GBOOL                bret=FALSE;
+  GSIZET               Ne;
   GTVector<GSIZET>     N(GDIM);
   GTMatrix<Ftype>     *Di;         // element-based 1d derivative operators
   GElemList           *gelems = &this->elems();
@@ -2228,41 +2457,43 @@ void GGrid<Types>::grefderiv_constp(GTVector<Ftype> &u, GTVector<Ftype> &etmp,
   switch (idir) {
   case 1:
     Di = (*gelems)[0]->gbasis(0)->getDerivMatrix (dotrans);
-    GMTK::I2_X_D1<Ftype>(*Di, u, N[0], N[1], Ne, cudat_, du); 
+    bret = GTPDeriv::I2_X_D1<Ftype>(*Di, u, N[0], N[1], Ne, du); 
     break;
   case 2:
     Di = (*gelems)[0]->gbasis(1)->getDerivMatrix(!dotrans);
-    GMTK::D2_X_I1<Ftype>(*Di, u, N[0], N[1], Ne, cudat_, du); 
+    bret = GTPDeriv::D2_X_I1<Ftype>(*Di, u, N[0], N[1], Ne, du); 
     break;
   default:
-    assert(FALSE && "Invalid coordinate direction");
+    break;
   }
 
 #elif defined(_G_IS3D)
   switch (idir) {
   case 1:
     Di = (*gelems)[0]->gbasis(0)->getDerivMatrix (dotrans); 
-    NN = N[2]*N[1] * Ne;
-    GMTK::I3_X_I2_X_D1<Ftype>(*Di, u, N[0], N[1], N[2], Ne, cudat_, du); 
+    bret = GTPDeriv::I3_X_I2_X_D1<Ftype>(*Di, u, N[0], N[1], N[2], Ne, du); 
     break;
 
   case 2:
     Di = (*gelems)[0]->gbasis(1)->getDerivMatrix(!dotrans); 
-    GMTK::I3_X_D2_X_I1<Ftype>(*Di, u, N[0], N[1], N[2], Ne, cudat_, du); 
+    bret = GTPDeriv::I3_X_D2_X_I1<Ftype>(*Di, u, N[0], N[1], N[2], Ne, du); 
     break;
 
   case 3:
     Di = (*gelems)[0]->gbasis(2)->getDerivMatrix(!dotrans); 
-    GMTK::D3_X_I2_X_I1<Ftype>(*Di, u, N[0], N[1], N[2], Ne, cudat_, du); 
+    bret = GTPDeriv::D3_X_I2_X_I1<Ftype>(*Di, u, N[0], N[1], N[2], Ne, du); 
     break;
 
   default:
-    assert(FALSE && "Invalid coordinate direction");
+    break;
   }
 
 #endif
 
-} // end of method grefderiv_constp
+  // Order or direction not supported by specialized kernels:
+  if ( !bret ) grefderiv_constp(u, etmp, idir, dotrans, du);
+
+} // end of method grefderiv_specp
 
 
 //**********************************************************************************
@@ -2295,11 +2526,41 @@ GBOOL GGrid<Types>::ispconst()
 } // end of method ispconst
 
 
+//**********************************************************************************
+//**********************************************************************************
+// METHOD : isspecp
+// DESC   : Check if specialized (GTPDeriv) derivative kernels may
+//          be used: p must be constant over elements, the same in 
+//          each direction, and supported by the kernels. 
+// ARGS   : none. 
+// RETURNS: TRUE if specialized kernels may be used; else FALSE
+//**********************************************************************************
+template<typename Types>
+GBOOL GGrid<Types>::isspecp()
+{
+	GEOFLOW_TRACE();
+  GBOOL       bspec;
+  GSIZET      N0;
+
+  if ( !bpconst_ || gelems_.size() == 0 ) return FALSE;
+
+  N0    = gelems_[0]->size(0);
+  bspec = GTPDeriv::supported(N0);
+  for ( auto k=1; k<GDIM; k++ ) {
+    bspec = bspec && N0 == gelems_[0]->size(k);
+  }
+
+  return bspec;
+
+} // end of method isspecp
+
+
 //**********************************************************************************
 //**********************************************************************************
 // METHOD : set_derivtype
 // DESC   : Set derivative type. Does some checking to ensure
-//          that it's valid.
+//          that it's valid; if GDV_SPECP is not valid for
+//          this grid, GDV_CONSTP is used.
 // ARGS   : GDerivType flag
 // RETURNS: none.
 //**********************************************************************************
@@ -2310,18 +2571,71 @@ void GGrid<Types>::set_derivtype(GDerivType gt)
   if ( !bpconst_ ) {
     assert( gt == GDV_VARP );
   }
+  if ( gt == GDV_SPECP && !isspecp() ) {
+    EH_MESSAGE("GGrid::set_derivtype: specialized derivatives not supported for this grid; using general kernels");
+    gt = bpconst_ ? GDV_CONSTP : GDV_VARP;
+  }
 
   gderivtype_ = gt;
 
 } // end of method set_derivtype
 
 
+//**********************************************************************************
+//**********************************************************************************
+// METHOD : classify_elems
+// DESC   : Classify elements as shared (having at least one node 
+//          exchanged with another rank by the connectivity operator) 
+//          or interior, and store each class as runs of contiguous 
+//          elements. Operators may then compute shared elements, 
+//          start the exchange (GGFX::doOp_begin), and compute 
+//          interior elements while the exchange is in flight.
+// ARGS   : ggfx: connectivity operator
+// RETURNS: none.
+//**********************************************************************************
+template<typename Types>
+void GGrid<Types>::classify_elems(GGFX<Ftype> &ggfx)
+{
+	GEOFLOW_TRACE();
+  GINT             ec, ecprev=-1;
+  GTVector<GINT>   iremote(ndof());
+
+  ggfx.get_remote_flags(iremote);
+
+  erun_.resize(GEC_MAX);
+  for ( auto j=0; j<GEC_MAX; j++ ) erun_[j].clear();
+
+  for ( auto e=0; e<gelems_.size(); e++ ) {
+    ec = GEC_INTERIOR;
+    for ( auto j=gelems_[e]->igbeg(); j<=gelems_[e]->igend() && ec==GEC_INTERIOR; j++ ) {
+      if ( iremote[j] ) ec = GEC_SHARED;
+    }
+    if ( ec == ecprev ) {            // extend current run
+      erun_[ec][erun_[ec].size()-1] = e+1;
+    }
+    else {                           // start new run
+      erun_[ec].push_back(e);
+      erun_[ec].push_back(e+1);
+    }
+    ecprev = ec;
+  }
+  
+  eclass_ggfx_ = &ggfx;
+
+} // end of method classify_elems
+
+
 
 
 //**********************************************************************************
 //**********************************************************************************
 // METHOD : set_elemids
-// DESC   : Set element id vector from individiual elements
+// DESC   : Set element id vector, and individual element ids. 
+//          Ids are Morton keys of the element centroids, 
+//          integralized on the global centroid bounding box, so 
+//          that they are unique, and independent of the domain
+//          decomposition. They may then be used to find an 
+//          element's data in files written on any no. tasks.
 // ARGS   : none.
 // RETURNS: none.
 //**********************************************************************************
@@ -2329,10 +2643,51 @@ template<typename Types>
 void GGrid<Types>::set_elemids()
 {
 	GEOFLOW_TRACE();
+  GINT                     nbits;
+  Ftype                    del;
+  GTPoint<Ftype>           P0(3), dX(3);
+  GTVector<Ftype>          lmin(3), lmax(3), gmin(3), gmax(3);
+  GTVector<GTPoint<Ftype>> xc(gelems_.size());
+  GMorton_KeyGen<GKEY,Ftype> 
+                           gkey;
+
+  // Get centroids, always as 3-points (2d elements may be
+  // embedded in 3-space), and find global bounding box:
+  lmin =  std::numeric_limits<Ftype>::max();
+  lmax = -std::numeric_limits<Ftype>::max();
+  for ( auto e=0; e<gelems_.size(); e++ ) {
+    xc[e].resize(3);
+    xc[e] = 0.0;
+    for ( auto k=0; k<gelems_[e]->elemCentroid().dim() && k<3; k++ ) {
+      xc[e][k] = gelems_[e]->elemCentroid()[k];
+    }
+    for ( auto k=0; k<3; k++ ) {
+      lmin[k] = MIN(lmin[k], xc[e][k]);
+      lmax[k] = MAX(lmax[k], xc[e][k]);
+    }
+  }
+  GComm::Allreduce(lmin.data(), gmin.data(), 3, T2GCDatatype<Ftype>() , GC_OP_MIN, comm_);
+  GComm::Allreduce(lmax.data(), gmax.data(), 3, T2GCDatatype<Ftype>() , GC_OP_MAX, comm_);
+
+  // Integralize isotropically, so that largest extent
+  // uses all key bits available per direction (limited
+  // by key generator's integer type):
+  nbits = MIN(BITSPERBYTE*sizeof(GKEY)/3, 30);
+  del = 0.0;
+  for ( auto k=0; k<3; k++ ) {
+    P0[k] = gmin[k];
+    del   = MAX(del, gmax[k]-gmin[k]);
+  }
+  if ( del <= 0.0 ) del = 1.0; // e.g., single element
+  for ( auto k=0; k<3; k++ ) dX[k] = del / static_cast<Ftype>((1U<<nbits) - 1);
+  gkey.setIntegralLen(P0, dX);
 
   gelemids_.resize(gelems_.size());
+  if ( gelems_.size() > 0 ) {
+    gkey.key(gelemids_.data(), xc.data(), gelems_.size());
+  }
   for ( auto e=0; e<gelems_.size(); e++ ) {
-    gelemids_[e] = gelems_[e]->elemid();
+    gelems_[e]->set_elemid(gelemids_[e]);
   }
 
 } // end of method set_elemids
@@ -58,6 +58,7 @@ public:
         void                do_elems(GTMatrix<GINT> &p,
                               GTVector<GTVector<Ftype>> &xnodes);           // compute elems from restart data
         void                set_partitioner(GDD_base<Ftype> *d);            // set and use GDD object
+        GDD_base<Ftype>    *get_partitioner() { return gdd_; }              // get GDD object
         void                set_basis(GTVector<GNBasis<GCTYPE,Ftype>*> &b); // set element basis
         void                periodize();                                     // periodize coords, if allowed
         void                unperiodize();                                   // un-periodize coords, if allow
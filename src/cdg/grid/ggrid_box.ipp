@@ -94,6 +94,13 @@ lshapefcn_             (NULLPTR)
     ne_  [j] = sne[j];
   }
 
+  // Use space-filling curve partitioner if requested; 
+  // else, use default linear slices:
+  GString spart = gridptree.getValue<GString>("partitioner","default");
+  if ( "default" != spart ) {
+    gdd_ = new GSFC_DD<Ftype>(this->nprocs_, GSFC_DD<Ftype>::str2type(spart));
+  }
+
   lshapefcn_ = new GShapeFcn_linear<Ftype>(GDIM);
   if ( GDIM == 2 ) {
     init2d();
@@ -148,7 +155,9 @@ std::ostream &operator<<(std::ostream &str, GGridBox<Types> &e)
 //**********************************************************************************
 //**********************************************************************************
 // METHOD : set_partitioner
-// DESC   : Set domain decomposition object
+// DESC   : Set domain decomposition object, and find this
+//          task's subdomain with it. Must be called prior to 
+//          grid_init. Grid takes ownership of object.
 // ARGS   : GDD_base pointer
 // RETURNS: none
 //**********************************************************************************
@@ -156,9 +165,13 @@ template<typename Types>
 void GGridBox<Types>::set_partitioner(GDD_base<Ftype> *gdd)
 {
   GEOFLOW_TRACE();
+  assert(this->gelems_.size() == 0 && "Grid already initialized");
 
+  if ( gdd_ != NULLPTR && gdd_ != gdd ) delete gdd_;
   gdd_ = gdd;
 
+  find_rank_subdomain();
+
 } // end of method set_partitioner
 
 
@@ -853,8 +866,12 @@ std::size_t GGridBox<Types>::max_duplicates() const {
 //**********************************************************************************
 //**********************************************************************************
 // METHOD : find_rank_subdomain
-// DESC   : Find this rank's default portion of global domain, and
-//          store in qmesh member data.
+// DESC   : Find this rank's portion of global domain, and
+//          store in qmesh/hmesh member data. If no partitioner 
+//          is set, the default is used: a linear slice of the
+//          lexicographic element ordering. Else, partitioner 
+//          is given global element centroids in lexicographic 
+//          order, and returns the rank's elements.
 // ARGS   : none.
 // RETURNS: none.
 //**********************************************************************************
@@ -862,25 +879,43 @@ template<typename Types>
 void GGridBox<Types>::find_rank_subdomain()
 {
   GEOFLOW_TRACE();
-  GSIZET          n=0, nglobal, nperrank, nthisrank, ntot, nxy;
-  GLONG           beg_lin, end_lin;
-  GLONG           ib, ie, jb, je, kb, ke;
+  GSIZET          n, nglobal, nperrank, nthisrank, nxy;
+  GLONG           beg_lin, i, j, k, l;
+  GTVector<GINT>  ilin;         // lexicographic ids of rank's elems
   GTPoint<Ftype> v0(ndim_);     // starting sph. point of elem
   GTPoint<Ftype> dv(ndim_);     // delta-point
   GTPoint<Ftype> dx(ndim_);
 
   nglobal = 1; // total num elements in global grid
   for( auto k=0; k<ne_.size(); k++ ) nglobal *= ne_[k];
- 
-  nperrank = nglobal / this->nprocs_; // #elems per rank
-  nthisrank = this->irank_ != this->nprocs_-1 ? nperrank : nglobal - (this->nprocs_-1)*nperrank;
-
+  nxy = ne_[0] * ne_[1];
 
  // Get uniform element sizes:
   for( auto k=0; k<ndim_; k++ ) {
     dx[k] = Lbox_[k] / static_cast<Ftype>(ne_[k]);
   }
 
+  // Find this rank's elements:
+  if ( gdd_ == NULLPTR ) {
+    nperrank = nglobal / this->nprocs_; // #elems per rank
+    nthisrank = this->irank_ != this->nprocs_-1 ? nperrank : nglobal - (this->nprocs_-1)*nperrank;
+    beg_lin = nperrank*this->irank_;
+    ilin.resize(nthisrank);
+    for ( n=0; n<nthisrank; n++ ) ilin[n] = beg_lin + n;
+  }
+  else {
+    ftcentroids_.resize(nglobal);
+    for ( l=0; l<nglobal; l++ ) {
+      k = l / nxy; j = (l - k*nxy) / ne_[0]; i = l % ne_[0];
+      ftcentroids_[l].resize(ndim_);
+      ftcentroids_[l].x1 = P0_.x1 + (i+0.5)*dx.x1;
+      ftcentroids_[l].x2 = P0_.x2 + (j+0.5)*dx.x2;
+      if ( ndim_ == 3 ) ftcentroids_[l].x3 = P0_.x3 + (k+0.5)*dx.x3;
+    }
+    gdd_->doDD(ftcentroids_, this->irank_, ilin);
+    nthisrank = ilin.size();
+  }
+
   if ( this->do_gbdy_test_ ) {
     this->testty_.resize(nthisrank); // elem type
     this->testid_.resize(nthisrank);  // id for type
@@ -891,18 +926,14 @@ void GGridBox<Types>::find_rank_subdomain()
   if ( ndim_ == 2 ) {
 
     qmesh_.resize(nthisrank);
-    beg_lin = nperrank*this->irank_; end_lin = beg_lin + nthisrank - 1;
-    jb = beg_lin/ne_[0]; je = end_lin/ne_[0];
-    for ( auto j=jb; j<=je; j++ ) {
-      ib = MAX(beg_lin-static_cast<GLONG>(j*ne_[0]),0); 
-      ie = MIN(end_lin-static_cast<GLONG>(j*ne_[0]),ne_[0]-1); 
-      for ( auto i=ib; i<=ie; i++ ) {
-        for ( auto l=0; l<4; l++ ) qmesh_[n][l].resize(ndim_);
-        v0.x1 = P0_.x1+i*dx.x1; v0.x2 = P0_.x2+j*dx.x2;
-                                         qmesh_[n].v1 = v0;
-        dv.x1 = dx.x1 ; dv.x2 = 0.0  ;   qmesh_[n].v2 = v0 + dv;
-        dv.x1 = dx.x1 ; dv.x2 = dx.x2;   qmesh_[n].v3 = v0 + dv;
-        dv.x1 = 0.0   ; dv.x2 = dx.x2;   qmesh_[n].v4 = v0 + dv;
+    for ( n=0; n<nthisrank; n++ ) {
+      j = ilin[n] / ne_[0]; i = ilin[n] % ne_[0];
+      for ( auto l=0; l<4; l++ ) qmesh_[n][l].resize(ndim_);
+      v0.x1 = P0_.x1+i*dx.x1; v0.x2 = P0_.x2+j*dx.x2;
+                                       qmesh_[n].v1 = v0;
+      dv.x1 = dx.x1 ; dv.x2 = 0.0  ;   qmesh_[n].v2 = v0 + dv;
+      dv.x1 = dx.x1 ; dv.x2 = dx.x2;   qmesh_[n].v3 = v0 + dv;
+      dv.x1 = 0.0   ; dv.x2 = dx.x2;   qmesh_[n].v4 = v0 + dv;
 
 if ( this->do_gbdy_test_ ) {
 if      ( i == 0        && j == 0        ) {
@@ -942,34 +973,21 @@ else {
   this->testid_[n] = -1; // interior id
 }
 } // end, do_gbdy_test_
-        n++;
-      }
     }
   } // end, ndim==2 test
   else if ( ndim_ == 3 ) {
     hmesh_.resize(nthisrank);
-    nxy = ne_[0] * ne_[1];
-    beg_lin = nperrank*this->irank_; end_lin = beg_lin + nthisrank - 1;
-    kb = beg_lin/nxy; ke = end_lin/nxy;
-    for ( auto k=kb; k<=ke; k++ ) { 
-      jb = MAX((beg_lin-static_cast<GLONG>(k*nxy))/ne_[0],0); 
-      je = MIN((end_lin-static_cast<GLONG>(k*nxy))/ne_[0],ne_[1]-1);
-      for ( auto j=jb; j<=je; j++ ) { 
-        ib = MAX(beg_lin-static_cast<GLONG>(k*nxy+j*ne_[0]),0); 
-        ie = MIN(end_lin-static_cast<GLONG>(k*nxy+j*ne_[0]),ne_[0]-1); 
-        for ( auto i=ib; i<=ie; i++ ) { 
-          v0.x1 = P0_.x1+i*dx.x1; v0.x2 = P0_.x2+j*dx.x2; v0.x3 = P0_.x3+k*dx.x3; 
-                                                          hmesh_[n].v1 = v0;
-          dv.x1 = dx.x1 ; dv.x2 = 0.0  ; dv.x3 = 0.0   ;  hmesh_[n].v2 = v0 + dv;
-          dv.x1 = dx.x1 ; dv.x2 = dx.x2; dv.x3 = 0.0   ;  hmesh_[n].v3 = v0 + dv;
-          dv.x1 = 0.0   ; dv.x2 = dx.x2; dv.x3 = 0.0   ;  hmesh_[n].v4 = v0 + dv;
-          dv.x1 = 0.0   ; dv.x2 = 0.0  ; dv.x3 = dx.x3 ;  hmesh_[n].v5 = v0 + dv;
-          dv.x1 = dx.x1 ; dv.x2 = 0.0  ; dv.x3 = dx.x3 ;  hmesh_[n].v6 = v0 + dv;
-          dv.x1 = dx.x1 ; dv.x2 = dx.x2; dv.x3 = dx.x3 ;  hmesh_[n].v7 = v0 + dv;
-          dv.x1 = 0.0   ; dv.x2 = dx.x2; dv.x3 = dx.x3 ;  hmesh_[n].v8 = v0 + dv;
-          n++;
-        }
-      }
+    for ( n=0; n<nthisrank; n++ ) { 
+      k = ilin[n] / nxy; j = (ilin[n] - k*nxy) / ne_[0]; i = ilin[n] % ne_[0];
+      v0.x1 = P0_.x1+i*dx.x1; v0.x2 = P0_.x2+j*dx.x2; v0.x3 = P0_.x3+k*dx.x3; 
+                                                      hmesh_[n].v1 = v0;
+      dv.x1 = dx.x1 ; dv.x2 = 0.0  ; dv.x3 = 0.0   ;  hmesh_[n].v2 = v0 + dv;
+      dv.x1 = dx.x1 ; dv.x2 = dx.x2; dv.x3 = 0.0   ;  hmesh_[n].v3 = v0 + dv;
+      dv.x1 = 0.0   ; dv.x2 = dx.x2; dv.x3 = 0.0   ;  hmesh_[n].v4 = v0 + dv;
+      dv.x1 = 0.0   ; dv.x2 = 0.0  ; dv.x3 = dx.x3 ;  hmesh_[n].v5 = v0 + dv;
+      dv.x1 = dx.x1 ; dv.x2 = 0.0  ; dv.x3 = dx.x3 ;  hmesh_[n].v6 = v0 + dv;
+      dv.x1 = dx.x1 ; dv.x2 = dx.x2; dv.x3 = dx.x3 ;  hmesh_[n].v7 = v0 + dv;
+      dv.x1 = 0.0   ; dv.x2 = dx.x2; dv.x3 = dx.x3 ;  hmesh_[n].v8 = v0 + dv;
     }
 
   } // end, ndim==3 test
@@ -40,7 +40,7 @@ class GGridFactory
 
 
 
-	static GGrid<Types>  *build(const geoflow::tbox::PropertyTree& ptree, GTVector<GNBasis<GCTYPE,Ftype>*> gbasis, IOBasePtr pIO, ObsTraits &obstraits, GC_COMM &comm);
+	static GGrid<Types>  *build(const geoflow::tbox::PropertyTree& ptree, GTVector<GNBasis<GCTYPE,Ftype>*> gbasis, IOBasePtr pIO, ObsTraits &obstraits, GC_COMM &comm, GDD_base<Ftype> *gdd=NULLPTR);
 
         static void   read_grid(const geoflow::tbox::PropertyTree& ptree, GTMatrix<GINT> &p, GTVector<GTVector<Ftype>> &xnodes, IOBasePtr pIO, ObsTraits &obstraits, GC_COMM &comm);
 
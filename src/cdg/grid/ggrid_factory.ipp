@@ -17,10 +17,14 @@
 //          pIO      : IO object
 //          obstraits: observer traits governing read in of grid
 //          comm     : communicator
+//          gdd      : domain decomposition object; if non-NULL, overrides
+//                     grid's partitioner, and grid takes ownership.
+//                     Not used for restarts with variable p, for which
+//                     the partition is that of the restart data.
 // RETURNS: GGrid object ptr
 //**********************************************************************************
 template<typename Types>
-GGrid<Types> *GGridFactory<Types>::build(const geoflow::tbox::PropertyTree& ptree, GTVector<GNBasis<GCTYPE,Ftype>*> gbasis, IOBasePtr pIO, ObsTraits &obstraits, GC_COMM &comm)
+GGrid<Types> *GGridFactory<Types>::build(const geoflow::tbox::PropertyTree& ptree, GTVector<GNBasis<GCTYPE,Ftype>*> gbasis, IOBasePtr pIO, ObsTraits &obstraits, GC_COMM &comm, GDD_base<Ftype> *gdd)
 {
 	GEOFLOW_TRACE();
   GSIZET  itindex = ptree.getValue<GSIZET>   ("restart_index", 0);
@@ -47,11 +51,15 @@ GGrid<Types> *GGridFactory<Types>::build(const geoflow::tbox::PropertyTree& ptre
     // constant:
     if      ( "grid_icos"   == gname   // 2d or 3d Icos grid
         ||    "grid_sphere" == gname ) {
-      grid = new GGridIcos<Types>(ptree, gbasis, comm);
+      GGridIcos<Types> *icos = new GGridIcos<Types>(ptree, gbasis, comm);
+      if ( gdd != NULLPTR ) icos->set_partitioner(gdd);
+      grid = icos;
       grid->grid_init();
     }
     else if ( "grid_box"    ==  gname ) { // 2d or 3d Cart grid
-      grid = new GGridBox<Types>(ptree, gbasis, comm);
+      GGridBox<Types> *box = new GGridBox<Types>(ptree, gbasis, comm);
+      if ( gdd != NULLPTR ) box->set_partitioner(gdd);
+      grid = box;
       grid->grid_init();
 
     }
@@ -65,6 +73,7 @@ GGrid<Types> *GGridFactory<Types>::build(const geoflow::tbox::PropertyTree& ptre
     // In this case, gbasis is interpreted as a 'pool' of 
     // basis functions with various orders. It is an error
     // if correct order is not found on restart:
+    if ( gdd != NULLPTR ) delete gdd;
     read_grid(ptree, p, xnodes, pIO, obstraits, comm);
     if      ( "grid_icos"   == gname   // 2d or 3d Icos grid
         ||    "grid_sphere" == gname ) {
@@ -77,6 +77,7 @@ public:
                               GTVector<GTVector<Ftype>> &xnodes);        // compute elems from restart data)
 
         void                set_partitioner(GDD_base<GTICOS> *d);         // set and use GDD object
+        GDD_base<GTICOS>   *get_partitioner() { return gdd_; }            // get GDD object
         GTVector<GTriangle<GTICOS>> 
                            &get_tmesh(){ return tmesh_;}                  // get complete triang. mesh
         GTVector    <GHex<GTICOS>> 
@@ -49,6 +49,13 @@ lshapefcn_                    (NULLPTR)
   ilevel_  = gridptree.getValue<GINT>("ilevel");
   sreftype_= gridptree.getValue<GString>("refine_type","GICOS_LAGRANGIAN");
 
+  // Use space-filling curve partitioner if requested; 
+  // else, default is created when elements are built:
+  GString spart = gridptree.getValue<GString>("partitioner","default");
+  if ( "default" != spart ) {
+    gdd_ = new GSFC_DD<GTICOS>(this->nprocs_, GSFC_DD<GTICOS>::str2type(spart));
+  }
+
   
   if ( ndim_ == 2 ) {
     assert(GDIM == 2 && "GDIM must be 2");
@@ -116,14 +123,17 @@ std::ostream &operator<<(std::ostream &str, GGridIcos<Types> &e)
 //**********************************************************************************
 //**********************************************************************************
 // METHOD : set_partitioner
-// DESC   : Set domain decomposition object
+// DESC   : Set domain decomposition object. Must be called prior 
+//          to grid_init. Grid takes ownership of object.
 // ARGS   : GDD_base pointer
 // RETURNS: none
 //**********************************************************************************
 template<typename Types> 
 void GGridIcos<Types>::set_partitioner(GDD_base<GTICOS> *gdd)
 {
+  assert(this->gelems_.size() == 0 && "Grid already initialized");
 
+  if ( gdd_ != NULLPTR && gdd_ != gdd ) delete gdd_;
   gdd_ = gdd;
 
 } // end of method set_partitioner
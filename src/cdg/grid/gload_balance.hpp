@@ -0,0 +1,92 @@
+//==================================================================================
+// Module       : gload_balance.hpp
+// Date         : 10/17/26
+// Description  : Encapsulates the methods and data associated with
+//                dynamic (in-run) load rebalancing. The compute cost of
+//                each task is measured over an interval of time steps
+//                as the wall time spent minus the time spent waiting
+//                for remote data in GGFX exchanges. If the ratio of the
+//                maximum to the mean task cost exceeds a threshold, the
+//                per-element weights of the grid's space-filling curve
+//                partitioner (GSFC_DD) are rescaled by the measured
+//                costs, and a new grid is built with the reweighted
+//                partition. Element data (e.g., state) are migrated
+//                from the old to the new grid by element id, so no
+//                restart is required.
+// Copyright    : Copyright 2026. Colorado State University. All rights reserved.
+// Derived From : none.
+//==================================================================================
+
+#if !defined(_GLOAD_BALANCE_HPP)
+#define _GLOAD_BALANCE_HPP
+
+#include <chrono>
+#include "gtypes.h"
+#include "gtvector.hpp"
+#include "gcomm.hpp"
+#include "ggfx.hpp"
+#include "gsfc_dd.hpp"
+#include "ggrid_factory.hpp"
+#include "tbox/property_tree.hpp"
+#include "tbox/tracer.hpp"
+
+
+template<typename TypePack>
+class GLoadBalance
+{
+public:
+        using Types      = TypePack;
+        using State      = typename Types::State;
+        using StateComp  = typename Types::StateComp;
+        using Grid       = typename Types::Grid;
+        using Ftype      = typename Types::Ftype;
+        using IOBasePtr  = typename GGridFactory<Types>::IOBasePtr;
+        using ObsTraits  = typename GGridFactory<Types>::ObsTraits;
+
+        static_assert(std::is_same<State,GTVector<GTVector<GFTYPE>*>>::value,
+               "State is of incorrect type");
+
+        // Load balancer traits:
+        struct Traits {
+          GSIZET     cycle_interval = 100;  // no. time cycles between imbalance checks
+          Ftype      threshold      = 1.1;  // max/mean task cost that triggers rebalance
+        };
+
+                           GLoadBalance() = delete;
+                           GLoadBalance(Traits &traits, GC_COMM comm);
+                          ~GLoadBalance();
+                           GLoadBalance(const GLoadBalance &a) = default;
+                           GLoadBalance &operator=(const GLoadBalance &) = default;
+
+        void               start(GGFX<Ftype> *ggfx=NULLPTR);     // start cost measurement
+        void               stop();                               // stop; accumulate cost
+        void               reset() { tcost_ = 0.0; }             // clear measured cost
+        Ftype              cost() { return tcost_; }             // local measured cost
+        Ftype              imbalance();                          // max/mean task cost
+        GBOOL              need_rebalance();                     // imbalance > threshold?
+        Grid              *rebalance(const geoflow::tbox::PropertyTree &ptree,
+                                     Grid &grid,
+                                     GTVector<GNBasis<GCTYPE,Ftype>*> &gbasis,
+                                     IOBasePtr pIO, ObsTraits &obstraits); // build rebalanced grid
+        GSIZET             nrebalanced() { return nrebal_; }     // no. rebalances done
+        Traits            &get_traits() { return traits_; }
+
+static  void               migrate(Grid &gfrom, const State &ufrom,
+                                   Grid &gto  , State &uto);     // move elem data to new grid
+
+private:
+// Private data:
+        Traits             traits_;     // traits
+        GC_COMM            comm_;       // communicator
+        GSIZET             nrebal_;     // no. rebalances done
+        Ftype              tcost_;      // accumulated local cost
+        double             twait0_;     // GGFX wait time at start
+        GGFX<Ftype>       *ggfx_;       // GGFX op being monitored
+        std::chrono::steady_clock::time_point
+                           tstart_;     // wall time at start
+
+};
+
+#include "gload_balance.ipp"
+
+#endif
@@ -0,0 +1,327 @@
+//==================================================================================
+// Module       : gload_balance.ipp
+// Date         : 10/17/26
+// Description  : Encapsulates the methods and data associated with
+//                dynamic (in-run) load rebalancing
+// Copyright    : Copyright 2026. Colorado State University. All rights reserved.
+// Derived From : none.
+//==================================================================================
+#include <algorithm>
+#include <cassert>
+
+
+//**********************************************************************************
+//**********************************************************************************
+// METHOD : Constructor method
+// DESC   :
+// ARGS   : traits: Traits structure
+//          comm  : communicator
+// RETURNS: none
+//**********************************************************************************
+template<typename Types>
+GLoadBalance<Types>::GLoadBalance(Traits &traits, GC_COMM comm)
+:
+traits_              (traits),
+comm_                  (comm),
+nrebal_                   (0),
+tcost_                  (0.0),
+twait0_                 (0.0),
+ggfx_               (NULLPTR)
+{
+  GEOFLOW_TRACE();
+} // end of constructor method
+
+
+//**********************************************************************************
+//**********************************************************************************
+// METHOD : Destructor method
+// DESC   :
+// ARGS   : none
+// RETURNS: none
+//**********************************************************************************
+template<typename Types>
+GLoadBalance<Types>::~GLoadBalance()
+{
+  GEOFLOW_TRACE();
+} // end, destructor
+
+
+//**********************************************************************************
+//**********************************************************************************
+// METHOD : start
+// DESC   : Start measuring compute cost of local subdomain
+// ARGS   : ggfx: GGFX op used during measurement; time waiting for
+//                remote data in its exchanges is not counted as cost.
+//                May be NULLPTR.
+// RETURNS: none.
+//**********************************************************************************
+template<typename Types>
+void GLoadBalance<Types>::start(GGFX<Ftype> *ggfx)
+{
+  GEOFLOW_TRACE();
+
+  ggfx_   = ggfx;
+  twait0_ = ggfx_ != NULLPTR ? ggfx_->wait_time() : 0.0;
+  tstart_ = std::chrono::steady_clock::now();
+
+} // end of method start
+
+
+//**********************************************************************************
+//**********************************************************************************
+// METHOD : stop
+// DESC   : Stop measuring compute cost, and accumulate cost since
+//          call to start
+// ARGS   : none.
+// RETURNS: none.
+//**********************************************************************************
+template<typename Types>
+void GLoadBalance<Types>::stop()
+{
+  GEOFLOW_TRACE();
+  double tt;
+
+  tt = std::chrono::duration<double>(std::chrono::steady_clock::now() - tstart_).count();
+  if ( ggfx_ != NULLPTR ) tt -= ggfx_->wait_time() - twait0_;
+  tcost_ += MAX(tt, 0.0);
+  ggfx_   = NULLPTR;
+
+} // end of method stop
+
+
+//**********************************************************************************
+//**********************************************************************************
+// METHOD : imbalance
+// DESC   : Compute load imbalance, max(cost)/mean(cost), over all
+//          tasks. Must be called by all tasks.
+// ARGS   : none.
+// RETURNS: imbalance; 1 if no cost has been measured
+//**********************************************************************************
+template<typename Types>
+typename Types::Ftype GLoadBalance<Types>::imbalance()
+{
+  GEOFLOW_TRACE();
+  GINT   nprocs = GComm::WorldSize(comm_);
+  Ftype  cmax, csum;
+
+  GComm::Allreduce(&tcost_, &cmax, 1, T2GCDatatype<Ftype>(), GC_OP_MAX, comm_);
+  GComm::Allreduce(&tcost_, &csum, 1, T2GCDatatype<Ftype>(), GC_OP_SUM, comm_);
+
+  return csum > 0.0 ? cmax*nprocs/csum : 1.0;
+
+} // end of method imbalance
+
+
+//**********************************************************************************
+//**********************************************************************************
+// METHOD : need_rebalance
+// DESC   : Is load imbalance above threshold? Must be called by
+//          all tasks.
+// ARGS   : none.
+// RETURNS: TRUE if rebalancing is needed; else FALSE
+//**********************************************************************************
+template<typename Types>
+GBOOL GLoadBalance<Types>::need_rebalance()
+{
+  GEOFLOW_TRACE();
+
+  return GComm::WorldSize(comm_) > 1 && imbalance() > traits_.threshold;
+
+} // end of method need_rebalance
+
+
+//**********************************************************************************
+//**********************************************************************************
+// METHOD : rebalance
+// DESC   : Build new grid whose partition balances the measured
+//          costs. Element weights of the grid's partitioner are
+//          rescaled s.t. the weights of each task sum to its measured
+//          cost, and a new grid is built using a copy of the
+//          reweighted partitioner. Measured costs are then reset.
+//          Grid must use a GSFC_DD partitioner, and must not
+//          have been built from restart data with variable p. Must
+//          be called by all tasks. Caller owns new grid, and
+//          must migrate data to it (see migrate).
+// ARGS   : ptree    : main property tree, as used to build grid
+//          grid     : current grid
+//          gbasis   : basis, as used to build grid
+//          pIO      : IO object, as used to build grid
+//          obstraits: observer traits, as used to build grid
+// RETURNS: new grid
+//**********************************************************************************
+template<typename Types>
+typename Types::Grid *GLoadBalance<Types>::rebalance(const geoflow::tbox::PropertyTree &ptree,
+                                                   Grid &grid,
+                                                   GTVector<GNBasis<GCTYPE,Ftype>*> &gbasis,
+                                                   IOBasePtr pIO, ObsTraits &obstraits)
+{
+  GEOFLOW_TRACE();
+  GINT             nprocs = GComm::WorldSize(comm_);
+  Ftype            imb;
+  GTVector<Ftype>  tcost(nprocs);
+  GSFC_DD<Ftype>  *gdd, *gold;
+  Grid            *gnew;
+
+  gold = dynamic_cast<GSFC_DD<Ftype>*>(grid.get_partitioner());
+  assert(gold != NULLPTR && "Rebalancing requires SFC partitioner");
+
+  imb = imbalance();
+
+  // Reweight copy of current partitioner with measured costs:
+  GComm::Allgather(&tcost_, 1, T2GCDatatype<Ftype>(), tcost.data(), 1, T2GCDatatype<Ftype>(), comm_);
+  gdd = new GSFC_DD<Ftype>(*gold);
+  gdd->rescale_weights(tcost);
+
+  // Build new grid; it takes ownership of gdd:
+  gnew = GGridFactory<Types>::build(ptree, gbasis, pIO, obstraits, comm_, gdd);
+
+  if ( GComm::WorldRank(comm_) == 0 ) {
+    std::cout << "GLoadBalance::rebalance: imbalance=" << imb << "; grid rebalanced" << std::endl;
+  }
+
+  tcost_ = 0.0;
+  nrebal_++;
+
+  return gnew;
+
+} // end of method rebalance
+
+
+//**********************************************************************************
+//**********************************************************************************
+// METHOD : migrate
+// DESC   : Move element data from one grid to another grid over the
+//          same elements, but with different partition. Elements are
+//          matched by element id (GGrid::elemids), and must have the
+//          same no. nodes on both grids. Every task first gathers the
+//          ids of all elements on the new grid, to find the
+//          destination of each of its elements; then, element data
+//          are exchanged in a single all-to-all. Must be called by
+//          all tasks.
+// ARGS   : gfrom: grid on which ufrom is defined
+//          ufrom: data on gfrom. NULL components are not migrated
+//          gto  : new grid
+//          uto  : data on gto; components corresponding to non-NULL
+//                 components of ufrom must be allocated, and are
+//                 resized here
+// RETURNS: none.
+//**********************************************************************************
+template<typename Types>
+void GLoadBalance<Types>::migrate(Grid &gfrom, const State &ufrom, Grid &gto, State &uto)
+{
+  GEOFLOW_TRACE();
+  GC_COMM          comm   = gto.get_comm();
+  GINT             nprocs = GComm::WorldSize(comm);
+  GINT             nloc, nc, r;
+  GSIZET           ib, ng, nn, m, off;
+  GKEY            *pk;
+  GTVector<GINT>   icomp, iproc, idest;
+  GTVector<GINT>   scount(nprocs), sdisp(nprocs), rcount(nprocs), rdisp(nprocs);
+  GTVector<GINT>   svcount(nprocs), svdisp(nprocs), rvcount(nprocs), rvdisp(nprocs);
+  GTVector<GINT>   ione(nprocs), idisp(nprocs);
+  GTVector<GSIZET> isort, itsort;
+  GTVector<GKEY>   gkeys, skeys, rkeys, tkeys;
+  GTVector<Ftype>  svals, rvals;
+  GTVector<GKEY>  &kfrom  = gfrom.elemids();
+  GTVector<GKEY>  &kto    = gto  .elemids();
+  typename Grid::GElemList
+                  *efrom  = &gfrom.elems();
+  typename Grid::GElemList
+                  *eto    = &gto  .elems();
+
+  assert(ufrom.size() <= uto.size());
+  for ( auto j=0; j<ufrom.size(); j++ ) {
+    if ( ufrom[j] == NULLPTR ) continue;
+    assert(uto[j] != NULLPTR && "Destination not allocated");
+    uto[j]->resizem(gto.ndof());
+    icomp.push_back(j);
+  }
+  nc = icomp.size();
+
+  // Gather ids of all elements on new grid, with owning tasks:
+  nloc = gto.nelems();
+  GComm::Allgather(&nloc, 1, T2GCDatatype<GINT>(), rcount.data(), 1, T2GCDatatype<GINT>(), comm);
+  rdisp[0] = 0;
+  for ( r=1; r<nprocs; r++ ) rdisp[r] = rdisp[r-1] + rcount[r-1];
+  ng = rdisp[nprocs-1] + rcount[nprocs-1];
+  gkeys.resize(ng);
+  iproc.resize(ng);
+  GComm::Allgatherv(kto.data(), nloc, T2GCDatatype<GKEY>(),
+                    gkeys.data(), rcount.data(), rdisp.data(), T2GCDatatype<GKEY>(), comm);
+  for ( r=0; r<nprocs; r++ ) {
+    for ( GINT j=0; j<rcount[r]; j++ ) iproc[rdisp[r]+j] = r;
+  }
+  gkeys.sortincreasing(isort);
+
+  // Find destination of each local element, and
+  // no. elements and data to send to each task:
+  idest.resize(gfrom.nelems());
+  scount = 0; svcount = 0;
+  for ( GSIZET e=0; e<gfrom.nelems(); e++ ) {
+    pk = std::lower_bound(gkeys.data(), gkeys.data()+ng, kfrom[e]);
+    assert(pk != gkeys.data()+ng && *pk == kfrom[e] && "Element not found on new grid");
+    idest[e] = iproc[isort[pk-gkeys.data()]];
+    scount [idest[e]] += 1;
+    svcount[idest[e]] += nc*(*efrom)[e]->nnodes();
+  }
+  sdisp[0] = 0; svdisp[0] = 0;
+  for ( r=1; r<nprocs; r++ ) {
+    sdisp [r] = sdisp [r-1] + scount [r-1];
+    svdisp[r] = svdisp[r-1] + svcount[r-1];
+  }
+
+  // Pack element ids and data, grouped by destination; data
+  // for each element are stored by component:
+  skeys.resize(gfrom.nelems());
+  svals.resize(nc*gfrom.ndof());
+  idisp = sdisp;
+  ione  = svdisp;
+  for ( GSIZET e=0; e<gfrom.nelems(); e++ ) {
+    r  = idest[e];
+    ib = (*efrom)[e]->igbeg();
+    nn = (*efrom)[e]->nnodes();
+    skeys[idisp[r]++] = kfrom[e];
+    for ( auto c=0; c<nc; c++ ) {
+      std::copy(ufrom[icomp[c]]->data()+ib, ufrom[icomp[c]]->data()+ib+nn, svals.data()+ione[r]);
+      ione[r] += nn;
+    }
+  }
+
+  // Exchange counts, then ids and data:
+  for ( r=0; r<nprocs; r++ ) { ione[r] = 1; idisp[r] = r; }
+  GComm::Alltoallv(scount.data() , ione.data(), idisp.data(), T2GCDatatype<GINT>(),
+                   rcount.data() , ione.data(), idisp.data(), T2GCDatatype<GINT>(), comm);
+  GComm::Alltoallv(svcount.data(), ione.data(), idisp.data(), T2GCDatatype<GINT>(),
+                   rvcount.data(), ione.data(), idisp.data(), T2GCDatatype<GINT>(), comm);
+  rdisp[0] = 0; rvdisp[0] = 0;
+  for ( r=1; r<nprocs; r++ ) {
+    rdisp [r] = rdisp [r-1] + rcount [r-1];
+    rvdisp[r] = rvdisp[r-1] + rvcount[r-1];
+  }
+  assert(rdisp[nprocs-1]+rcount[nprocs-1] == gto.nelems());
+  rkeys.resize(gto.nelems());
+  rvals.resize(nc*gto.ndof());
+  GComm::Alltoallv(skeys.data(), scount.data() , sdisp.data() , T2GCDatatype<GKEY>(),
+                   rkeys.data(), rcount.data() , rdisp.data() , T2GCDatatype<GKEY>(), comm);
+  GComm::Alltoallv(svals.data(), svcount.data(), svdisp.data(), T2GCDatatype<Ftype>(),
+                   rvals.data(), rvcount.data(), rvdisp.data(), T2GCDatatype<Ftype>(), comm);
+
+  // Unpack into local elements of new grid:
+  tkeys.resize(kto.size());
+  tkeys = kto;
+  tkeys.sortincreasing(itsort);
+  off = 0;
+  for ( GSIZET k=0; k<rkeys.size(); k++ ) {
+    pk = std::lower_bound(tkeys.data(), tkeys.data()+tkeys.size(), rkeys[k]);
+    assert(pk != tkeys.data()+tkeys.size() && *pk == rkeys[k] && "Element not found");
+    m  = itsort[pk-tkeys.data()];
+    ib = (*eto)[m]->igbeg();
+    nn = (*eto)[m]->nnodes();
+    for ( auto c=0; c<nc; c++ ) {
+      std::copy(rvals.data()+off, rvals.data()+off+nn, uto[icomp[c]]->data()+ib);
+      off += nn;
+    }
+  }
+  assert(off == rvals.size() && "Element sizes differ on new grid");
+
+} // end of method migrate
@@ -0,0 +1,75 @@
+//==================================================================================
+// Module       : gsfc_dd.hpp
+// Date         : 10/17/26
+// Description  : Domain decomposition object that orders element
+//                representations (e.g., centroids) along a space-filling
+//                curve (SFC), either Morton (Z-order), or Hilbert, and
+//                cuts the curve into contiguous pieces of as nearly
+//                equal total cost as possible, one for each task.
+//                Per-element cost weights (e.g., to account for
+//                varying expansion order, or terrain) may be set;
+//                each element has unit cost by default. Because
+//                neighbors along the curve are neighbors in space,
+//                subdomains are compact, and have smaller surface-to-
+//                volume ratios than those from linear (lexicographic)
+//                slices.
+// Copyright    : Copyright 2026. Colorado State University. All rights reserved
+// Derived From : GDD_base.
+//==================================================================================
+
+#if !defined(_GSFC_DD_HPP)
+#define _GSFC_DD_HPP
+#include "gtypes.h"
+#include "gtpoint.hpp"
+#include "gtvector.hpp"
+#include "gmorton_keygen.hpp"
+#include "gdd_base.hpp"
+
+enum GSFC_TYPE {GSFC_MORTON=0, GSFC_HILBERT};
+
+template<typename T>
+class GSFC_DD : public GDD_base<T>
+{
+
+public:
+
+                          GSFC_DD(GINT nprocs, GSFC_TYPE itype=GSFC_HILBERT);
+                          GSFC_DD(const GSFC_DD &);
+                         ~GSFC_DD();
+
+         GSFC_DD         &operator=(const GSFC_DD &g);
+
+
+         GSIZET           doDD(const GTVector<GTVector<T>> &x, GINT irank, GTVector<GINT> &iret );
+         GSIZET           doDD(const GTVector<GTPoint<T>>  &x, GINT irank, GTVector<GINT> &iret);
+
+         void             set_type(GSFC_TYPE itype) { itype_ = itype; }
+         GSFC_TYPE        get_type() { return itype_; }
+         void             set_weights(const GTVector<T> &w);              // set per-element costs
+         GTVector<T>     &get_weights() { return weights_; }
+         void             rescale_weights(const GTVector<T> &tcost);      // rescale by measured task costs
+         GTVector<GINT>  &owners() { return iproc_; }                    // task of each elem in last partition
+         void             keys(const GTVector<GTPoint<T>> &x,
+                               GTVector<GKEY> &key);                     // SFC keys for points
+         void             partition(const GTVector<GTPoint<T>> &x,
+                               GTVector<GINT> &iproc);                   // task id for each point
+
+static   GSFC_TYPE        str2type(const GString &stype);                // string to GSFC_TYPE
+
+private:
+         GSIZET           do_partition(const GTVector<GTPoint<T>> &x,
+                               GINT irank, GTVector<GINT> &iret);
+         void             split(const GTVector<GTPoint<T>> &x,
+                               GTVector<GSIZET> &isort);
+         GKEY             hilbert_key(GUINT ix[], GINT ndim, GINT nbits);
+
+GSFC_TYPE          itype_;    // curve type
+GTVector<T>        weights_;  // per-element cost weights; empty => unit weights
+GTVector<GSIZET>   isplit_;   // first position along curve owned by each task
+GTVector<GINT>     iproc_;    // owning task of each element in most recent partition
+
+};
+
+#include "gsfc_dd.ipp"
+
+#endif
@@ -0,0 +1,458 @@
+//==================================================================================
+// Module       : gsfc_dd.ipp
+// Date         : 10/17/26
+// Description  : Domain decomposition object that orders element
+//                representations (e.g., centroids) along a space-filling
+//                curve (SFC), either Morton (Z-order), or Hilbert, and
+//                cuts the curve into contiguous pieces of as nearly
+//                equal total cost as possible, one for each task.
+// Copyright    : Copyright 2026. Colorado State University. All rights reserved
+// Derived From : GDD_base.
+//==================================================================================
+#include "gsfc_dd.hpp"
+
+
+//**********************************************************************************
+//**********************************************************************************
+// METHOD : Constructor method (1)
+// DESC   : Instantiate with no. tasks, and curve type
+// ARGS   : nprocs: no. tasks/partitions
+//          itype : curve type
+// RETURNS: none
+//**********************************************************************************
+template<typename T>
+GSFC_DD<T>::GSFC_DD(GINT nprocs, GSFC_TYPE itype)
+:
+GDD_base<T>(nprocs),
+itype_       (itype)
+{
+  GEOFLOW_TRACE();
+} // end of constructor method (1)
+
+
+//**********************************************************************************
+//**********************************************************************************
+// METHOD : Copy constructor method
+// DESC   :
+// ARGS   : obj: object to copy
+// RETURNS: none
+//**********************************************************************************
+template<typename T>
+GSFC_DD<T>::GSFC_DD(const GSFC_DD &obj)
+:
+GDD_base<T>(obj)
+{
+  GEOFLOW_TRACE();
+  itype_   = obj.itype_;
+  weights_ = obj.weights_;
+  iproc_   = obj.iproc_;
+} // end, copy constructor
+
+
+//**********************************************************************************
+//**********************************************************************************
+// METHOD : Destructor method
+// DESC   :
+// ARGS   : none
+// RETURNS: none
+//**********************************************************************************
+template<typename T>
+GSFC_DD<T>::~GSFC_DD()
+{
+  GEOFLOW_TRACE();
+} // end, destructor
+
+
+//**********************************************************************************
+//**********************************************************************************
+// METHOD : Assignment operator
+// DESC   :
+// ARGS   : g: object to copy
+// RETURNS: this
+//**********************************************************************************
+template<typename T>
+GSFC_DD<T> &GSFC_DD<T>::operator=(const GSFC_DD &g)
+{
+  GEOFLOW_TRACE();
+  this->nprocs_ = g.nprocs_;
+  itype_        = g.itype_;
+  weights_      = g.weights_;
+  iproc_        = g.iproc_;
+
+  return *this;
+} // end, operator=
+
+
+//**********************************************************************************
+//**********************************************************************************
+// METHOD : str2type
+// DESC   : Convert string to GSFC_TYPE
+// ARGS   : stype: "sfc_morton", or "sfc_hilbert"
+// RETURNS: GSFC_TYPE
+//**********************************************************************************
+template<typename T>
+GSFC_TYPE GSFC_DD<T>::str2type(const GString &stype)
+{
+  GEOFLOW_TRACE();
+  GString serr = "GSFC_DD<T>::str2type: ";
+
+  if      ( "sfc_morton"  == stype ) return GSFC_MORTON;
+  else if ( "sfc_hilbert" == stype ) return GSFC_HILBERT;
+
+  std::cout << serr << "invalid curve type: " << stype << std::endl;
+  assert(FALSE);
+
+  return GSFC_HILBERT;
+
+} // end of method str2type
+
+
+//**********************************************************************************
+//**********************************************************************************
+// METHOD : set_weights
+// DESC   : Set per-element cost weights. These must be ordered
+//          as the element representations passed to doDD. If
+//          not set (or set to an empty vector), each element
+//          has unit cost.
+// ARGS   : w : weights, each > 0
+// RETURNS: none.
+//**********************************************************************************
+template<typename T>
+void GSFC_DD<T>::set_weights(const GTVector<T> &w)
+{
+  GEOFLOW_TRACE();
+
+  weights_.resize(w.size());
+  for ( GSIZET j=0; j<w.size(); j++ ) {
+    assert(w[j] > 0 && "Weights must be positive");
+    weights_[j] = w[j];
+  }
+
+} // end of method set_weights
+
+
+//**********************************************************************************
+//**********************************************************************************
+// METHOD : rescale_weights
+// DESC   : Update per-element cost weights from measured cost of
+//          each task's subdomain in the most recent partition, so 
+//          that the weights of the elements owned by task r sum to 
+//          tcost[r]. Within a task, relative weights are kept, so
+//          repeated rescaling refines the cost estimate of each
+//          element. Weights are normalized to have unit mean. Tasks 
+//          without a measured cost (tcost <= 0) keep their weights.
+//          A partition must have been computed with this object.
+// ARGS   : tcost: measured cost (e.g., compute time) of each task
+// RETURNS: none.
+//**********************************************************************************
+template<typename T>
+void GSFC_DD<T>::rescale_weights(const GTVector<T> &tcost)
+{
+  GEOFLOW_TRACE();
+  GINT         np = this->nprocs_;
+  GSIZET       n  = iproc_.size();
+  T            wsum;
+  GTVector<T>  wtask(np);
+
+  assert(n > 0 && "No partition computed");
+  assert(tcost.size() == np && "Invalid task cost vector");
+
+  if ( weights_.size() != n ) {
+    weights_.resize(n);
+    weights_ = 1.0;
+  }
+
+  // Find total weight of each task, and scale:
+  wtask = 0.0;
+  for ( GSIZET j=0; j<n; j++ ) wtask[iproc_[j]] += weights_[j];
+  for ( GSIZET j=0; j<n; j++ ) {
+    if ( tcost[iproc_[j]] > 0.0 ) weights_[j] *= tcost[iproc_[j]] / wtask[iproc_[j]];
+  }
+
+  // Normalize:
+  wsum = 0.0;
+  for ( GSIZET j=0; j<n; j++ ) wsum += weights_[j];
+  for ( GSIZET j=0; j<n; j++ ) weights_[j] *= static_cast<T>(n) / wsum;
+
+} // end of method rescale_weights
+
+
+//**********************************************************************************
+//**********************************************************************************
+// METHOD : doDD (1)
+// DESC   : Find elements owned by specified task
+// ARGS   : x    : coords (e.g. centroids) representing position of
+//                 each element, ordered s.t. x[k][j] is the kth coordinate
+//                 of element j. All tasks see the same array, so
+//                 it's 'global'
+//          irank: MPI task whose elements are requested
+//          iret : indirection indices into x that give the elements to
+//                 be 'ownded' by task irank, in curve order. Size
+//                 will be set here.
+// RETURNS: number of elements belonging to rank irank.
+//**********************************************************************************
+template<typename T>
+GSIZET GSFC_DD<T>::doDD(const GTVector<GTVector<T>> &x, GINT irank, GTVector<GINT> &iret)
+{
+  GEOFLOW_TRACE();
+  GTVector<GTPoint<T>> pts(x[0].size());
+
+  for ( GSIZET j=0; j<x[0].size(); j++ ) {
+    pts[j].resize(x.size());
+    for ( auto k=0; k<x.size(); k++ ) pts[j][k] = x[k][j];
+  }
+
+  return do_partition(pts, irank, iret);
+
+} // end of method doDD (1)
+
+
+//**********************************************************************************
+//**********************************************************************************
+// METHOD : doDD (2)
+// DESC   : Find elements owned by specified task
+// ARGS   : x    : points (e.g. centroids) representing position of each
+//                 element. All tasks see the same array.
+//          irank: MPI task whose elements are requested
+//          iret : indirection indices into x that give the elements to
+//                 be 'ownded' by task irank, in curve order. Size
+//                 will be set here.
+// RETURNS: number of elements belonging to rank irank.
+//**********************************************************************************
+template<typename T>
+GSIZET GSFC_DD<T>::doDD(const GTVector<GTPoint<T>> &x, GINT irank, GTVector<GINT> &iret)
+{
+  GEOFLOW_TRACE();
+
+  return do_partition(x, irank, iret);
+
+} // end of method doDD (2)
+
+
+//**********************************************************************************
+//**********************************************************************************
+// METHOD : partition
+// DESC   : Find owning task for each element
+// ARGS   : x    : points representing position of each element
+//          iproc: task id for each element; resized here
+// RETURNS: none.
+//**********************************************************************************
+template<typename T>
+void GSFC_DD<T>::partition(const GTVector<GTPoint<T>> &x, GTVector<GINT> &iproc)
+{
+  GEOFLOW_TRACE();
+  GTVector<GSIZET> isort;
+
+  split(x, isort);
+
+  iproc.resize(iproc_.size());
+  iproc = iproc_;
+
+} // end of method partition
+
+
+//**********************************************************************************
+//**********************************************************************************
+// METHOD : keys
+// DESC   : Compute SFC keys for points. Coordinates are integralized
+//          isotropically on the bounding box of the points, so that
+//          the largest extent uses all bits available per direction.
+// ARGS   : x  : points, all of the same dimension (<= 3)
+//          key: keys, one for each point; resized here
+// RETURNS: none.
+//**********************************************************************************
+template<typename T>
+void GSFC_DD<T>::keys(const GTVector<GTPoint<T>> &x, GTVector<GKEY> &key)
+{
+  GEOFLOW_TRACE();
+  GINT                    ndim, nbits;
+  GUINT                   ix[3], imax;
+  T                       del;
+
+  key.resize(x.size());
+  if ( x.size() == 0 ) return;
+
+  ndim  = x[0].dim();
+  assert(ndim > 0 && ndim <= 3 && "Invalid point dimension");
+  nbits = MIN(BITSPERBYTE*sizeof(GKEY)/ndim, 30);
+  imax  = (1U<<nbits) - 1;
+
+  GTPoint<T> P0(ndim), P1(ndim), dX(ndim);
+
+  // Find bounding box:
+  P0 = x[0]; P1 = x[0];
+  for ( GSIZET j=1; j<x.size(); j++ ) {
+    for ( auto k=0; k<ndim; k++ ) {
+      P0[k] = MIN(P0[k], x[j][k]);
+      P1[k] = MAX(P1[k], x[j][k]);
+    }
+  }
+  del = 0.0;
+  for ( auto k=0; k<ndim; k++ ) del = MAX(del, P1[k]-P0[k]);
+  if ( del <= 0.0 ) del = 1.0; // e.g., single element
+  for ( auto k=0; k<ndim; k++ ) dX[k] = del / static_cast<T>(imax);
+
+  if ( itype_ == GSFC_MORTON ) {
+    GMorton_KeyGen<GKEY,T>  gkey;
+    GTVector<GTPoint<T>>    xp(x.size());
+
+    for ( GSIZET j=0; j<x.size(); j++ ) { xp[j].resize(ndim); xp[j] = x[j]; }
+    gkey.setIntegralLen(P0, dX);
+    gkey.key(key.data(), xp.data(), x.size());
+  }
+  else {
+    for ( GSIZET j=0; j<x.size(); j++ ) {
+      for ( auto k=0; k<ndim; k++ ) {
+        ix[k] = static_cast<GUINT>((x[j][k] - P0[k])/dX[k] + 0.5);
+        ix[k] = MIN(ix[k], imax);
+      }
+      key[j] = hilbert_key(ix, ndim, nbits);
+    }
+  }
+
+} // end of method keys
+
+
+//**********************************************************************************
+//**********************************************************************************
+// METHOD : hilbert_key
+// DESC   : Compute Hilbert key for integer coordinates, from
+//          the transpose algorithm of Skilling, "Programming the
+//          Hilbert curve", AIP Conf. Proc. 707:381 (2004). The
+//          transposed index is then interleaved into a single key.
+// ARGS   : ix   : integer coordinates; modified on exit
+//          ndim : no. coordinates
+//          nbits: no. bits per coordinate
+// RETURNS: key
+//**********************************************************************************
+template<typename T>
+GKEY GSFC_DD<T>::hilbert_key(GUINT ix[], GINT ndim, GINT nbits)
+{
+  GUINT  M = 1U << (nbits-1), P, Q, t;
+  GKEY   key = 0;
+
+  // Inverse undo excess work:
+  for ( Q=M; Q>1; Q >>= 1 ) {
+    P = Q - 1;
+    for ( auto i=0; i<ndim; i++ ) {
+      if ( ix[i] & Q ) {
+        ix[0] ^= P;                    // invert
+      }
+      else {
+        t = (ix[0] ^ ix[i]) & P;       // exchange
+        ix[0] ^= t;
+        ix[i] ^= t;
+      }
+    }
+  }
+
+  // Gray encode:
+  for ( auto i=1; i<ndim; i++ ) ix[i] ^= ix[i-1];
+  t = 0;
+  for ( Q=M; Q>1; Q >>= 1 ) {
+    if ( ix[ndim-1] & Q ) t ^= Q - 1;
+  }
+  for ( auto i=0; i<ndim; i++ ) ix[i] ^= t;
+
+  // Interleave transposed index, most significant bits first:
+  for ( auto j=nbits-1; j>=0; j-- ) {
+    for ( auto i=0; i<ndim; i++ ) {
+      key = (key << 1) | static_cast<GKEY>((ix[i] >> j) & 1U);
+    }
+  }
+
+  return key;
+
+} // end of method hilbert_key
+
+
+//**********************************************************************************
+//**********************************************************************************
+// METHOD : do_partition
+// DESC   : Find elements owned by specified task
+// ARGS   : x    : points representing position of each element
+//          irank: MPI task whose elements are requested
+//          iret : indirection indices into x that give the elements to
+//                 be 'ownded' by task irank, in curve order.
+// RETURNS: number of elements belonging to rank irank.
+//**********************************************************************************
+template<typename T>
+GSIZET GSFC_DD<T>::do_partition(const GTVector<GTPoint<T>> &x, GINT irank, GTVector<GINT> &iret)
+{
+  GEOFLOW_TRACE();
+  GTVector<GSIZET> isort;
+
+  assert(irank >=0 && irank < this->nprocs_ && "Invalid rank");
+
+  split(x, isort);
+
+  iret.resize(isplit_[irank+1] - isplit_[irank]);
+  for ( GSIZET j=0; j<iret.size(); j++ ) iret[j] = isort[isplit_[irank]+j];
+
+  return iret.size();
+
+} // end of method do_partition
+
+
+//**********************************************************************************
+//**********************************************************************************
+// METHOD : split
+// DESC   : Sort elements along curve, and cut curve into nprocs
+//          contiguous pieces. Element j (in curve order), with cost
+//          w_j, goes to the task on whose interval of cumulative
+//          cost, [r W/nprocs, (r+1) W/nprocs), its midpoint falls,
+//          where W is the total cost. Each task is guaranteed at
+//          least one element if there are at least nprocs elements.
+//          Task r owns curve positions [isplit_[r], isplit_[r+1]),
+//          and the owner of each element is stored in iproc_.
+// ARGS   : x    : points representing position of each element
+//          isort: indices into x, in curve order; resized here
+// RETURNS: none.
+//**********************************************************************************
+template<typename T>
+void GSFC_DD<T>::split(const GTVector<GTPoint<T>> &x, GTVector<GSIZET> &isort)
+{
+  GEOFLOW_TRACE();
+  GINT             np = this->nprocs_, r;
+  GSIZET           n  = x.size();
+  T                cum, mid, w, wtot;
+  GTVector<GKEY>   key;
+
+  assert((weights_.size() == 0 || weights_.size() == n) && "Invalid weights");
+
+  // Order elements along curve:
+  keys(x, key);
+  isort.resize(n);
+  if ( n > 0 ) key.sortincreasing(isort);
+
+  // Find first element (in curve order) for each task:
+  wtot = 0.0;
+  for ( GSIZET j=0; j<n; j++ ) {
+    wtot += weights_.size() > 0 ? weights_[isort[j]] : 1.0;
+  }
+  isplit_.resize(np+1);
+  isplit_    = n;
+  isplit_[0] = 0;
+  cum = 0.0; r = 1;
+  for ( GSIZET j=0; j<n && r<np; j++ ) {
+    w   = weights_.size() > 0 ? weights_[isort[j]] : 1.0;
+    mid = cum + 0.5*w;
+    while ( r < np && mid*np >= r*wtot ) isplit_[r++] = j;
+    cum += w;
+  }
+
+  // Don't leave any task empty (can happen with very
+  // nonuniform weights):
+  if ( n >= np ) {
+    for ( r=1; r<np; r++ ) {
+      isplit_[r] = MAX(isplit_[r], isplit_[r-1]+1);
+      isplit_[r] = MIN(isplit_[r], n-(np-r));
+    }
+  }
+
+  iproc_.resize(n);
+  for ( r=0; r<np; r++ ) {
+    for ( GSIZET j=isplit_[r]; j<isplit_[r+1]; j++ ) iproc_[isort[j]] = r;
+  }
+
+} // end of method split
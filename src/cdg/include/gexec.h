@@ -0,0 +1,41 @@
+//==================================================================================
+// Module       : gexec.h
+// Date         : 10/17/26
+// Description  : Execution policy for thread-parallel loops. When the
+//                compiler is invoked with OpenMP (GEOFLOW_USE_OPENMP),
+//                loops marked with these macros are shared among threads;
+//                otherwise they expand to nothing, and loops run serially.
+//                Pointwise loops are threaded only if their trip count
+//                is at least GEXEC_OMP_MINLEN, so that short vectors do
+//                not pay for a parallel region. Loop bodies must not
+//                modify state shared across iterations (e.g., GTVector
+//                ranges); use non-owning GTVector views instead.
+// Copyright    : Copyright 2021. Colorado State University. All rights reserved.
+// Derived From : none.
+//==================================================================================
+#if !defined(_GEXEC_H)
+#define _GEXEC_H
+
+#if !defined(GEXEC_OMP_MINLEN)
+  # define GEXEC_OMP_MINLEN 16384 // min. trip count for threaded pointwise loops
+#endif
+
+#if defined(_OPENMP)
+  #define GEXEC_PRAGMA(x) _Pragma(#x)
+#else
+  #define GEXEC_PRAGMA(x)
+#endif
+
+// Pointwise loop of length n:
+#define GEXEC_PARALLEL_FOR(n) \
+        GEXEC_PRAGMA(omp parallel for schedule(static) if((n) >= GEXEC_OMP_MINLEN))
+
+// Pointwise loop of length n with reduction, e.g., (+:sum):
+#define GEXEC_PARALLEL_FOR_REDUCE(n,red) \
+        GEXEC_PRAGMA(omp parallel for schedule(static) if((n) >= GEXEC_OMP_MINLEN) reduction red)
+
+// Loop over ne elements, each doing a tensor-product operation:
+#define GEXEC_PARALLEL_FOR_ELEMS(ne) \
+        GEXEC_PRAGMA(omp parallel for schedule(static) if((ne) > 1))
+
+#endif // !defined(_GEXEC_H)
@@ -0,0 +1,122 @@
+//==================================================================================
+// Module       : gdiag_aggregator.hpp
+// Date         : 10/17/26
+// Description  : Collects the scalar diagnostic reductions of all
+//                diagnostic observers, and carries them out with a
+//                single non-blocking all-reduce per observation round.
+//                Each observer registers as a client, and registers an
+//                output stream (file) for each kind of row it writes.
+//                During a round, clients post local values for rows,
+//                each with its own reduction op (sum, max, min); when
+//                the last client is done, one reduction is posted,
+//                which completes while the next time step is taken.
+//                Reduced rows are formatted into an in-memory ring
+//                buffer on rank 0, and flushed to disk in batches,
+//                opening each file once per batch.
+// Copyright    : Copyright 2026. Colorado State University. All rights reserved.
+// Derived From : none.
+//==================================================================================
+
+#if !defined(_GDIAG_AGGREGATOR_HPP)
+#define _GDIAG_AGGREGATOR_HPP
+
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <vector>
+#include "gtypes.h"
+#include "gtvector.hpp"
+#include "gcomm.hpp"
+#include "tbox/tracer.hpp"
+
+
+template<typename T>
+class GDiagAggregator
+{
+public:
+        // Aggregator traits:
+        struct Traits {
+          GSIZET     nbuff = 256;   // no. rows buffered before writing to disk
+        };
+
+                           GDiagAggregator(const GDiagAggregator &a) = delete;
+                           GDiagAggregator &operator=(const GDiagAggregator &) = delete;
+
+static  GDiagAggregator   &instance();                          // get shared object
+
+        GINT               add_client(GC_COMM comm);            // register observer
+        void               remove_client(GINT id);              // de-register observer
+        GINT               add_stream(const GString &fname,
+                                      const GString &header,
+                                      GBOOL bsci=FALSE);        // register output file
+        void               post(GINT istream, GC_OP op, T t, T dt,
+                                const GTVector<T> &lvals,
+                                const GTVector<T> *div=NULLPTR); // post local row values
+        void               done(GINT id);                       // client done for round
+        void               flush();                             // complete, & write all rows
+
+        Traits            &get_traits() { return traits_; }
+        GSIZET             nreductions() { return nreduce_; }   // no. reductions posted
+        GSIZET             nwrites() { return nwrite_; }        // no. batch writes
+        GSIZET             nbuffered() { return rcount_; }      // no. rows awaiting write
+
+private:
+        // Row posted by a client:
+        struct GRow {
+          GINT             istream;     // output stream
+          GSIZET           ibeg;        // offset of row in reduction buffer
+          GINT             n;           // no. values
+          T                t;           // time
+          T                dt;          // time step
+          std::vector<T>   div;         // divisors applied after reduction
+        };
+        // Output stream:
+        struct GStream {
+          GString          fname;       // file name
+          GString          header;      // header, written if file is empty
+          GBOOL            bsci;        // print values in scientific format?
+          GBOOL            bchecked;    // checked for header?
+        };
+
+                           GDiagAggregator();
+                          ~GDiagAggregator();
+
+        void               start_();    // post reduction of round
+        void               complete_(); // wait for reduction; buffer rows
+        void               write_();    // write buffered rows to disk
+#if defined(GEOFLOW_USE_MPI)
+static  void               reduce_op_(void *in, void *inout, int *len, MPI_Datatype *dtype);
+#endif
+
+// Private data:
+        Traits             traits_;     // traits
+        GC_COMM            comm_;       // communicator
+        GINT               myrank_;     // rank in comm_
+        GBOOL              bpending_;   // reduction in flight?
+        GSIZET             nreduce_;    // no. reductions posted
+        GSIZET             nwrite_;     // no. batch writes
+        std::vector<GBOOL> bactive_;    // is client registered?
+        std::vector<GBOOL> bdone_;      // is client done in current round?
+        std::vector<T>     sbuff_;      // (op, value) pairs of current round
+        std::vector<T>     pbuff_;      // (op, value) pairs in flight
+        std::vector<T>     rbuff_;      // reduced pairs
+        std::vector<GRow>  rows_;       // rows of current round
+        std::vector<GRow>  prows_;      // rows in flight
+        std::vector<GStream>
+                           streams_;    // output streams
+        std::vector<GString>
+                           ring_;       // formatted rows (rank 0)
+        std::vector<GINT>  iring_;      // stream of each buffered row
+        GSIZET             rhead_;      // oldest buffered row
+        GSIZET             rcount_;     // no. buffered rows
+        GCReqHandle        hreq_;       // handle for reduction in flight
+#if defined(GEOFLOW_USE_MPI)
+        MPI_Op             mpiop_;      // (op, value)-pair reduction op
+        MPI_Datatype       mpitype_;    // (op, value)-pair data type
+#endif
+
+};
+
+#include "gdiag_aggregator.ipp"
+
+#endif
@@ -0,0 +1,430 @@
+//==================================================================================
+// Module       : gdiag_aggregator.ipp
+// Date         : 10/17/26
+// Description  : Collects the scalar diagnostic reductions of all
+//                diagnostic observers, and carries them out with a
+//                single non-blocking all-reduce per observation round.
+// Copyright    : Copyright 2026. Colorado State University. All rights reserved.
+// Derived From : none.
+//==================================================================================
+
+
+//**********************************************************************************
+//**********************************************************************************
+// METHOD : Constructor method
+// DESC   : Default constructor; private, see instance
+// ARGS   : none
+//**********************************************************************************
+template<typename T>
+GDiagAggregator<T>::GDiagAggregator()
+:
+comm_             (GC_COMM_WORLD),
+myrank_           (0),
+bpending_         (FALSE),
+nreduce_          (0),
+nwrite_           (0),
+rhead_            (0),
+rcount_           (0)
+#if defined(GEOFLOW_USE_MPI)
+,
+mpiop_            (MPI_OP_NULL),
+mpitype_          (MPI_DATATYPE_NULL)
+#endif
+{
+} // end of constructor method
+
+
+//**********************************************************************************
+//**********************************************************************************
+// METHOD : Destructor method
+// DESC   : Writes any remaining rows. Shared object is destroyed
+//          at exit, so MPI may have been finalized by then, and
+//          a reduction still in flight is lost; call flush before
+//          shutdown to avoid this.
+// ARGS   : none
+//**********************************************************************************
+template<typename T>
+GDiagAggregator<T>::~GDiagAggregator()
+{
+#if defined(GEOFLOW_USE_MPI)
+  int bfinal = 0;
+
+  MPI_Finalized(&bfinal);
+  if ( !bfinal ) {
+    if ( bpending_ ) complete_();
+    if ( mpiop_   != MPI_OP_NULL       ) MPI_Op_free  (&mpiop_);
+    if ( mpitype_ != MPI_DATATYPE_NULL ) MPI_Type_free(&mpitype_);
+  }
+#else
+  if ( bpending_ ) complete_();
+#endif
+  write_();
+
+} // end of destructor method
+
+
+//**********************************************************************************
+//**********************************************************************************
+// METHOD : instance
+// DESC   : Get shared aggregator, constructing it on first call
+// ARGS   : none
+// RETURNS: aggregator
+//**********************************************************************************
+template<typename T>
+GDiagAggregator<T> &GDiagAggregator<T>::instance()
+{
+  static GDiagAggregator<T> agg;
+
+  return agg;
+
+} // end of method instance
+
+
+//**********************************************************************************
+//**********************************************************************************
+// METHOD : add_client
+// DESC   : Register a client (observer). Each registered client
+//          must call done once per observation round, whether or
+//          not it posted anything; the round's reduction is started
+//          when all clients are done.
+// ARGS   : comm : communicator over which to reduce; must be the
+//                 same for all clients
+// RETURNS: client id
+//**********************************************************************************
+template<typename T>
+GINT GDiagAggregator<T>::add_client(GC_COMM comm)
+{
+  comm_   = comm;
+  myrank_ = GComm::WorldRank(comm_);
+
+  bactive_.push_back(TRUE);
+  bdone_  .push_back(FALSE);
+
+  return static_cast<GINT>(bactive_.size()) - 1;
+
+} // end of method add_client
+
+
+//**********************************************************************************
+//**********************************************************************************
+// METHOD : remove_client
+// DESC   : De-register client
+// ARGS   : id : client id, returned from add_client
+// RETURNS: none.
+//**********************************************************************************
+template<typename T>
+void GDiagAggregator<T>::remove_client(GINT id)
+{
+  assert(id >= 0 && id < bactive_.size() && "Invalid client id");
+
+  bactive_[id] = FALSE;
+  bdone_  [id] = FALSE;
+
+} // end of method remove_client
+
+
+//**********************************************************************************
+//**********************************************************************************
+// METHOD : add_stream
+// DESC   : Register output stream. Streams are identified by
+//          file name, so registering the same file again returns
+//          the existing stream.
+// ARGS   : fname : full file name; rows are appended
+//          header: header, written (as is) only if file is empty
+//          bsci  : if TRUE, print reduced values in scientific format
+//                  with 15 digits; else, in default format. Time and
+//                  time step are always printed in default format.
+// RETURNS: stream id
+//**********************************************************************************
+template<typename T>
+GINT GDiagAggregator<T>::add_stream(const GString &fname, const GString &header, GBOOL bsci)
+{
+  GStream s;
+
+  for ( auto j=0; j<streams_.size(); j++ ) {
+    if ( streams_[j].fname == fname ) return j;
+  }
+
+  s.fname    = fname;
+  s.header   = header;
+  s.bsci     = bsci;
+  s.bchecked = FALSE;
+  streams_.push_back(s);
+
+  return static_cast<GINT>(streams_.size()) - 1;
+
+} // end of method add_stream
+
+
+//**********************************************************************************
+//**********************************************************************************
+// METHOD : post
+// DESC   : Post local values for one row of a stream. Values are
+//          reduced over all tasks with op, then each is divided by
+//          corresponding member of div, if provided. Written row is
+//          t, dt, followed by the reduced values.
+// ARGS   : istream: stream id, returned from add_stream
+//          op     : reduction op: GC_OP_SUM, GC_OP_MAX, or GC_OP_MIN
+//          t      : time
+//          dt     : time step
+//          lvals  : local values
+//          div    : divisors applied after reduction; may be NULLPTR
+// RETURNS: none.
+//**********************************************************************************
+template<typename T>
+void GDiagAggregator<T>::post(GINT istream, GC_OP op, T t, T dt, const GTVector<T> &lvals, const GTVector<T> *div)
+{
+  assert(istream >= 0 && istream < streams_.size() && "Invalid stream id");
+  assert((op == GC_OP_SUM || op == GC_OP_MAX || op == GC_OP_MIN)
+      && "Invalid reduction op");
+  assert((div == NULLPTR || div->size() == lvals.size())
+      && "Invalid divisor vector");
+
+  GRow   row;
+  GSIZET n = sbuff_.size();
+
+  row.istream = istream;
+  row.ibeg    = n;
+  row.n       = lvals.size();
+  row.t       = t;
+  row.dt      = dt;
+  row.div.resize(lvals.size());
+  for ( auto j=0; j<lvals.size(); j++ ) {
+    row.div[j] = div != NULLPTR ? (*div)[j] : 1.0;
+  }
+  rows_.push_back(row);
+
+  sbuff_.resize(n+2*lvals.size());
+  for ( auto j=0; j<lvals.size(); j++ ) {
+    sbuff_[n+2*j  ] = static_cast<T>(op);
+    sbuff_[n+2*j+1] = lvals[j];
+  }
+
+} // end of method post
+
+
+//**********************************************************************************
+//**********************************************************************************
+// METHOD : done
+// DESC   : Client is done posting for this round. When last client
+//          is done, the reduction of all rows posted in this round
+//          is started, after completing that of the previous round.
+//          If no rows were posted, the previous reduction, if any,
+//          is completed, so results lag by at most one round.
+// ARGS   : id : client id, returned from add_client
+// RETURNS: none.
+//**********************************************************************************
+template<typename T>
+void GDiagAggregator<T>::done(GINT id)
+{
+  assert(id >= 0 && id < bactive_.size() && "Invalid client id");
+
+  bdone_[id] = TRUE;
+  for ( auto j=0; j<bactive_.size(); j++ ) {
+    if ( bactive_[j] && !bdone_[j] ) return;
+  }
+
+  for ( auto j=0; j<bdone_.size(); j++ ) bdone_[j] = FALSE;
+  if ( rows_.size() > 0 ) start_();
+  else if ( bpending_ ) complete_();
+
+} // end of method done
+
+
+//**********************************************************************************
+//**********************************************************************************
+// METHOD : flush
+// DESC   : Complete reductions, and write all buffered rows.
+//          Collective: must be called by all tasks.
+// ARGS   : none.
+// RETURNS: none.
+//**********************************************************************************
+template<typename T>
+void GDiagAggregator<T>::flush()
+{
+  GEOFLOW_TRACE();
+
+  if ( rows_.size() > 0 ) start_();
+  if ( bpending_ ) complete_();
+  write_();
+
+} // end of method flush
+
+
+//**********************************************************************************
+//**********************************************************************************
+// METHOD : start_
+// DESC   : Start reduction of current round's rows
+// ARGS   : none.
+// RETURNS: none.
+//**********************************************************************************
+template<typename T>
+void GDiagAggregator<T>::start_()
+{
+  GEOFLOW_TRACE();
+
+  if ( bpending_ ) complete_();
+
+  pbuff_.swap(sbuff_);
+  prows_.swap(rows_);
+  sbuff_.clear();
+  rows_ .clear();
+  rbuff_.resize(pbuff_.size());
+
+#if defined(GEOFLOW_USE_MPI)
+  if ( mpiop_ == MPI_OP_NULL ) {
+    // Each item is an (op, value) pair, so that the reduction
+    // cannot be split inside of a pair:
+    MPI_Type_contiguous(2, T2GCDatatype<T>(), &mpitype_);
+    MPI_Type_commit(&mpitype_);
+    MPI_Op_create(&GDiagAggregator<T>::reduce_op_, 1, &mpiop_);
+  }
+  MPI_Iallreduce(pbuff_.data(), rbuff_.data(), pbuff_.size()/2,
+                 mpitype_, mpiop_, comm_, &hreq_);
+#else
+  rbuff_ = pbuff_;
+#endif
+  bpending_ = TRUE;
+  nreduce_++;
+
+} // end of method start_
+
+
+//**********************************************************************************
+//**********************************************************************************
+// METHOD : complete_
+// DESC   : Wait for reduction in flight, and store formatted rows
+//          in ring buffer (on rank 0). If buffer becomes full, it
+//          is written to disk.
+// ARGS   : none.
+// RETURNS: none.
+//**********************************************************************************
+template<typename T>
+void GDiagAggregator<T>::complete_()
+{
+  GEOFLOW_TRACE();
+
+  if ( !bpending_ ) return;
+
+#if defined(GEOFLOW_USE_MPI)
+  GComm::Wait(&hreq_, 1);
+#endif
+  bpending_ = FALSE;
+
+  if ( myrank_ != 0 ) {
+    prows_.clear();
+    return;
+  }
+
+  if ( rcount_ == 0 && ring_.size() != MAX(traits_.nbuff,1) ) {
+    ring_ .resize(MAX(traits_.nbuff,1));
+    iring_.resize(ring_.size());
+    rhead_ = 0;
+  }
+
+  for ( auto j=0; j<prows_.size(); j++ ) {
+    GRow              &row = prows_[j];
+    std::ostringstream os;
+
+    os << row.t << "    " << row.dt;
+    if ( streams_[row.istream].bsci ) os << std::scientific << std::setprecision(15);
+    for ( auto i=0; i<row.n; i++ ) {
+      os << "    " << rbuff_[row.ibeg+2*i+1] / row.div[i];
+    }
+    os << std::endl;
+
+    if ( rcount_ == ring_.size() ) write_();
+    ring_ [(rhead_+rcount_) % ring_.size()] = os.str();
+    iring_[(rhead_+rcount_) % ring_.size()] = row.istream;
+    rcount_++;
+  }
+  prows_.clear();
+
+  if ( rcount_ == ring_.size() ) write_();
+
+} // end of method complete_
+
+
+//**********************************************************************************
+//**********************************************************************************
+// METHOD : write_
+// DESC   : Write all buffered rows to disk (rank 0 only), opening
+//          each stream's file once. Header is written if the file
+//          is empty when it's first written to.
+// ARGS   : none.
+// RETURNS: none.
+//**********************************************************************************
+template<typename T>
+void GDiagAggregator<T>::write_()
+{
+  GEOFLOW_TRACE();
+
+  if ( myrank_ != 0 || rcount_ == 0 ) return;
+
+  GSIZET        k;
+  std::ofstream ios;
+
+  for ( auto s=0; s<streams_.size(); s++ ) {
+    for ( k=0; k<rcount_ && iring_[(rhead_+k) % ring_.size()] != s; k++ );
+    if ( k == rcount_ ) continue; // no rows for this stream
+
+    ios.open(streams_[s].fname, std::ios_base::app);
+    if ( !ios.is_open() ) {
+      std::cout << "GDiagAggregator::write_: cannot open file "
+                << streams_[s].fname << std::endl;
+      continue;
+    }
+    if ( !streams_[s].bchecked ) {
+      if ( ios.tellp() == 0 ) ios << streams_[s].header;
+      streams_[s].bchecked = TRUE;
+    }
+    for ( ; k<rcount_; k++ ) {
+      if ( iring_[(rhead_+k) % ring_.size()] == s ) {
+        ios << ring_[(rhead_+k) % ring_.size()];
+      }
+    }
+    ios.close();
+  }
+  rhead_  = (rhead_+rcount_) % ring_.size();
+  rcount_ = 0;
+  nwrite_++;
+
+} // end of method write_
+
+
+#if defined(GEOFLOW_USE_MPI)
+//**********************************************************************************
+//**********************************************************************************
+// METHOD : reduce_op_
+// DESC   : MPI user op reducing (op, value) pairs; each value is
+//          reduced with its own op, which is carried along unchanged
+// ARGS   : in   : input pairs
+//          inout: input/output pairs
+//          len  : no. pairs
+//          dtype: data type (pair type)
+// RETURNS: none.
+//**********************************************************************************
+template<typename T>
+void GDiagAggregator<T>::reduce_op_(void *in, void *inout, int *len, MPI_Datatype *dtype)
+{
+  T *a = static_cast<T*>(in);
+  T *b = static_cast<T*>(inout);
+
+  for ( auto j=0; j<*len; j++ ) {
+    switch ( static_cast<GC_OP>(b[2*j]) ) {
+      case GC_OP_SUM:
+        b[2*j+1] += a[2*j+1];
+        break;
+      case GC_OP_MAX:
+        b[2*j+1] = MAX(a[2*j+1], b[2*j+1]);
+        break;
+      case GC_OP_MIN:
+        b[2*j+1] = MIN(a[2*j+1], b[2*j+1]);
+        break;
+      default:
+        break;
+    }
+  }
+
+} // end of method reduce_op_
+#endif
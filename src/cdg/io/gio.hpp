@@ -1,13 +1,20 @@
 //==================================================================================
 // Module       : gio.hpp
 // Date         : 1/20/20 (DLR)
-// Description  : GIO object encapsulating methods for POSIX and collective IO
+// Description  : GIO object encapsulating methods for POSIX and collective IO.
+//                If traits.async is set, collective writes are non-blocking:
+//                the state is copied to one of GIO_NBUFF staging buffers,
+//                and the data write completes in the background. A write
+//                waits only if its staging buffer is still in flight.
 // Copyright    : Copyright 2020. Colorado State University. All rights reserved.
 // Derived From : IOBase.
 //==================================================================================
 #if !defined(_GIO_HPP)
 #define _GIO_HPP
 
+#include <algorithm>
+#include <vector>
+#include <unordered_map>
 #include "gtvector.hpp"
 #include "pdeint/io_base.hpp"
 #include "tbox/property_tree.hpp"
@@ -16,6 +23,10 @@
 using namespace geoflow::pdeint;
 using namespace std;
 
+#if !defined(GIO_NBUFF)
+  # define GIO_NBUFF 2 // no. staging buffers for async writes
+#endif
+
 template<typename TypePack>
 class GIO : public IOBase<TypePack>
 {
@@ -49,8 +60,25 @@ public:
         void               write_state_impl(std::string filename, StateInfo &info, const State &u);
         void               read_state_impl(std::string filename, StateInfo &info, State &u, bool bstate);
         void               read_state_info_impl(std::string filename, StateInfo &info);
+        void               flush_impl();
+        void               set_grid_impl(Grid &grid);
+
+        GSIZET             nremapped() const { return nremap_; } // no. reads needing key remap
 
 private:
+        // Staging buffer for asynchronous writes:
+        struct GAsyncBuff {
+          GBOOL                     bbusy = FALSE; // write in flight?
+          GSIZET                    nbpost= 0;     // no. data bytes posted
+          GTVector<GTVector<Ftype>> ustage;        // copy of state written
+          State                     pstage;        // ptrs to ustage
+          std::vector<GString>      fnames;        // files in flight
+          #if defined(GEOFLOW_USE_MPI)
+          std::vector<MPI_File>     fh;            // one per file in flight
+          std::vector<MPI_Request>  req;           // one per field in flight
+          #endif
+        };
+
 // Private methods:
         void               init();
         void               update_type(StateInfo &);
@@ -58,24 +86,39 @@ private:
 //      void               read_state_coll  (StateInfo &info,       State  &u);
         GSIZET             write_posix(GString filename, StateInfo &info, const GTVector<Ftype> &u);
         GSIZET             read_posix (GString filename, StateInfo &info,       GTVector<Ftype> &u, bool bstate);
-        GSIZET             write_coll (GString filename, StateInfo &info, const State           &u);
+        GSIZET             write_coll (GString filename, StateInfo &info, const State           &u, GINT ibuff=-1);
         GSIZET             read_coll  (GString filename, StateInfo &info,       State           &u, bool bstate);
         GSIZET             read_header(GString filename, StateInfo &info, Traits &traits);
         GSIZET             write_header_posix(GString fn, StateInfo &info, Traits &traits);
         #if defined(GEOFLOW_USE_MPI)
-        GSIZET             write_header_coll(GString fn, StateInfo &info, Traits &traits);
+        GSIZET             write_header_coll(MPI_File fh, StateInfo &info, Traits &traits);
+        GSIZET             read_header_coll (MPI_File fh, StateInfo &info, Traits &traits);
+        MPI_Datatype       state_type(GINT nf);
+        MPI_Datatype       mem_type  (const State &u, GINT nf);
+        GBOOL              same_layout(const StateInfo &info);
+        void               remap_types(const StateInfo &info, const Traits &traits,
+                                       const State &u, GINT nf, 
+                                       MPI_Datatype &ftype, MPI_Datatype &mtype);
         #endif
         GSIZET             sz_header(const StateInfo &info, const Traits &traits);
         void               resize(GINT n);
+        GINT               stage(const State &u);
+        void               wait_buff(GINT ibuff);
 
 
 // Private data:
         GBOOL              bInit_;      // object initialized?
         GINT               myrank_;     // task's rank
         GINT               nfname_;
-        GSIZET             nbgdof_;     // total # global dof bytes
+        GSIZET             nremap_;     // no. reads that remapped elements by key
+        GSIZET             elem_disp_;  // offset of local elems among all tasks
+        GINT               state_disp_; // offset of local dof in global comp
+        GINT               state_extent_;// no. local dof in comp
+        GINT               state_gsize_;// no. global dof in comp
         #if defined(GEOFLOW_USE_MPI)
-          MPI_Datatype     mpi_state_type_;
+          MPI_Info         mpi_info_;   // MPI-IO hints
+          std::vector<MPI_Datatype>
+                           mpi_state_types_;// file types, indexed by no. comps
         #endif
         GC_COMM            comm_;
         std::stringstream  svarname_;
@@ -83,6 +126,9 @@ private:
         char              *cfname_;
         std::stringstream  spformat_;   // POSIX format
         std::stringstream  scformat_;   // collective format
+        GINT               ibuff_;      // most recently staged async buffer
+        std::vector<GAsyncBuff>
+                           abuff_;      // async staging buffers
 
 };
 
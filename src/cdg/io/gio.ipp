@@ -23,7 +23,9 @@ bInit_                     (FALSE),
 myrank_   (GComm::WorldRank(comm)),
 comm_                       (comm),
 cfname_                  (NULLPTR),
-nfname_                        (0)
+nfname_                        (0),
+nremap_                        (0),
+ibuff_                        (-1)
 { 
   GEOFLOW_TRACE();
 #if !defined(GEOFLOW_USE_MPI)
@@ -45,11 +47,47 @@ GIO<Types>::~GIO()
 { 
   GEOFLOW_TRACE();
 #if defined(GEOFLOW_USE_MPI)
-  MPI_Type_free(&mpi_state_type_);
+  GINT bfinal;
+  MPI_Finalized(&bfinal);
+  if ( !bfinal ) { // else, must have been flushed already
+    flush_impl();
+    for ( auto j=0; j<mpi_state_types_.size(); j++ ) {
+      if ( mpi_state_types_[j] != MPI_DATATYPE_NULL ) MPI_Type_free(&mpi_state_types_[j]);
+    }
+    if ( mpi_info_ != MPI_INFO_NULL ) MPI_Info_free(&mpi_info_);
+  }
 #endif
 } // end of destructor method
 
 
+//**********************************************************************************
+//**********************************************************************************
+// METHOD     : set_grid_impl
+// DESCRIPTION: Re-target object to new grid (already set in base), 
+//              e.g., after repartitioning. Pending writes are 
+//              completed, and the cached layout is recomputed.
+//              Must be called by all tasks.
+// ARGUMENTS  : grid: new grid
+// RETURNS    : none.
+//**********************************************************************************
+template<typename Types>
+void GIO<Types>::set_grid_impl(Grid &grid)
+{
+  GEOFLOW_TRACE();
+
+  flush_impl();
+#if defined(GEOFLOW_USE_MPI)
+  for ( auto j=0; j<mpi_state_types_.size(); j++ ) {
+    if ( mpi_state_types_[j] != MPI_DATATYPE_NULL ) MPI_Type_free(&mpi_state_types_[j]);
+  }
+  mpi_state_types_.clear();
+  if ( mpi_info_ != MPI_INFO_NULL ) MPI_Info_free(&mpi_info_);
+#endif
+  init();
+
+} // end, set_grid_impl
+
+
 //**********************************************************************************
 //**********************************************************************************
 // METHOD     : update_type
@@ -91,43 +129,52 @@ void GIO<Types>::init()
 {
   GEOFLOW_TRACE();
 
+#if defined(GEOFLOW_USE_MPI)
+  mpi_info_ = MPI_INFO_NULL;
+#endif
   if ( this->traits_.io_type != IOBase<Types>::GIO_COLL ) {
     bInit_ = TRUE;
     return; // nothing more to do
   }
 
 
-  GINT             iret, state_disp, state_extent, sztot;
+  GINT             iret;
   GSIZET           ndof  =this->grid_->ndof();
   GSIZET           nelems=this->grid_->nelems();
   GTVector<GSIZET> extent;
 
   extent.resize(GComm::WorldSize(comm_));
 
+  // Get offset of local elements among all tasks:
+  GComm::Allgather(&nelems, 1, T2GCDatatype<GSIZET>(), extent.data(), 1, T2GCDatatype<GSIZET>(), comm_);
+  elem_disp_ = myrank_ == 0 ? 0 : extent.sum(0,myrank_-1);
+
   // Get extents of a single state component on each task:
   GComm::Allgather(&ndof, 1, T2GCDatatype<GSIZET>(), extent.data(), 1, T2GCDatatype<GSIZET>(), comm_);
 
   if ( myrank_ == 0 ) {
-    state_disp   = 0; // count
-    state_extent = extent[0]; // count
+    state_disp_   = 0; // count
+    state_extent_ = extent[0]; // count
   }
   else {
-    state_disp   = extent.sum(0,myrank_-1); // count
-    state_extent = extent[myrank_]; // count
+    state_disp_   = extent.sum(0,myrank_-1); // count
+    state_extent_ = extent[myrank_]; // count
   }
-  nbgdof_ = extent.sum()*sizeof(Ftype); // no. bytes of single state comp
+  state_gsize_ = extent.sum(); // count of single state comp
 
 
 #if defined(GEOFLOW_USE_MPI)
-//MPI_Type_free(&mpi_state_type_);
-
-
-  sztot = extent.sum();
-  iret = MPI_Type_create_subarray(1, &sztot, &state_extent, &state_disp, MPI_ORDER_C, T2GCDatatype<Ftype>(), &mpi_state_type_);
-  assert(iret == MPI_SUCCESS);
-  iret = MPI_Type_commit(&mpi_state_type_);
-  assert(iret == MPI_SUCCESS);
+  // Set MPI-IO hints, used for all file opens & views:
+  if ( this->traits_.hints.size() > 0 ) {
+    iret = MPI_Info_create(&mpi_info_);
+    assert(iret == MPI_SUCCESS);
+    for ( auto j=0; j<this->traits_.hints.size(); j++ ) {
+      MPI_Info_set(mpi_info_, this->traits_.hints[j].first.c_str(), 
+                              this->traits_.hints[j].second.c_str());
+    }
+  }
 
+  if ( this->traits_.async ) abuff_.resize(GIO_NBUFF);
 #endif
   bInit_ = TRUE;
 
@@ -143,6 +190,8 @@ void GIO<Types>::init()
 //          when needed, then it's an error.
 //          Note: if info.sttype > 0, then we assume we are printing a 
 //          grid, and the filename is created without the time index tag.
+//          If traits.async is set, collective writes return once u
+//          is staged and the data writes are posted; see flush_impl.
 // ARGS   : filepref: used if traits.multivar > 0 to specify file name for
 //                    all state variables. This works only if we GTypes is GIO_COLL.
 //                    If traits.multivar ==0, individual filename refixes are provided 
@@ -156,6 +205,7 @@ void GIO<Types>::write_state_impl(std::string filepref, StateInfo &info, const S
 {
   GEOFLOW_TRACE();
   GString        serr = "write_state_impl: ";
+  GINT           ibuff;
   GSIZET         nb, nc, nd;
   GTVector<GTVector<Ftype>>
                 *xnodes = &(this->grid_->xNodes());
@@ -193,6 +243,10 @@ void GIO<Types>::write_state_impl(std::string filepref, StateInfo &info, const S
     for ( auto j=0; j<info.porder.size(2); j++ ) info.porder(i,j) = (*elems)[i]->order(j);
   }
 
+  // If async, write staged copy of u, so that caller may modify u:
+  ibuff = abuff_.size() > 0 ? stage(u) : -1;
+  const State &uw = ibuff < 0 ? u : abuff_[ibuff].pstage;
+
   if ( !this->traits_.multivar ) { // one state comp per file
     assert(info.svars.size() >= u.size());
     // Cycle over all fields, and write:
@@ -211,8 +265,8 @@ void GIO<Types>::write_state_impl(std::string filepref, StateInfo &info, const S
         sprintf(cfname_, scformat_.str().c_str(), info.odir.c_str(),
                 svarname_.str().c_str(), info.index);
         fname_.assign(cfname_);
-        ostate[0] = u[j];
-        nb = write_coll(fname_, info, ostate);
+        ostate[0] = uw[j];
+        nb = write_coll(fname_, info, ostate, ibuff);
       }
       nd = sz_header(info,this->traits_) + u[j]->size()*sizeof(Ftype);
       assert(nb == nd && "Incorrect number of bytes written");
@@ -225,7 +279,8 @@ void GIO<Types>::write_state_impl(std::string filepref, StateInfo &info, const S
     svarname_ << filepref;
     sprintf(cfname_, scformat_.str().c_str(), info.odir.c_str(),
             svarname_.str().c_str(), info.index);
-    nb = write_coll(fname_, info, u);
+    fname_.assign(cfname_);
+    nb = write_coll(fname_, info, uw, ibuff);
     nd = sz_header(info,this->traits_) + u.size()*u[0]->size()*sizeof(Ftype);
     assert(nb == nd && "Incorrect number of bytes written");
   }
@@ -259,6 +314,8 @@ void GIO<Types>::read_state_impl(std::string filepref, StateInfo &info, State  &
   assert(bInit_ && "Object uninitialized");
   assert(info.icomptype.size() >= u.size() && "Stateinfo structure invalid");
 
+  flush_impl(); // file may still be in flight
+
   update_type(info);
 
   nc = this->grid_->gtype() == GE_2DEMBEDDED ? GDIM+1 : GDIM; 
@@ -301,6 +358,7 @@ void GIO<Types>::read_state_impl(std::string filepref, StateInfo &info, State  &
     svarname_ << filepref;
     sprintf(cfname_, scformat_.str().c_str(), info.idir.c_str(),
             svarname_.str().c_str(), info.index);
+    fname_.assign(cfname_);
     read_coll(fname_, info, u, bstate);
 
   }
@@ -326,6 +384,7 @@ void GIO<Types>::read_state_info_impl(std::string filename, StateInfo &info)
   Traits               ttraits;
 
 
+  flush_impl(); // file may still be in flight
   nh  = read_header(filename, info, ttraits);
 
   assert( nh == sz_header(info,this->traits_) );
@@ -507,70 +566,336 @@ GSIZET GIO<Types>::write_header_posix(GString filename, StateInfo &info, Traits
 //**********************************************************************************
 //**********************************************************************************
 // METHOD : write_header_coll
-// DESC   : Write GIO MPI file header. Note file pointer position 
-//          may be changed on exit.
+// DESC   : Write GIO MPI file header to open file, at displacement 0.
+//          Rank 0 writes the fixed-size part, and then each task
+//          writes the keys of its elements, in task order. File 
+//          view must be the default.
 // ARGS   : 
-//          filename : filename
+//          fh       : open file handle
 //          info     : StateInfo structure, filled with what header provides
 //          traits   : object's traits
 // RETURNS: no. header bytes written
 //**********************************************************************************
 template<typename Types>
-GSIZET GIO<Types>::write_header_coll(GString filename, StateInfo &info, Traits &traits)
+GSIZET GIO<Types>::write_header_coll(MPI_File fh, StateInfo &info, Traits &traits)
 {
   GEOFLOW_TRACE();
   GString serr ="write_header: ";
-  GINT       nh, imulti, iret;
-  GSIZET     nb, numr;
-  MPI_File   fp;
+  GINT       nh, imulti;
+  GSIZET     nb, gnb, numr;
+  MPI_Offset off;
   MPI_Status status;
 
   
-  iret = MPI_File_open(comm_, filename.c_str(), MPI::MODE_CREATE|MPI::MODE_WRONLY, MPI::INFO_NULL, &fp);
-  assert(iret == MPI_SUCCESS && "MPI_File_open failure");
-
-  nb = sz_header(info,traits);
+  nb = 0;
   if ( myrank_ == 0 ) {
     imulti = static_cast<GINT>(traits.multivar);
-    nb = 0;
-    MPI_File_seek(fp, 0, MPI_SEEK_SET); // set to 0-displacement
+    off = 0;
     
-    MPI_File_write(fp, &traits.ivers   , 1   , T2GCDatatype  <GINT>(), &status); 
-        MPI_Get_count(&status, MPI_BYTE, &nh);  nb += nh;
-    MPI_File_write(fp, &traits.dim     , 1   , T2GCDatatype  <GINT>(), &status); 
-        MPI_Get_count(&status, MPI_BYTE, &nh);  nb += nh;
-    MPI_File_write(fp, &info.nelems    , 1   , T2GCDatatype<GSIZET>(), &status); 
-        MPI_Get_count(&status, MPI_BYTE, &nh); nb += nh;
+    MPI_File_write_at(fh, off, &traits.ivers   , 1   , T2GCDatatype  <GINT>(), &status); 
+        MPI_Get_count(&status, MPI_BYTE, &nh);  nb += nh; off += nh;
+    MPI_File_write_at(fh, off, &traits.dim     , 1   , T2GCDatatype  <GINT>(), &status); 
+        MPI_Get_count(&status, MPI_BYTE, &nh);  nb += nh; off += nh;
+    MPI_File_write_at(fh, off, &info.nelems    , 1   , T2GCDatatype<GSIZET>(), &status); 
+        MPI_Get_count(&status, MPI_BYTE, &nh); nb += nh; off += nh;
     numr = traits.ivers == 0 ? 1 : info.nelems;
     info.porder.resize(numr,traits.dim);
     numr = info.porder.size(1)*info.porder.size(2);
-    MPI_File_write(fp, info.porder.data().data()
+    MPI_File_write_at(fh, off, info.porder.data().data()
                                                , numr, T2GCDatatype   <GINT>(), &status); 
-        MPI_Get_count(&status, MPI_BYTE, &nh); nb += nh;
-    MPI_File_write(fp, &info.gtype       , 1   , T2GCDatatype  <GINT>(), &status);
-        MPI_Get_count(&status, MPI_BYTE, &nh);  nb += nh;
-    MPI_File_write(fp, &info.cycle       , 1   , T2GCDatatype<GSIZET>(), &status);
-        MPI_Get_count(&status, MPI_BYTE, &nh); nb += nh;
-    MPI_File_write(fp, &info.time        , 1   , T2GCDatatype<Ftype>(),  &status); 
-        MPI_Get_count(&status, MPI_BYTE, &nh); nb += nh;
-    MPI_File_write(fp, &imulti           , 1   , T2GCDatatype  <GINT>(), &status); 
-        MPI_Get_count(&status, MPI_BYTE, &nh); nb += nh;
-
-    // Element ids/keys:
-    GTVector<GKEY> *keys = &this->grid_->elemids();
-    assert( keys != NULLPTR && keys->size() == info.nelems ); // verify there are the right number
-    MPI_File_write(fp, keys->data()     , info.nelems, T2GCDatatype  <GKEY>(), &status); 
-        MPI_Get_count(&status, MPI_BYTE, &nh); nb += nh;
+        MPI_Get_count(&status, MPI_BYTE, &nh); nb += nh; off += nh;
+    MPI_File_write_at(fh, off, &info.gtype       , 1   , T2GCDatatype  <GINT>(), &status);
+        MPI_Get_count(&status, MPI_BYTE, &nh);  nb += nh; off += nh;
+    MPI_File_write_at(fh, off, &info.cycle       , 1   , T2GCDatatype<GSIZET>(), &status);
+        MPI_Get_count(&status, MPI_BYTE, &nh); nb += nh; off += nh;
+    MPI_File_write_at(fh, off, &info.time        , 1   , T2GCDatatype<Ftype>(),  &status); 
+        MPI_Get_count(&status, MPI_BYTE, &nh); nb += nh; off += nh;
+    MPI_File_write_at(fh, off, &imulti           , 1   , T2GCDatatype  <GINT>(), &status); 
+        MPI_Get_count(&status, MPI_BYTE, &nh); nb += nh; off += nh;
   }
 
+  // Element ids/keys, at end of header:
+  GTVector<GKEY> *keys = &this->grid_->elemids();
+  assert( keys != NULLPTR && keys->size() == this->grid_->nelems() ); 
+  off = sz_header(info,traits) - (info.nelems - elem_disp_)*sizeof(GKEY);
+  MPI_File_write_at_all(fh, off, keys->data(), keys->size(), T2GCDatatype  <GKEY>(), &status); 
+      MPI_Get_count(&status, MPI_BYTE, &nh); nb += nh;
 
-  MPI_File_close(&fp); 
-     
-  GComm::Synch(comm_);
+  GComm::Allreduce(&nb, &gnb, 1, T2GCDatatype<GSIZET>(), GC_OP_SUM, comm_);
 
-  return nb;
+  return gnb;
 
 } // end, write_header_coll
+
+
+//**********************************************************************************
+//**********************************************************************************
+// METHOD : read_header_coll
+// DESC   : Read GIO MPI file header from open file, at displacement 0.
+//          All ranks read the (small) header; file view must be the default.
+// ARGS   : 
+//          fh       : open file handle
+//          info     : StateInfo structure, filled with what header provides
+//          traits   : traits, filled with what header provides
+// RETURNS: no. header bytes read
+//**********************************************************************************
+template<typename Types>
+GSIZET GIO<Types>::read_header_coll(MPI_File fh, StateInfo &info, Traits &traits)
+{
+  GEOFLOW_TRACE();
+  GString serr ="read_header_coll: ";
+  GINT       nh, imulti;
+  GSIZET     nb, numr;
+  MPI_Offset off;
+  MPI_Status status;
+
+  nb  = 0;
+  off = 0;
+  MPI_File_read_at_all(fh, off, &traits.ivers     , 1   , T2GCDatatype  <GINT>(), &status); 
+      MPI_Get_count(&status, MPI_BYTE, &nh); nb += nh; off += nh;
+  MPI_File_read_at_all(fh, off, &traits.dim       , 1   , T2GCDatatype  <GINT>(), &status); 
+      MPI_Get_count(&status, MPI_BYTE, &nh); nb += nh; off += nh;
+  MPI_File_read_at_all(fh, off, &info.nelems      , 1   , T2GCDatatype<GSIZET>(), &status); 
+      MPI_Get_count(&status, MPI_BYTE, &nh); nb += nh; off += nh;
+  numr = traits.ivers == 0 ? 1 : info.nelems;
+  info.porder.resize(numr,traits.dim);
+  numr = info.porder.size(1)*info.porder.size(2);
+  MPI_File_read_at_all(fh, off, info.porder.data().data()
+                                                , numr, T2GCDatatype  <GINT>(), &status); 
+      MPI_Get_count(&status, MPI_BYTE, &nh); nb += nh; off += nh;
+  MPI_File_read_at_all(fh, off, &info.gtype       , 1   , T2GCDatatype  <GINT>(), &status); 
+      MPI_Get_count(&status, MPI_BYTE, &nh); nb += nh; off += nh;
+  MPI_File_read_at_all(fh, off, &info.cycle       , 1   , T2GCDatatype<GSIZET>(), &status); 
+      MPI_Get_count(&status, MPI_BYTE, &nh); nb += nh; off += nh;
+  MPI_File_read_at_all(fh, off, &info.time        , 1   , T2GCDatatype <Ftype>(), &status); 
+      MPI_Get_count(&status, MPI_BYTE, &nh); nb += nh; off += nh;
+  MPI_File_read_at_all(fh, off, &imulti           , 1   , T2GCDatatype  <GINT>(), &status); 
+      MPI_Get_count(&status, MPI_BYTE, &nh); nb += nh; off += nh;
+  traits.multivar = static_cast<GBOOL>(imulti);
+
+  info.elemids.resize(info.nelems);
+  MPI_File_read_at_all(fh, off, info.elemids.data(), info.nelems, T2GCDatatype  <GKEY>(), &status); 
+      MPI_Get_count(&status, MPI_BYTE, &nh); nb += nh;
+
+  // Check number read vs expected value:
+  if ( nb != sz_header(info, traits) ) {
+    cout << serr << "Incorrect amount of header data read" << endl;
+    exit(1);
+  }
+
+  return nb;
+
+} // end, read_header_coll
+
+
+//**********************************************************************************
+//**********************************************************************************
+// METHOD : state_type
+// DESC   : Get file type for nf global state components stored 
+//          consecutively, selecting this task's dof in each. Types 
+//          are created on first use, and cached.
+// ARGS   : nf : no. components
+// RETURNS: committed MPI_Datatype
+//**********************************************************************************
+template<typename Types>
+MPI_Datatype GIO<Types>::state_type(GINT nf)
+{
+  GEOFLOW_TRACE();
+  GINT   iret;
+  GINT   sizes[2]   = {nf, state_gsize_ };
+  GINT   subsizes[2]= {nf, state_extent_};
+  GINT   starts[2]  = { 0, state_disp_  };
+
+  if ( nf >= mpi_state_types_.size() ) {
+    mpi_state_types_.resize(nf+1, MPI_DATATYPE_NULL);
+  }
+
+  if ( mpi_state_types_[nf] == MPI_DATATYPE_NULL ) {
+    iret = MPI_Type_create_subarray(2, sizes, subsizes, starts, MPI_ORDER_C, 
+                                    T2GCDatatype<Ftype>(), &mpi_state_types_[nf]);
+    assert(iret == MPI_SUCCESS);
+    iret = MPI_Type_commit(&mpi_state_types_[nf]);
+    assert(iret == MPI_SUCCESS);
+  }
+
+  return mpi_state_types_[nf];
+
+} // end, state_type
+
+
+//**********************************************************************************
+//**********************************************************************************
+// METHOD : mem_type
+// DESC   : Get memory type addressing first nf components of u 
+//          at absolute addresses, for use with MPI_BOTTOM. Caller 
+//          must free returned type.
+// ARGS   : u  : state
+//          nf : no. components
+// RETURNS: committed MPI_Datatype
+//**********************************************************************************
+template<typename Types>
+MPI_Datatype GIO<Types>::mem_type(const State &u, GINT nf)
+{
+  GEOFLOW_TRACE();
+  GINT              iret;
+  std::vector<GINT> blocklens(nf);
+  std::vector<MPI_Aint>
+                    displs(nf);
+  MPI_Datatype      mtype;
+
+  for ( auto j=0; j<nf; j++ ) {
+    assert(u[j]->size() == state_extent_ && "Invalid state component");
+    blocklens[j] = u[j]->size();
+    MPI_Get_address(u[j]->data(), &displs[j]);
+  }
+  iret = MPI_Type_create_hindexed(nf, blocklens.data(), displs.data(), 
+                                  T2GCDatatype<Ftype>(), &mtype);
+  assert(iret == MPI_SUCCESS);
+  iret = MPI_Type_commit(&mtype);
+  assert(iret == MPI_SUCCESS);
+
+  return mtype;
+
+} // end, mem_type
+
+
+//**********************************************************************************
+//**********************************************************************************
+// METHOD : same_layout
+// DESC   : Determine if file elements, whose keys are in info, are 
+//          laid out as on this grid, s.t. this task's elements are
+//          contiguous in the file, in local order, at elem_disp_. This
+//          is the case if the file was written with the same no. tasks,
+//          and decomposition. Collective.
+// ARGS   : info : StateInfo structure, with header data
+// RETURNS: TRUE if layout is the same on all tasks; else FALSE
+//**********************************************************************************
+template<typename Types>
+GBOOL GIO<Types>::same_layout(const StateInfo &info)
+{
+  GEOFLOW_TRACE();
+  GINT            lsame, gsame;
+  GTVector<GKEY> &keys = this->grid_->elemids();
+
+  lsame = info.nelems == this->grid_->ngelems()
+       && info.elemids.size() >= elem_disp_ + keys.size();
+  for ( auto e=0; e<keys.size() && lsame; e++ ) {
+    lsame = info.elemids[elem_disp_+e] == keys[e];
+  }
+  GComm::Allreduce(&lsame, &gsame, 1, T2GCDatatype<GINT>(), GC_OP_MIN, comm_);
+
+  return gsame != 0;
+
+} // end, same_layout
+
+
+//**********************************************************************************
+//**********************************************************************************
+// METHOD : remap_types
+// DESC   : Get file and memory types to read first nf components of 
+//          u from a file written with a different decomposition (e.g.,
+//          on a different no. tasks). Each local element is found in
+//          the file by its (decomposition-independent) key, and
+//          its data is read directly by this task. Blocks are ordered by
+//          file position, as required for file views. Caller must 
+//          free returned types.
+// ARGS   : info  : StateInfo structure, with header data
+//          traits: traits from file header
+//          u     : state
+//          nf    : no. components
+//          ftype : committed file type, returned
+//          mtype : committed memory type, for use with MPI_BOTTOM, returned
+// RETURNS: none.
+//**********************************************************************************
+template<typename Types>
+void GIO<Types>::remap_types(const StateInfo &info, const Traits &traits, 
+                             const State &u, GINT nf, 
+                             MPI_Datatype &ftype, MPI_Datatype &mtype)
+{
+  GEOFLOW_TRACE();
+  GString           serr = "remap_types: ";
+  GINT              iret, irow, npe;
+  GSIZET            fe, fgsize, n, nelems = this->grid_->nelems();
+  GTVector<GKEY>   &keys  = this->grid_->elemids();
+  typename Types::GElemList
+                   *elems = &this->grid_->elems();
+  std::vector<GSIZET>
+                    foff(info.nelems+1);
+  std::vector<std::pair<GSIZET,GSIZET>>
+                    iorder(nelems);
+  std::vector<GINT> blocklens(nf*nelems);
+  std::vector<MPI_Aint>
+                    fdispl(nf*nelems), mdispl(nf*nelems);
+  std::unordered_map<GKEY,GSIZET>
+                    ifile;
+  std::vector<GBOOL>
+                    bclaimed(info.nelems, FALSE);
+
+  // Find dof offset of each file element within a component:
+  foff[0] = 0;
+  for ( auto e=0; e<info.nelems; e++ ) {
+    irow = traits.ivers == 0 ? 0 : e;
+    npe = 1;
+    for ( auto k=0; k<traits.dim; k++ ) npe *= info.porder(irow,k) + 1;
+    foff[e+1] = foff[e] + npe;
+  }
+  fgsize = foff[info.nelems];
+
+  // Locate local elements in file. Keys must be unique in the file, 
+  // and each file element may be claimed by only one local element:
+  ifile.reserve(info.nelems);
+  for ( auto e=0; e<info.nelems; e++ ) ifile[info.elemids[e]] = e;
+  if ( ifile.size() != info.nelems ) {
+    cout << serr << "File has " << info.nelems - ifile.size() 
+         << " duplicate element keys" << endl;
+    exit(1);
+  }
+
+  for ( auto e=0; e<nelems; e++ ) {
+    auto it = ifile.find(keys[e]);
+    if ( it == ifile.end() ) {
+      cout << serr << "Element key " << keys[e] << " not found in file" << endl;
+      exit(1);
+    }
+    if ( bclaimed[it->second] ) {
+      cout << serr << "Element key " << keys[e] << " not unique in grid" << endl;
+      exit(1);
+    }
+    fe = it->second;
+    bclaimed[fe] = TRUE;
+    if ( foff[fe+1]-foff[fe] != (*elems)[e]->nnodes() ) {
+      cout << serr << "Element " << keys[e] << " order differs from file" << endl;
+      exit(1);
+    }
+    iorder[e] = std::make_pair(fe, static_cast<GSIZET>(e));
+  }
+  std::sort(iorder.begin(), iorder.end());
+
+  // Build types, component by component:
+  n = 0;
+  for ( auto j=0; j<nf; j++ ) {
+    assert(u[j]->size() == state_extent_ && "Invalid state component");
+    for ( auto i=0; i<nelems; i++, n++ ) {
+      fe           = iorder[i].first;
+      auto e       = iorder[i].second;
+      blocklens[n] = (*elems)[e]->nnodes();
+      fdispl   [n] = static_cast<MPI_Aint>((j*fgsize + foff[fe])*sizeof(Ftype));
+      MPI_Get_address(u[j]->data()+(*elems)[e]->igbeg(), &mdispl[n]);
+    }
+  }
+
+  iret = MPI_Type_create_hindexed(n, blocklens.data(), fdispl.data(), 
+                                  T2GCDatatype<Ftype>(), &ftype);
+  assert(iret == MPI_SUCCESS);
+  iret = MPI_Type_commit(&ftype);
+  assert(iret == MPI_SUCCESS);
+  iret = MPI_Type_create_hindexed(n, blocklens.data(), mdispl.data(), 
+                                  T2GCDatatype<Ftype>(), &mtype);
+  assert(iret == MPI_SUCCESS);
+  iret = MPI_Type_commit(&mtype);
+  assert(iret == MPI_SUCCESS);
+
+} // end, remap_types
 #endif
 
 
@@ -686,7 +1011,7 @@ GSIZET GIO<Types>::sz_header(const StateInfo &info, const Traits &traits)
     numr = traits.ivers == 0 ? 1 : info.nelems;
     numr *= traits.dim;
     nd = (numr+4)*sizeof(GINT) + 2*sizeof(GSIZET) + sizeof(Ftype);
-    nd += this->grid_->elems().size() * sizeof(GKEY);
+    nd += info.nelems * sizeof(GKEY); // all elem keys in file
 
     return nd;
 
@@ -718,14 +1043,21 @@ void GIO<Types>::resize(GINT n)
 //**********************************************************************************
 //**********************************************************************************
 // METHOD : write_coll
-// DESC   : Collective write of state components
+// DESC   : Collective write of state components. File is opened once,
+//          and all components (one, if !traits.multivar) are written
+//          with a single collective call, using a file type covering
+//          all components, and a memory type addressing all of u.
+//          If ibuff >= 0, the data write is non-blocking, and is 
+//          recorded in staging buffer ibuff, which must hold u; it is 
+//          completed in wait_buff.
 // ARGS   : filename: filename
 //          info    : StateInfo structure
 //          u       : state
-// RETURNS: number bytes written
+//          ibuff   : async staging buffer index; if < 0, write is blocking
+// RETURNS: number bytes written (or posted, if async)
 //**********************************************************************************
 template<typename Types>
-GSIZET GIO<Types>::write_coll(GString filename, StateInfo &info, const State &u)
+GSIZET GIO<Types>::write_coll(GString filename, StateInfo &info, const State &u, GINT ibuff)
 {
   GEOFLOW_TRACE();
 #if !defined(GEOFLOW_USE_MPI)
@@ -735,52 +1067,60 @@ GSIZET GIO<Types>::write_coll(GString filename, StateInfo &info, const State &u)
 #if defined(GEOFLOW_USE_MPI)
 
     GString        serr = "write_coll: ";
-    GINT           iret, nbheader, nc, nh;
-    GSIZET         nb;
+    GINT           iret, nbheader, nf, nh;
     GSIZET         ntot;
 
+    MPI_Datatype   mtype;
     MPI_Offset     disp;
     MPI_File       fh;
+    MPI_Request    req;
     MPI_Status     status;
 
-    // Required number of coord vectors:
-    nc = this->grid_->gtype() == GE_2DEMBEDDED ? GDIM+1 : GDIM;
-
     nbheader = sz_header(info, this->traits_);
 
-    // Write header; remember that file is closed on exit:
-    nh = write_header_coll(filename, info, this->traits_);
-    assert(nh == nbheader && "Expected header size not written");
-    ntot = nh;
+    // Don't reopen a file that is still being written:
+    for ( auto i=0; i<abuff_.size(); i++ ) {
+      for ( auto k=0; abuff_[i].bbusy && k<abuff_[i].fnames.size(); k++ ) {
+        if ( abuff_[i].fnames[k] == filename ) wait_buff(i);
+      }
+    }
 
-    iret = MPI_File_open(comm_, filename.c_str(), MPI::MODE_CREATE|MPI::MODE_WRONLY, MPI::INFO_NULL, &fh);
+    iret = MPI_File_open(comm_, filename.c_str(), MPI::MODE_CREATE|MPI::MODE_WRONLY, mpi_info_, &fh);
     assert(iret == MPI_SUCCESS && "MPI_File_open failure");
 
+    // Truncate, so no stale bytes remain if file existed and was larger:
+    iret = MPI_File_set_size(fh, 0);
+    assert(iret == MPI_SUCCESS && "MPI_File_set_size failure");
 
-    // Cycle over all fields, and write:
-    if ( !this->traits_.multivar ) { // print each comp to sep. file
-        assert(u[0]->size() > 0 && "Invalid state component");
-        disp = nbheader ;
-        iret = MPI_File_set_view(fh, disp, T2GCDatatype<Ftype>(), mpi_state_type_, "native", MPI::INFO_NULL);
-        assert(iret == MPI_SUCCESS);
-        iret = MPI_File_write_all(fh, u[0]->data(), u[0]->size(), T2GCDatatype<Ftype>(), &status);
-        assert(iret == MPI_SUCCESS);
-        MPI_Get_count(&status, MPI_BYTE, &nh);  
-        ntot += nh;
-    }
-    else {                       // print each comp to same file
-      for ( auto j=0; j<u.size(); j++ ) {
-        disp = nbheader + j*nbgdof_ ; 
-        iret = MPI_File_set_view(fh, disp, T2GCDatatype<Ftype>(), mpi_state_type_, "native", MPI::INFO_NULL);
-        assert(iret == MPI_SUCCESS);
-        iret = MPI_File_write_all(fh, u[j]->data(), u[j]->size(), T2GCDatatype<Ftype>(), &status);
-        assert(iret == MPI_SUCCESS);
-        MPI_Get_count(&status, MPI_BYTE, &nh);  
-        ntot += nh;
-      }
-    } 
+    // Write header:
+    nh = write_header_coll(fh, info, this->traits_);
+    assert(nh == nbheader && "Expected header size not written");
+    ntot = nh;
 
-    MPI_File_close(&fh);
+    // Write all components in one call:
+    nf    = this->traits_.multivar ? u.size() : 1;
+    mtype = mem_type(u, nf);
+    disp  = nbheader ;
+    iret  = MPI_File_set_view(fh, disp, T2GCDatatype<Ftype>(), state_type(nf), "native", mpi_info_);
+    assert(iret == MPI_SUCCESS);
+    if ( ibuff < 0 ) {
+      iret = MPI_File_write_all(fh, MPI_BOTTOM, 1, mtype, &status);
+      assert(iret == MPI_SUCCESS);
+      MPI_Get_count(&status, MPI_BYTE, &nh);  
+      ntot += nh;
+      MPI_File_close(&fh);
+    }
+    else {               // closed when buffer is waited on
+      iret = MPI_File_iwrite_all(fh, MPI_BOTTOM, 1, mtype, &req);
+      assert(iret == MPI_SUCCESS);
+      abuff_[ibuff].req   .push_back(req);
+      abuff_[ibuff].fh    .push_back(fh);
+      abuff_[ibuff].fnames.push_back(filename);
+      abuff_[ibuff].nbpost += nf*state_extent_*sizeof(Ftype);
+      abuff_[ibuff].bbusy = TRUE;
+      ntot += nf*state_extent_*sizeof(Ftype);
+    }
+    MPI_Type_free(&mtype); // freed once any pending write completes
 #endif
 
     return ntot;
@@ -788,10 +1128,106 @@ GSIZET GIO<Types>::write_coll(GString filename, StateInfo &info, const State &u)
 } // end, write_coll
 
 
+//**********************************************************************************
+//**********************************************************************************
+// METHOD : stage
+// DESC   : Copy state to next async staging buffer, waiting for
+//          it first only if its previous write is still in flight
+// ARGS   : u  : state
+// RETURNS: staging buffer index
+//**********************************************************************************
+template<typename Types>
+GINT GIO<Types>::stage(const State &u)
+{
+  GEOFLOW_TRACE();
+
+  GINT ibuff = (ibuff_ + 1) % abuff_.size();
+
+  if ( abuff_[ibuff].bbusy ) wait_buff(ibuff);
+
+  abuff_[ibuff].ustage.resize(u.size());
+  abuff_[ibuff].pstage.resize(u.size());
+  for ( auto j=0; j<u.size(); j++ ) {
+    abuff_[ibuff].ustage[j].resize(u[j]->size());
+    std::copy(u[j]->data(), u[j]->data()+u[j]->size(), abuff_[ibuff].ustage[j].data());
+    abuff_[ibuff].pstage[j] = &abuff_[ibuff].ustage[j];
+  }
+  ibuff_ = ibuff;
+
+  return ibuff;
+
+} // end, stage
+
+
+//**********************************************************************************
+//**********************************************************************************
+// METHOD : wait_buff
+// DESC   : Complete all writes posted from staging buffer, and 
+//          close their files. Collective, as is the file close.
+// ARGS   : ibuff: staging buffer index
+// RETURNS: none.
+//**********************************************************************************
+template<typename Types>
+void GIO<Types>::wait_buff(GINT ibuff)
+{
+  GEOFLOW_TRACE();
+#if defined(GEOFLOW_USE_MPI)
+
+  GINT                    iret, nh;
+  GSIZET                  nb=0;
+  std::vector<MPI_Status> status(abuff_[ibuff].req.size());
+
+  if ( !abuff_[ibuff].bbusy ) return;
+
+  iret = MPI_Waitall(abuff_[ibuff].req.size(), abuff_[ibuff].req.data(), status.data());
+  assert(iret == MPI_SUCCESS);
+  for ( auto j=0; j<status.size(); j++ ) {
+    MPI_Get_count(&status[j], MPI_BYTE, &nh);
+    nb += nh;
+  }
+  assert(nb == abuff_[ibuff].nbpost && "Incorrect number of bytes written");
+
+  for ( auto j=0; j<abuff_[ibuff].fh.size(); j++ ) {
+    MPI_File_close(&abuff_[ibuff].fh[j]);
+  }
+  abuff_[ibuff].req   .clear();
+  abuff_[ibuff].fh    .clear();
+  abuff_[ibuff].fnames.clear();
+  abuff_[ibuff].nbpost = 0;
+  abuff_[ibuff].bbusy  = FALSE;
+#endif
+
+} // end, wait_buff
+
+
+//**********************************************************************************
+//**********************************************************************************
+// METHOD : flush_impl
+// DESC   : Complete all outstanding async writes, oldest first.
+//          Must be called on all tasks, and before MPI is finalized.
+// ARGS   : none.
+// RETURNS: none.
+//**********************************************************************************
+template<typename Types>
+void GIO<Types>::flush_impl()
+{
+  GEOFLOW_TRACE();
+
+  for ( auto i=1; i<=abuff_.size(); i++ ) {
+    wait_buff((ibuff_ + i) % abuff_.size());
+  }
+
+} // end, flush_impl
+
+
 //**********************************************************************************
 //**********************************************************************************
 // METHOD : read_coll
-// DESC   : Collective read of state components
+// DESC   : Collective read of state components. File is opened once;
+//          header is read, and then all components (one, if 
+//          !traits.multivar) are read with a single collective call.
+//          The file may have been written on a different no. tasks
+//          from this grid; see remap_types.
 // ARGS   : filename: filename
 //          info    : StateInfo structure
 //          u       : state
@@ -802,62 +1238,56 @@ template<typename Types>
 GSIZET GIO<Types>::read_coll(GString filename, StateInfo &info, State &u, bool bstate)
 {
   GEOFLOW_TRACE();
+  GSIZET         ntot=0;
 #if defined(GEOFLOW_USE_MPI)
 
     GString        serr = "read_coll: ";
-    GINT           iret;
-    GSIZET         nb, nbheader, nh, ntot;
+    GINT           iret, nf, nh;
+    GBOOL          bremap=FALSE;
+    GSIZET         nbheader;
     Traits         ttraits=this->traits_;
+    MPI_Datatype   ftype, mtype;
     MPI_Offset     disp;
     MPI_File       fh;
     MPI_Status     status;
 
 
+    iret = MPI_File_open(comm_, filename.c_str(), MPI::MODE_RDONLY, mpi_info_, &fh);
+    assert(iret == MPI_SUCCESS && "MPI_File_open failure");
+
     // Read header and do some checks:
-    nh = read_header(filename, info, ttraits);
+    nbheader = read_header_coll(fh, info, ttraits);
     assert(ttraits.ivers == this->traits_.ivers
                                          && "Incompatible file version number");
     assert(ttraits.dim   == GDIM         && "File dimension incompatible with GDIM");
     assert(info   .gtype == this->grid_->gtype() 
                                            && "File grid type incompatible with grid");
-
-    ntot = nh;
-
-    if ( !bstate ) return ntot;
-
-    // NOTE: read_header closes its file handle, so, when reopened, filepointer
-    //       starts at displacement of 0"
-
-    // Re-open file, and read state data:
-    iret = MPI_File_open(comm_, filename.c_str(), MPI::MODE_RDONLY, MPI::INFO_NULL, &fh);
-    assert(iret == MPI_SUCCESS && "MPI_File_open failure");
-    nbheader = sz_header(info, this->traits_);
-
-
-    // Cycle over all fields, and read:
-    //   Note: any variable polynomial order element-by-element
-    //         should be handled in ::update_type method via 
-    //         state_disp_ & mpi_state_type_. Currently,
-    //         variable order is not fully supported on read:
-    if ( !this->traits_.multivar ) { // print each comp to sep. file
-        assert(u[0]->size() > 0 && "Invalid state component");
-        disp = nbheader ;
-        iret = MPI_File_set_view(fh, disp, T2GCDatatype<Ftype>(), mpi_state_type_, "native", MPI::INFO_NULL);
-        assert(iret == MPI_SUCCESS);
-        iret = MPI_File_read_all(fh, u[0]->data(), u[0]->size(), T2GCDatatype<Ftype>(), &status);
-        assert(iret == MPI_SUCCESS);
-        ntot += iret == MPI_SUCCESS ? u[0]->size() : 0;
+    ntot = nbheader;
+
+    if ( bstate ) {
+      // Read all components in one call. If file was written with
+      // a different decomposition, each task reads its elements 
+      // from wherever they are in the file, located by key:
+      nf    = this->traits_.multivar ? u.size() : 1;
+      disp  = nbheader ;
+      if ( same_layout(info) ) {
+        ftype = state_type(nf);
+        mtype = mem_type(u, nf);
+      }
+      else {
+        remap_types(info, ttraits, u, nf, ftype, mtype);
+        bremap = TRUE;
+        nremap_++;
+      }
+      iret  = MPI_File_set_view(fh, disp, T2GCDatatype<Ftype>(), ftype, "native", mpi_info_);
+      assert(iret == MPI_SUCCESS);
+      iret = MPI_File_read_all(fh, MPI_BOTTOM, 1, mtype, &status);
+      assert(iret == MPI_SUCCESS);
+      MPI_Get_count(&status, MPI_BYTE, &nh);  
+      ntot += nh;
+      MPI_Type_free(&mtype);
+      if ( bremap ) MPI_Type_free(&ftype);
     }
-    else {                       // read each comp from same file
-      for ( auto j=0; j<u.size(); j++ ) {
-        disp = nbheader + j*nbgdof_ ; 
-        iret = MPI_File_set_view(fh, disp, T2GCDatatype<Ftype>(), mpi_state_type_, "native", MPI::INFO_NULL);
-        assert(iret == MPI_SUCCESS);
-        iret = MPI_File_read_all(fh, u[j]->data(), u[j]->size(), T2GCDatatype<Ftype>(), &status);
-        assert(iret == MPI_SUCCESS);
-        ntot += iret == MPI_SUCCESS ? u[j]->size() : 0;
-      } 
-    } 
 
     MPI_File_close(&fh);
 #endif
@@ -865,4 +1295,3 @@ GSIZET GIO<Types>::read_coll(GString filename, StateInfo &info, State &u, bool b
     return ntot;
 
 } // end, read_coll
-
@@ -59,6 +59,7 @@ public:
 
         void               observe_impl(const Time &t, const Time &dt, const State &u, const State &uf);
         void               init_impl(StateInfo &);
+        void               set_grid_impl(EqnBasePtr &equation, Grid &grid);
         void               setIO(IOBasePtr ioobj) { pIO_ = ioobj; }
 
 private:
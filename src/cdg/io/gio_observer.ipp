@@ -43,6 +43,9 @@ pEqn_        (equation)
 //              NOTE: an internal cycle counter is maintained, as this 
 //                    observer, like all others,  should be called at 
 //                    each time step.
+//                    If the IO object is async, write_state returns
+//                    once u is staged, and blocks only if the staging
+//                    buffer it needs is still being written.
 //
 // ARGUMENTS  : t    : time, t^n, for state, uin=u^n
 //              dt   : timestep
@@ -136,6 +139,28 @@ void GIOObserver<EquationType>::init_impl(StateInfo &info)
 } // end of method init_impl
 
 
+//**********************************************************************************
+//**********************************************************************************
+// METHOD     : set_grid_impl
+// DESCRIPTION: Re-target observer to new equation and grid (already 
+//              set in base), e.g., after repartitioning. Grid is
+//              printed again at next output, as its element order in
+//              collective files may have changed.
+// ARGUMENTS  : equation: new equation
+//              grid    : new grid
+// RETURNS    : none.
+//**********************************************************************************
+template<typename EquationType>
+void GIOObserver<EquationType>::set_grid_impl(EqnBasePtr &equation, Grid &grid)
+{
+  GEOFLOW_TRACE();
+
+  pEqn_    = equation;
+  bprgrid_ = TRUE;
+
+} // end of method set_grid_impl
+
+
 //**********************************************************************************
 //**********************************************************************************
 // METHOD     : print_derived 
@@ -174,9 +199,7 @@ void GIOObserver<EquationType>::print_derived(const Time &t, const State &u)
       // First, do math-derived quantities:
       GMTK::domathop(*(this->grid_), u, sop, tmp, uout, iuout);
       assert(this->traits_.derived_quantities[j].snames.size() >= iuout.size());
-      for ( auto i=0; i<iuout.size(); i++ ) {
-        this->grid_->get_ggfx().doOp(*uout[i], typename GGFX<decltype(u[0])>::Smooth());
-      }
+      this->grid_->get_ggfx().doOp(uout, iuout.size(), typename GGFX<Ftype>::Smooth());
       // Rest of stateinfo_ should have been set before call:
       stateinfo_.svars.resize(this->traits_.derived_quantities[j].snames.size());
       stateinfo_.svars  = this->traits_.derived_quantities[j].snames;
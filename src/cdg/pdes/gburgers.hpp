@@ -88,6 +88,7 @@ public:
           GBOOL          bforced     = FALSE;
           GBOOL          variabledt  = FALSE;
           GBOOL          bSSP        = FALSE;// use strong stab preserv. RK?
+          GBOOL          bLowStorage = FALSE;// use low-storage (2N) RK?
           GINT           nstate      = GDIM; // no. vars in state vec
           GINT           nsolve      = GDIM; // no. vars to solve for
           GINT           ntmp        = 8;
@@ -155,6 +156,7 @@ private:
         GBOOL               bsteptop_;      // is there a top-of-step callback?
         GBOOL               bvariabledt_;   // is dt allowed to vary?
         GBOOL               bSSP_;          // use strong stab. preserv. RK?
+        GBOOL               bLowStorage_;   // use low-storage (2N) RK?
         GStepperType        isteptype_;     // stepper type
         GINT                nsteps_ ;       // num steps taken
         GINT                itorder_;       // time deriv order
@@ -31,6 +31,7 @@ bconserved_  (traits.bconserved),
 bforced_        (traits.bforced),
 bsteptop_                (FALSE),
 bSSP_              (traits.bSSP),
+bLowStorage_(traits.bLowStorage),
 bvariabledt_ (traits.variabledt),
 isteptype_       (GSTEPPER_EXRK),
 nsteps_                      (0),
@@ -91,7 +92,7 @@ steptop_callback_      (NULLPTR)
 
   comm_ = ggfx_->getComm();
 
-  pthis_.reset(this);
+  pthis_.reset(this, [](EquationBase<Types> *) {}); // non-owning
 
   
 } // end of constructor method (1)
@@ -478,9 +479,10 @@ void GBurgers<TypePack>::init_impl(State &u, State &tmp)
   typename GExRKStepper<Grid,Ftype>::Traits rktraits;
   switch ( isteptype_ ) {
     case GSTEPPER_EXRK:
-      rktraits.bSSP   = bSSP_;
-      rktraits.norder = itorder_;
-      rktraits.nstage = itorder_;
+      rktraits.bSSP        = bSSP_;
+      rktraits.bLowStorage = bLowStorage_;
+      rktraits.norder      = itorder_;
+      rktraits.nstage      = bLowStorage_ ? nstage_ : itorder_;
       gexrk_ = new GExRKStepper<Grid,Ftype>(rktraits, *grid_);
       gexrk_->setRHSfunction(rhs);
       gexrk_->set_apply_bdy_callback(applybc);
@@ -488,7 +490,7 @@ void GBurgers<TypePack>::init_impl(State &u, State &tmp)
       // Set 'helper' tmp arrays from main one, utmp_, so that
       // we're sure there's no overlap:
       uold_   .resize(nsolve); // solution at time level n
-      urktmp_ .resize(nsolve*(itorder_+1)+1); // RK stepping work space
+      urktmp_ .resize(GExRKStepper<Grid,Ftype>::tmp_size(rktraits, nsolve)); // RK stepping work space
       urhstmp_.resize(1); // work space for RHS
       nop = utmp_.size()-uold_.size()-urktmp_.size()-urhstmp_.size();
       assert(nop > 0 && "Invalid operation tmp array specification");
@@ -664,7 +666,10 @@ GINT GBurgers<TypePack>::tmp_size_impl()
   isize  = 2*GDIM + 3;
 
   if ( isteptype_ == GSTEPPER_EXRK ) {
-    isize += traits_.nsolve*(traits_.itorder+1)+1;
+    typename GExRKStepper<Grid,Ftype>::Traits rktraits;
+    rktraits.bLowStorage = traits_.bLowStorage;
+    rktraits.norder      = traits_.itorder;
+    isize += GExRKStepper<Grid,Ftype>::tmp_size(rktraits, traits_.nsolve);
   }
 
   return isize;
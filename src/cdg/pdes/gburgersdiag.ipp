@@ -26,15 +26,34 @@ grid_           (&grid)
   traits_ = traits;
   utmp_   = static_cast<GTVector<GTVector<Ftype>*>*>(utmp_);
   myrank_ = GComm::WorldRank(grid.get_comm());
+
+  iclient_ = GDiagAggregator<Ftype>::instance().add_client(grid.get_comm());
+
 } // end of constructor (1) method
 
 
+//**********************************************************************************
+//**********************************************************************************
+// METHOD : Destructor method 
+// DESC   : De-register from diagnostics aggregator
+// ARGS   : none
+//**********************************************************************************
+template<typename Types>
+GBurgersDiag<Types>::~GBurgersDiag()
+{
+  GDiagAggregator<Ftype>::instance().remove_client(iclient_);
+
+} // end of destructor method
+
+
 //**********************************************************************************
 //**********************************************************************************
 // METHOD     : observe_impl
 // DESCRIPTION: Compute energy, enstrophy, helicity, and energy injection, 
 //              and output to one file. Compute max of energy, enstrophy,
-//              and output to another file.
+//              and output to another file. Reductions and output are
+//              carried out by the diagnostics aggregator, which must
+//              be told that this observer is done each time it's called.
 //
 // ARGUMENTS  : t    : time, t^n, for state, uin=u^n
 //              dt   : time step
@@ -58,13 +77,15 @@ void GBurgersDiag<Types>::observe_impl(const Time &t, const Time &dt, const Stat
         &&  (t-time_last_ >= traits_.time_interval))
     || (cycle_ == 0) ) {
 
-    do_kinetic_L2 (t, dt, u, uf, "gbalance.txt");
-    do_kinetic_max(t, dt, u, uf, "gmax.txt");
+    do_kinetic_L2 (t, dt, u, uf);
+    do_kinetic_max(t, dt, u, uf);
     cycle_last_ = cycle_;
     time_last_  = t;
     ocycle_++;
   }
   cycle_++;
+
+  GDiagAggregator<Ftype>::instance().done(iclient_);
   
 } // end of method observe_impl
 
@@ -106,24 +127,62 @@ void GBurgersDiag<Types>::init_impl(StateInfo &info)
      delete [] iwhere;
    }
 
+   // Register output files with aggregator; header
+   // quantities are global, so must be found by all tasks:
+   GSIZET             ne;
+   Ftype              dxmin, elmin, elmax, elavg;
+   std::ostringstream os;
+
+   ne    = grid_->ngelems();
+   dxmin = grid_->minnodedist();
+   elmin = grid_->minlength();
+   elmax = grid_->maxlength();
+   elavg = grid_->avglength();
+   os << "#nelems=" << ne << " dxmin=" << dxmin << " elmin=" << elmin << " elmax=" << elmax << " elavg=" << elavg << std::endl;
+
+   GDiagAggregator<Ftype> &agg = GDiagAggregator<Ftype>::instance();
+   isL2_  = agg.add_stream(sodir_ + "/gbalance.txt",
+                           os.str() + "#time    dt      KE     Enst     f.v    hel     rhel \n");
+   ismax_ = agg.add_stream(sodir_ + "/gmax.txt",
+                           os.str() + "#time    dt    KE     Enst     f.v    hel     rhel \n");
+
    bInit_ = TRUE;
  
 } // end of method init_impl
 
 
+//**********************************************************************************
+//**********************************************************************************
+// METHOD     : set_grid_impl
+// DESCRIPTION: Re-target observer to new equation and grid,
+//              e.g., after repartitioning
+// ARGUMENTS  : equation: new equation
+//              grid    : new grid
+// RETURNS    : none.
+//**********************************************************************************
+template<typename EquationType>
+void GBurgersDiag<EquationType>::set_grid_impl(EqnBasePtr &equation, Grid &grid)
+{
+  GEOFLOW_TRACE();
+
+  grid_   = &grid;
+
+} // end of method set_grid_impl
+
+
 //**********************************************************************************
 //**********************************************************************************
 // METHOD     : do_kinetic_L2
-// DESCRIPTION: Compute integrated diagnostic quantities, and output to file
+// DESCRIPTION: Compute integrated diagnostic quantities, and post
+//              for reduction and output
 // ARGUMENTS  : t  : state time
 //              dt : time step
 //              u  : state variable
 //              uf : forcing
-//              fname: file name
 // RETURNS    : none.
 //**********************************************************************************
 template<typename Types>
-void GBurgersDiag<Types>::do_kinetic_L2(const Time &t, const Time &dt, const State &u, const State &uf, const GString fname)
+void GBurgersDiag<Types>::do_kinetic_L2(const Time &t, const Time &dt, const State &u, const State &uf)
 {
   assert(utmp_ != NULLPTR && utmp_->size() > 3
       && "tmp space not set, or is insufficient");
@@ -133,7 +192,7 @@ void GBurgersDiag<Types>::do_kinetic_L2(const Time &t, const Time &dt, const Sta
   GBOOL   ismax    = FALSE;
   GINT    nd, ndim = grid_->gtype() == GE_2DEMBEDDED ? 3 : GDIM;
   Ftype   absu, absw, ener, enst, hel, fv, rhel;
-  GTVector<Ftype> lmax(5), gmax(5);
+  GTVector<Ftype> lmax(5);
 
   // Make things a little easier:
   State utmp(5);
@@ -171,42 +230,8 @@ void GBurgersDiag<Types>::do_kinetic_L2(const Time &t, const Time &dt, const Sta
   // Relative helicity = <u.omega/(|u|*|omega|)>
   lmax[4] = GMTK::relhelicity<Grid,Ftype>(*grid_, ku_, utmp, isreduced, ismax);
 
-  // Gather final sums:
-  GComm::Allreduce(lmax.data(), gmax.data(), 5, T2GCDatatype<Ftype>(), GC_OP_SUM, grid_->get_comm());
-  ener = gmax[0]; enst = gmax[1]; fv = gmax[2]; hel = gmax[3]; rhel = gmax[4];
-
-  // Print data to file:
-  GBOOL         doheader=FALSE;
-  GSIZET        le, ne;
-  Ftype         dxmin, elmin, elmax, elavg;
-  std::ofstream ios;
-  GString       fullfile = sodir_ + "/" + fname;
-
-  if ( geoflow::file_empty(fullfile) ) {
-    le    = grid_->nelems();
-    dxmin = grid_->minnodedist();
-    elmin = grid_->minlength();
-    elmax = grid_->maxlength();
-    elavg = grid_->avglength();
-    GComm::Allreduce(&le, &ne, 1, T2GCDatatype<GSIZET>() , GC_OP_SUM, grid_->get_comm());
-    doheader = TRUE;
-  }
-
-  if ( myrank_ == 0 ) {
-    ios.open(fullfile,std::ios_base::app);
-    if ( doheader ) {
-      ios << "#nelems=" << ne << " dxmin=" << dxmin << " elmin=" << elmin << " elmax=" << elmax << " elavg=" << elavg << std::endl;
-      ios << "#time    dt      KE     Enst     f.v    hel     rhel " << std::endl;
-    }
-
-    ios << t  
-        << "    " << dt
-        << "    " << ener  << "    "  << enst 
-        << "    " << fv    << "    "  << hel
-        << "    " << rhel  
-        << std::endl;
-    ios.close();
-  }
+  // Post for global sums:
+  GDiagAggregator<Ftype>::instance().post(isL2_, GC_OP_SUM, t, dt, lmax);
  
 } // end of method do_kinetic_L2
 
@@ -214,16 +239,16 @@ void GBurgersDiag<Types>::do_kinetic_L2(const Time &t, const Time &dt, const Sta
 //**********************************************************************************
 //**********************************************************************************
 // METHOD     : do_kinetic_max
-// DESCRIPTION: Compute max quantities, and output to file
+// DESCRIPTION: Compute max quantities, and post for reduction
+//              and output
 // ARGUMENTS  : t    : state time
 //              dt   : time step
 //              u    : state variable
 //              uf   : forcing
-//              fname: file name
 // RETURNS    : none.
 //**********************************************************************************
 template<typename Types>
-void GBurgersDiag<Types>::do_kinetic_max(const Time &t, const Time &dt,  const State &u, const State &uf, const GString fname)
+void GBurgersDiag<Types>::do_kinetic_max(const Time &t, const Time &dt,  const State &u, const State &uf)
 {
   assert(utmp_ != NULLPTR && utmp_->size() > 5
       && "tmp space not set, or is insufficient");
@@ -232,7 +257,7 @@ void GBurgersDiag<Types>::do_kinetic_max(const Time &t, const Time &dt,  const S
   GBOOL   ismax    = TRUE;
   GINT    nd, ndim = grid_->gtype() == GE_2DEMBEDDED ? 3 : GDIM;
   Ftype   absu, absw, ener, enst, hel, fv, rhel;
-  GTVector<Ftype> lmax(5), gmax(5);
+  GTVector<Ftype> lmax(5);
 
   // Make things a little easier:
   GTVector<GTVector<Ftype>*> utmp(6);
@@ -267,43 +292,8 @@ void GBurgersDiag<Types>::do_kinetic_max(const Time &t, const Time &dt,  const S
   lmax[4] = GMTK::relhelicity<Grid,Ftype>(*grid_, ku_, utmp, isreduced, ismax);
 
 
-  // Gather final max's:
-  GComm::Allreduce(lmax.data(), gmax.data(), 5, T2GCDatatype<Ftype>(), GC_OP_MAX, grid_->get_comm());
-  ener = gmax[0]; enst = gmax[1]; fv = gmax[2]; hel = gmax[3]; rhel = gmax[4];
-  
-
-  // Print data to file:
-  GBOOL         doheader=FALSE;
-  GSIZET        le, ne;
-  Ftype         dxmin, elmin, elmax, elavg;
-  std::ofstream ios;
-  GString       fullfile = sodir_ + "/" + fname;
-
-  // Write header, if required:
-  if ( geoflow::file_empty(fullfile) ) {
-    le    = grid_->nelems();
-    dxmin = grid_->minnodedist();
-    elmin = grid_->minlength();
-    elmax = grid_->maxlength();
-    elavg = grid_->avglength();
-    GComm::Allreduce(&le, &ne, 1, T2GCDatatype<GSIZET>() , GC_OP_SUM, grid_->get_comm());
-    doheader = TRUE;
-  }
-  if ( myrank_ == 0 ) {
-    ios.open(fullfile,std::ios_base::app);
-    if ( doheader ) {
-      ios << "#nelems=" << ne << " dxmin=" << dxmin << " elmin=" << elmin << " elmax=" << elmax << " elavg=" << elavg << std::endl;
-      ios << "#time    dt    KE     Enst     f.v    hel     rhel " << std::endl;
-    }
-
-    ios << t  
-        << "    " << dt
-        << "    " << ener  << "    "  << enst 
-        << "    " << fv    << "    "  << hel
-        << "    " << rhel  
-        << std::endl;
-    ios.close();
-  }
+  // Post for global extrema:
+  GDiagAggregator<Ftype>::instance().post(ismax_, GC_OP_MAX, t, dt, lmax);
  
 } // end of method do_kinetic_max
 
@@ -1,7 +1,9 @@
 //==================================================================================
 // Module       : gexrk_stepper.hpp
 // Date         : 1/28/19 (DLR)
-// Description  : Object representing an Explicit RK stepper of a specified order
+// Description  : Object representing an Explicit RK stepper of a specified order.
+//                Butcher, SSP, and low-storage (2N-register, Williamson)
+//                forms are provided.
 // Copyright    : Copyright 2019. Colorado State University. All rights reserved.
 // Derived From : none.
 //==================================================================================
@@ -28,6 +30,7 @@ public:
         // MConv solver traits:
         struct Traits {
           GBOOL           bSSP        = FALSE;  // do strong stability-pres?
+          GBOOL           bLowStorage = FALSE;  // do low-storage (2N) form?
           GINT            norder      = 2;      // order
           GINT            nstage      = 2;      // no. stages
         };
@@ -39,7 +42,9 @@ public:
                            GExRKStepper &operator=(const GExRKStepper &bu) = default;
         void               setOrder(GINT order, GINT nstage) {
                              norder_ = order; nstage_=nstage; 
-                             if ( !bSSP_ ) butcher_ .setOrder(norder_); }
+                             if      ( bLowStorage_ ) init_ls();
+                             else if ( !bSSP_ ) butcher_ .setOrder(norder_); }
+        static GINT        tmp_size(const Traits &traits, GINT nstate); // required tmp size
 
         void               step(const Time &t, const State &uin,
                                 State &uf,
@@ -103,14 +108,21 @@ private:
                                       State &uf, 
                                       const Time &dt, State &uout);
 
+        void               init_ls();                        // set low-storage coeffs
+        void               step_ls(const Time &t, const State &uin, State &uf, 
+                                   const Time &dt, State &tmp,
+                                   State &uout);             // low-storage form
+
 // Private data:
         GBOOL              bRHS_;
         GBOOL              bapplybc_;
         GBOOL              bSSP_;                            // is strong-stability-preserving?
+        GBOOL              bLowStorage_;                     // is low-storage (2N) form?
         GINT               norder_;                          // order
         GINT               nstage_;                          // no stages (not nec. 'order'!)
         GButcherRK<T>      butcher_;                         // Butcher tableau
         GTVector<State>    K_;                               // RK stage update vectors
+        GTVector<T>        lsA_, lsB_, lsC_;                 // low-storage coeffs, nodes
         Grid              *grid_;                            // grid object
         GGFX<Ftype>       *ggfx_;                            // geom-free exchange op
         std::function<void(const Time &t,                    
@@ -22,12 +22,16 @@ GExRKStepper<Grid,T>::GExRKStepper(Traits &traits, Grid &grid)
 bRHS_                 (FALSE),
 bapplybc_             (FALSE),
 bSSP_           (traits.bSSP),
+bLowStorage_    (traits.bLowStorage),
 norder_       (traits.norder),
 nstage_       (traits.nstage),
 grid_                 (&grid),
 ggfx_               (NULLPTR)
 {
-  if ( !bSSP_ ) {
+  if ( bLowStorage_ ) {
+    init_ls();
+  }
+  else if ( !bSSP_ ) {
     butcher_ .setOrder(norder_); // nstage_ = norder_
   }
   else {
@@ -52,12 +56,16 @@ GExRKStepper<Grid,T>::GExRKStepper(Traits &traits)
 bRHS_                 (FALSE),
 bapplybc_             (FALSE),
 bSSP_           (traits.bSSP),
+bLowStorage_    (traits.bLowStorage),
 norder_       (traits.norder),
 nstage_       (traits.nstage),
 grid_               (NULLPTR),
 ggfx_               (NULLPTR)
 {
-  if ( !bSSP_ ) {
+  if ( bLowStorage_ ) {
+    init_ls();
+  }
+  else if ( !bSSP_ ) {
     butcher_ .setOrder(norder_); // nstage_ is ignored
   }
   else {
@@ -91,8 +99,7 @@ GExRKStepper<Grid,T>::~GExRKStepper()
 //              uin  : initial (entry) state, u^n
 //              uf   : forcing tendency
 //              dt   : time step
-//              tmp  : tmp space. Must have at least NState*(M+1)+1 vectors,
-//                     where NState is the number of state vectors.
+//              tmp  : tmp space. Must have at least tmp_size vectors
 //              uout : updated state, at t^n+1
 //               
 // RETURNS    : none.
@@ -103,7 +110,10 @@ void GExRKStepper<Grid,T>::step(const Time &t, const State &uin, State &uf,
 {
 
   assert(bRHS_  && "(1) RHS callback not set");
-  if ( bSSP_ ) {
+  if ( bLowStorage_ ) {
+    step_ls(t, uin, uf, dt, tmp, uout);
+  }
+  else if ( bSSP_ ) {
     step_ssp(t, uin, uf, dt, tmp, uout);
   }
   else {
@@ -124,8 +134,7 @@ void GExRKStepper<Grid,T>::step(const Time &t, const State &uin, State &uf,
 // ARGUMENTS  : t    : time, t^n, for state, uin=u^n
 //              uin  : initial (entry) state, u^n
 //              dt   : time step
-//              tmp  : tmp space. Must have at least NState*(M+1)+1 vectors,
-//                     where NState is the number of state vectors.
+//              tmp  : tmp space. Must have at least tmp_size vectors
 //               
 // RETURNS    : none.
 //**********************************************************************************
@@ -134,7 +143,10 @@ void GExRKStepper<Grid,T>::step(const Time &t, State &uin, State &uf,
                            const Time &dt, State &tmp)
 {
   assert(bRHS_  && "(2) RHS callback not set");
-  if ( bSSP_ ) {
+  if ( bLowStorage_ ) {
+    step_ls(t, uin, uf, dt, tmp, uin);
+  }
+  else if ( bSSP_ ) {
     step_ssp(t, uin, uf, dt, tmp);
   }
   else {
@@ -299,10 +311,10 @@ void GExRKStepper<Grid,T>::step_b(const Time &t, const State &uin, State &uf,
 
     // x^n+1 = x^n + h Sum_i=1^m c_i K_i, so
     // accumulate the sum in uout here: 
+    if ( ggfx_ != NULLPTR ) {
+      ggfx_->doOp(K_[m], nstate, typename GGFX<Ftype>::Smooth());
+    }
     for ( n=0; n<nstate; n++ ) { // for each state member, u
-      if ( ggfx_ != NULLPTR ) {
-        ggfx_->doOp(*K_[m][n], typename GGFX<Ftype>::Smooth());
-      }
       *isum     = (*K_[m][n]); *isum *= ( (*c)[m]*h );
       *uout[n] += *isum; // += h * c_m * k_m
     }
@@ -317,14 +329,16 @@ void GExRKStepper<Grid,T>::step_b(const Time &t, const State &uin, State &uf,
      for ( j=0,*isum=0.0; j<nstage_-1; j++ ) 
        GMTK::saxpby<T>(*isum,  1.0, *K_[j][n], (*beta)(nstage_-1,j)*h);
      *u[n]  = (*uin[n]); *u[n] += (*isum); // no copy const. called
-     ggfx_->doOp(*u[n], typename GGFX<Ftype>::Smooth());
+   }
+   if ( ggfx_ != NULLPTR ) {
+     ggfx_->doOp(u, nstate, typename GGFX<Ftype>::Smooth());
    }
    if ( grid_ != NULLPTR  ) GMTK::constrain2sphere<Grid,T>(*grid_, u);
 
    if ( bapplybc_  ) bdy_apply_callback_ (tt, u); 
    rhs_callback_( tt, u, uf, h, K_[0]); // k_M at stage M
-   for ( n=0; ggfx_!=NULLPTR && n<nstate; n++ ) { // for each state member, uout
-     ggfx_->doOp(*K_[0][n], typename GGFX<Ftype>::Smooth());
+   if ( ggfx_ != NULLPTR ) {
+     ggfx_->doOp(K_[0], nstate, typename GGFX<Ftype>::Smooth());
    }
 
    // Compute final output state, and set its bcs and
@@ -332,7 +346,9 @@ void GExRKStepper<Grid,T>::step_b(const Time &t, const State &uin, State &uf,
    for ( n=0; n<nstate; n++ ) { // for each state member, u
     *isum     = (*K_[0][n]); *isum *= ( (*c)[nstage_-1]*h );
     *uout[n] += *isum; // += h * c_M * k_M
-     ggfx_->doOp(*uout[n], typename GGFX<Ftype>::Smooth());
+   }
+   if ( ggfx_ != NULLPTR ) {
+     ggfx_->doOp(uout, nstate, typename GGFX<Ftype>::Smooth());
    }
    if ( grid_ != NULLPTR  ) GMTK::constrain2sphere<Grid,T>(*grid_, uout);
    if ( bapplybc_  ) bdy_apply_callback_ (tt, uout); 
@@ -409,9 +425,7 @@ void GExRKStepper<Grid,T>::step_b(const Time &t, State &uin, State &uf,
 
     if ( bapplybc_  ) bdy_apply_callback_ (tt, u); 
     if ( ggfx_ != NULLPTR ) {
-      for ( n=0; n<nstate; n++ ) { // for each state member, u
-        ggfx_->doOp(*u[n], typename GGFX<Ftype>::Smooth());
-      }
+      ggfx_->doOp(u, nstate, typename GGFX<Ftype>::Smooth());
     }
     rhs_callback_( tt, u, uf, h, K_[m] ); // k_m at stage m
 
@@ -427,8 +441,8 @@ void GExRKStepper<Grid,T>::step_b(const Time &t, State &uin, State &uf,
    for ( n=0; n<nstate; n++ ) { // for each state member, u
      for ( j=0,*isum=0.0; j<nstage_-1; j++ ) *isum += (*K_[j][n]) * ( (*beta)(nstage_-1,j)*h );
      *u[n] = (*uin[n]) + (*isum);
-      if ( ggfx_ != NULLPTR ) ggfx_->doOp(*u[n], typename GGFX<Ftype>::Smooth());
    }
+   if ( ggfx_ != NULLPTR ) ggfx_->doOp(u, nstate, typename GGFX<Ftype>::Smooth());
    if ( bapplybc_  ) bdy_apply_callback_ (tt, u); 
    rhs_callback_( tt, u, uf, h, K_[0]); // k_M at stage M
 
@@ -438,9 +452,7 @@ void GExRKStepper<Grid,T>::step_b(const Time &t, State &uin, State &uf,
 
    if ( bapplybc_  ) bdy_apply_callback_ (tt, uout); 
    if ( ggfx_ != NULLPTR ) {
-     for ( n=0; n<nstate; n++ ) { // for each state member, uouyt
-       ggfx_->doOp(*uout[n], typename GGFX<Ftype>::Smooth());
-     }
+     ggfx_->doOp(uout, nstate, typename GGFX<Ftype>::Smooth());
    }
    if ( bapplybc_  ) bdy_apply_callback_ (tt, uout); 
 
@@ -558,10 +570,8 @@ void GExRKStepper<Grid,T>::step_ssp34(const Time &t, const State &uin, State &uf
   }
   if ( bapplybc_  ) bdy_apply_callback_ (tt, K_[0]); 
   if ( grid_ != NULLPTR  ) GMTK::constrain2sphere<Grid,T>(*grid_, K_[0]);
-  for ( i=0; i<nstate; i++ )  {
-    if ( ggfx_ != NULLPTR ) {
-      ggfx_->doOp(*K_[0][i], typename GGFX<Ftype>::Smooth());
-    }
+  if ( ggfx_ != NULLPTR ) {
+    ggfx_->doOp(K_[0], nstate, typename GGFX<Ftype>::Smooth());
   }
  
   // Stage 2:
@@ -573,10 +583,8 @@ void GExRKStepper<Grid,T>::step_ssp34(const Time &t, const State &uin, State &uf
   }
   if ( bapplybc_  ) bdy_apply_callback_ (tt, K_[1]); 
   if ( grid_ != NULLPTR  ) GMTK::constrain2sphere<Grid,T>(*grid_, K_[1]);
-  for ( i=0; i<nstate; i++ )  {
-    if ( ggfx_ != NULLPTR ) {
-      ggfx_->doOp(*K_[1][i], typename GGFX<Ftype>::Smooth());
-    }
+  if ( ggfx_ != NULLPTR ) {
+    ggfx_->doOp(K_[1], nstate, typename GGFX<Ftype>::Smooth());
   }
  
   // Stage 3:
@@ -589,10 +597,8 @@ void GExRKStepper<Grid,T>::step_ssp34(const Time &t, const State &uin, State &uf
   }
   if ( bapplybc_  ) bdy_apply_callback_ (tt, K_[2]); 
   if ( grid_ != NULLPTR  ) GMTK::constrain2sphere<Grid,T>(*grid_, K_[2]);
-  for ( i=0; i<nstate; i++ )  {
-    if ( ggfx_ != NULLPTR ) {
-      ggfx_->doOp(*K_[2][i], typename GGFX<Ftype>::Smooth());
-    }
+  if ( ggfx_ != NULLPTR ) {
+    ggfx_->doOp(K_[2], nstate, typename GGFX<Ftype>::Smooth());
   }
 
   // Stage 4:
@@ -604,10 +610,8 @@ void GExRKStepper<Grid,T>::step_ssp34(const Time &t, const State &uin, State &uf
   }
   if ( bapplybc_  ) bdy_apply_callback_ (tt, uout); 
   if ( grid_ != NULLPTR  ) GMTK::constrain2sphere<Grid,T>(*grid_, uout);
-  for ( i=0; i<nstate; i++ )  {
-    if ( ggfx_ != NULLPTR ) {
-      ggfx_->doOp(*uout[i], typename GGFX<Ftype>::Smooth());
-    }
+  if ( ggfx_ != NULLPTR ) {
+    ggfx_->doOp(uout, nstate, typename GGFX<Ftype>::Smooth());
   }
   
 } // end of method step_ssp34
@@ -657,10 +661,8 @@ void GExRKStepper<Grid,T>::step_ssp33(const Time &t, const State &uin, State &uf
   step_euler(tt, uin, uf, dtt, K_[0]);   
   if ( bapplybc_  ) bdy_apply_callback_ (tt, K_[0]); 
   if ( grid_ != NULLPTR  ) GMTK::constrain2sphere<Grid,T>(*grid_, K_[0]);
-  for ( i=0; i<nstate; i++ )  {
-    if ( ggfx_ != NULLPTR ) {
-      ggfx_->doOp(*K_[0][i], typename GGFX<Ftype>::Smooth());
-    }
+  if ( ggfx_ != NULLPTR ) {
+    ggfx_->doOp(K_[0], nstate, typename GGFX<Ftype>::Smooth());
   }
  
   // Stage 2:
@@ -672,10 +674,8 @@ void GExRKStepper<Grid,T>::step_ssp33(const Time &t, const State &uin, State &uf
   }
   if ( bapplybc_  ) bdy_apply_callback_ (tt, K_[1]); 
   if ( grid_ != NULLPTR  ) GMTK::constrain2sphere<Grid,T>(*grid_, K_[1]);
-  for ( i=0; i<nstate; i++ )  {
-    if ( ggfx_ != NULLPTR ) {
-      ggfx_->doOp(*K_[1][i], typename GGFX<Ftype>::Smooth());
-    }
+  if ( ggfx_ != NULLPTR ) {
+    ggfx_->doOp(K_[1], nstate, typename GGFX<Ftype>::Smooth());
   }
  
   // Stage 3:
@@ -687,10 +687,8 @@ void GExRKStepper<Grid,T>::step_ssp33(const Time &t, const State &uin, State &uf
   }
   if ( bapplybc_  ) bdy_apply_callback_ (tt, uout); 
   if ( grid_ != NULLPTR  ) GMTK::constrain2sphere<Grid,T>(*grid_, uout);
-  for ( i=0; i<nstate; i++ )  {
-    if ( ggfx_ != NULLPTR ) {
-      ggfx_->doOp(*uout[i], typename GGFX<Ftype>::Smooth());
-    }
+  if ( ggfx_ != NULLPTR ) {
+    ggfx_->doOp(uout, nstate, typename GGFX<Ftype>::Smooth());
   }
 
 } // end of method step_ssp33
@@ -740,10 +738,8 @@ void GExRKStepper<Grid,T>::step_ssp22(const Time &t, const State &uin, State &uf
   step_euler(tt, uin, uf, dtt, K_[0]);   
   if ( bapplybc_  ) bdy_apply_callback_ (tt, K_[0]); 
   if ( grid_ != NULLPTR  ) GMTK::constrain2sphere<Grid,T>(*grid_,K_[0]);
-  for ( i=0; i<nstate; i++ )  {
-    if ( ggfx_ != NULLPTR ) {
-      ggfx_->doOp(*K_[0][i], typename GGFX<Ftype>::Smooth());
-    }
+  if ( ggfx_ != NULLPTR ) {
+    ggfx_->doOp(K_[0], nstate, typename GGFX<Ftype>::Smooth());
   }
  
   // Stage 2:
@@ -755,10 +751,8 @@ void GExRKStepper<Grid,T>::step_ssp22(const Time &t, const State &uin, State &uf
   }
   if ( bapplybc_  ) bdy_apply_callback_ (tt, uout); 
   if ( grid_ != NULLPTR  ) GMTK::constrain2sphere<Grid,T>(*grid_, uout);
-  for ( i=0; i<nstate; i++ )  {
-    if ( ggfx_ != NULLPTR ) {
-      ggfx_->doOp(*uout[i], typename GGFX<Ftype>::Smooth());
-    }
+  if ( ggfx_ != NULLPTR ) {
+    ggfx_->doOp(uout, nstate, typename GGFX<Ftype>::Smooth());
   }
  
 } // end of method step_ssp22
@@ -817,3 +811,163 @@ void GExRKStepper<Grid,T>::step_euler(const Time &t, const State &uin, State &uf
   }
 
 } // end, step_euler
+
+
+//**********************************************************************************
+//**********************************************************************************
+// METHOD     : tmp_size
+// DESCRIPTION: Find number of tmp vectors required by step methods
+// ARGUMENTS  : traits : this::Traits structure
+//              nstate : no. state vectors in state
+// RETURNS    : no. tmp vectors
+//**********************************************************************************
+template<typename Grid,typename T>
+GINT GExRKStepper<Grid,T>::tmp_size(const Traits &traits, GINT nstate)
+{
+  if ( traits.bLowStorage ) return 2*nstate;
+
+  return nstate*(traits.norder+1)+1;
+
+} // end of method tmp_size
+
+
+//**********************************************************************************
+//**********************************************************************************
+// METHOD     : init_ls
+// DESCRIPTION: Set coefficients for low-storage (2N-register) RK method
+//              of Williamson form (see step_ls). Supported (order, stages):
+//                (2,2): Heun's method (SSP RK2)
+//                (3,3): Williamson, J. Comput. Phys. 35:48 (1980)
+//                (4,5): Carpenter & Kennedy, NASA TM-109112 (1994),
+//                       solution 3
+// ARGUMENTS  : none.
+// RETURNS    : none.
+//**********************************************************************************
+template<typename Grid,typename T>
+void GExRKStepper<Grid,T>::init_ls()
+{
+  if      ( norder_ == 2 && nstage_ == 2 ) {
+    lsA_.resize(2); lsB_.resize(2); lsC_.resize(2);
+    lsA_[0] =  0.0; lsB_[0] = 1.0; lsC_[0] = 0.0;
+    lsA_[1] = -1.0; lsB_[1] = 0.5; lsC_[1] = 1.0;
+  }
+  else if ( norder_ == 3 && nstage_ == 3 ) {
+    lsA_.resize(3); lsB_.resize(3); lsC_.resize(3);
+    lsA_[0] =  0.0        ; lsB_[0] = 1.0/3.0  ; lsC_[0] = 0.0;
+    lsA_[1] = -5.0/9.0    ; lsB_[1] = 15.0/16.0; lsC_[1] = 1.0/3.0;
+    lsA_[2] = -153.0/128.0; lsB_[2] = 8.0/15.0 ; lsC_[2] = 3.0/4.0;
+  }
+  else if ( norder_ == 4 && nstage_ == 5 ) {
+    lsA_.resize(5); lsB_.resize(5); lsC_.resize(5);
+    lsA_[0] =  0.0;
+    lsA_[1] = -567301805773.0 /1357537059087.0;
+    lsA_[2] = -2404267990393.0/2016746695238.0;
+    lsA_[3] = -3550918686646.0/2091501179385.0;
+    lsA_[4] = -1275806237668.0/842570457699.0;
+    lsB_[0] =  1432997174477.0/9575080441755.0;
+    lsB_[1] =  5161836677717.0/13612068292357.0;
+    lsB_[2] =  1720146321549.0/2090206949498.0;
+    lsB_[3] =  3134564353537.0/4481467310338.0;
+    lsB_[4] =  2277821191437.0/14882151754819.0;
+    lsC_[0] =  0.0;
+    lsC_[1] =  1432997174477.0/9575080441755.0;
+    lsC_[2] =  2526269341429.0/6820363183471.0;
+    lsC_[3] =  2006345519317.0/3224310063776.0;
+    lsC_[4] =  2802321613138.0/2924317926251.0;
+  }
+  else {
+    assert(FALSE && "Invalid low-storage order/no. stages");
+  }
+
+} // end of method init_ls
+
+
+//**********************************************************************************
+//**********************************************************************************
+// METHOD     : step_ls
+// DESCRIPTION: Computes one low-storage (2N-register) RK step at specified
+//              timestep. Note: callback to RHS-computation function must
+//              be set prior to entry. Given coefficients A_m, B_m, and
+//              nodes c_m, m = 1, ..., M, each stage is
+//                 dU  = A_m dU + dt RHS(t^n + c_m dt, U),
+//                 U   = U + B_m dU,
+//              with U = u^n initially, and U = u^n+1 on exit. Only U
+//              and dU persist between stages, and both are updated
+//              in one sweep per stage.
+//
+// ARGUMENTS  : t    : time, t^n, for state, uin=u^n
+//              uin  : initial (entry) state, u^n; may be the same as uout
+//              uf   : forcing tendency
+//              dt   : time step
+//              tmp  : tmp space. Must have at least 2*NState vectors,
+//                     where NState is the number of state vectors.
+//              uout : updated state, at t^n+1
+//
+// RETURNS    : none.
+//**********************************************************************************
+template<typename Grid,typename T>
+void GExRKStepper<Grid,T>::step_ls(const Time &t, const State &uin, State &uf,
+                           const Time &dt, State &tmp, State &uout)
+{
+  GSIZET       m, n, nn, nstate=uin.size();
+  Ftype        tt;
+  T            a, b, *du, *f, *u;
+
+  assert(tmp.size() >= 2*nstate && "Insufficient tmp space");
+
+  State dU(nstate);  // stage increment register
+  State F (nstate);  // RHS
+
+  for ( n=0; n<nstate; n++ ) {
+    dU[n] = tmp[n];
+    F [n] = tmp[nstate+n];
+    if ( uout[n] != uin[n] ) *uout[n] = *uin[n]; // deep copy
+  }
+
+  tt = t;
+  if ( bapplybc_  ) bdy_apply_callback_ (tt, uout);
+
+  for ( m=0; m<nstage_; m++ ) { // cycle thru stages
+    tt = t + lsC_[m]*dt;
+    rhs_callback_( tt, uout, uf, dt, F );
+    if ( ggfx_ != NULLPTR ) {
+      ggfx_->doOp(F, nstate, typename GGFX<Ftype>::Smooth());
+    }
+
+    // dU = A_m dU + dt F; U += B_m dU. A_0 = 0, and dU
+    // is not read on the first stage:
+    a = lsA_[m];
+    b = lsB_[m];
+    for ( n=0; n<nstate; n++ ) { // for each state member
+      du = dU  [n]->data();
+      f  = F   [n]->data();
+      u  = uout[n]->data();
+      nn = uout[n]->size();
+      if ( m == 0 ) {
+        GEXEC_PARALLEL_FOR(nn)
+        for ( GSIZET j=0; j<nn; j++ ) {
+          du[j]  = dt*f[j];
+          u [j] += b*du[j];
+        }
+      }
+      else {
+        GEXEC_PARALLEL_FOR(nn)
+        for ( GSIZET j=0; j<nn; j++ ) {
+          du[j]  = a*du[j] + dt*f[j];
+          u [j] += b*du[j];
+        }
+      }
+    }
+
+    tt = m < nstage_-1 ? t + lsC_[m+1]*dt : t + dt;
+    if ( grid_ != NULLPTR  ) GMTK::constrain2sphere<Grid,T>(*grid_, uout);
+    if ( bapplybc_  ) bdy_apply_callback_ (tt, uout);
+  } // end, m-loop over stages
+
+  if ( ggfx_ != NULLPTR ) {
+    ggfx_->doOp(uout, nstate, typename GGFX<Ftype>::Smooth());
+  }
+  if ( grid_ != NULLPTR  ) GMTK::constrain2sphere<Grid,T>(*grid_, uout);
+  if ( bapplybc_  ) bdy_apply_callback_ (tt, uout);
+
+} // end of method step_ls
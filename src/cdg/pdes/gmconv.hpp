@@ -142,6 +142,7 @@ public:
           GBOOL           Stokeshyp   = FALSE;  // use Stokes hypothesis
           GBOOL           bindepdiss  = FALSE;  // indep. mom & energy diss?
           GBOOL           bSSP        = FALSE;  // use strong stab pres RK?
+          GBOOL           bLowStorage = FALSE;  // use low-storage (2N) RK?
           GINT            nstate      = GDIM+2; // no. vars in state vec
           GINT            nsolve      = GDIM+2; // no. vars to solve for
           GINT            nlsector    = 0;      // no. vars in liq-sector
@@ -232,6 +233,9 @@ private:
         void                cycle_keep   (const State &u);
 inline  void                compute_cv   (const State &u, StateComp &utmp, StateComp &cv);
 inline  void                compute_qd   (const State &u, StateComp &qd);
+inline  void                compute_thermo(const State &u, StateComp *rhoT, StateComp *irhoT,
+                                          State *v, StateComp *p, StateComp *T,
+                                          GTVector<Ftype> *vcmax);
 inline  void                compute_falloutsrc
                                          (StateComp &g, State &qi, State &v, GINT jexcl, State &utmp, StateComp &r );
 inline  void                compute_vpref(StateComp &tv, State &W);
@@ -67,7 +67,7 @@ steptop_callback_      (NULLPTR)
          && "Must dograv with base state");
   }
 
-  pthis_.reset(this);
+  pthis_.reset(this, [](EquationBase<Types> *) {}); // non-owning
 
 } // end of constructor method (1)
 
@@ -112,12 +112,8 @@ void GMConv<TypePack>::dt_impl(const Time &t, State &u, Time &dt)
   GString    serr = "GMConv<TypePack>::dt_impl: ";
   Ftype      dtmin, dt1, dtnew, dtvisc;
   Ftype      tiny = 100.0*std::numeric_limits<Ftype>::epsilon();
-  StateComp *csq, *p, *T;
-  StateComp *rhoT, *tmp1, *tmp2;
   StateComp *dxmin;
 
-  assert(utmp_.size() >= 5 );
-
   // This is an estimate. We assume the timestep is
   // is governed by fast sonic waves with speed
   //  |v| + c,
@@ -129,47 +125,11 @@ void GMConv<TypePack>::dt_impl(const Time &t, State &u, Time &dt)
   // Here, approximate |v| + c as sqrt(v^2 + c^2)
    
 
-  // Assign pointers:
-  p    = utmp_[0];
-  rhoT = utmp_[1];
-  tmp1 = utmp_[2];
-  tmp2 = utmp_[3];
-  T    = utmp_[4];
-
   dxmin = &grid_->dxmin();
 
- *rhoT = *u[DENSITY]; 
-  if ( traits_.usebase ) *rhoT += *ubase_[0];
- *tmp1 = *rhoT; tmp1->rpow(-1.0);
-  compute_v(u, *tmp1, v_); 
-
-  compute_cv(u, *tmp1, *tmp2);                                 // Cv
-  geoflow::compute_temp<Ftype>(*u[ENERGY], *rhoT, *tmp2, *T);  // temperature
-
-  compute_qd(u, *tmp1);                                        // dry mass ratio
-  geoflow::compute_p<Ftype>(*T, *rhoT, *tmp1, RD, *p);         // partial pressure for dry air
-  if ( !traits_.dodry ) {
-    geoflow::compute_p<Ftype>(*T, *rhoT, *u[VAPOR], RV, *tmp1); // partial pressure for vapor
-   *p += *tmp1;
-  }
-
-  csq = utmp_[4];
-  for ( auto j=0; j<p->size(); j++ ) {     // sound speed, csq
-    (*csq)[j] = (*p)[j] / (*rhoT)[j] ;
-  }
-
-   // Compute v^2 + c^2:
-  *tmp1 = *v_[0]; tmp1->rpow(2);
-   for ( auto k=1; k<v_.size(); k++ ) {    // each advecting v 
-     for ( auto j=0; j<v_[0]->size(); j++ ) { // v^2
-       (*tmp1)[j] += (*v_[k])[j] * (*v_[k])[j];
-     }
-   }
-   *tmp1 += *csq;                          // v^2 + c^2
-
-  
-   // Compute max(v^2 + c^2) for each element:
-   GMTK::maxbyelem<Grid,Ftype>(*grid_, *tmp1, maxbyelem_);
+  // Compute max(v^2 + c^2) for each element, in one pass
+  // over the state:
+  compute_thermo(u, NULLPTR, NULLPTR, NULLPTR, NULLPTR, NULLPTR, &maxbyelem_);
 
    // Estimate viscous timescale:
    dtvisc = std::numeric_limits<Ftype>::max();
@@ -245,12 +205,12 @@ void GMConv<TypePack>::dudt_dry(const Time &t, const State &u, const State &uf,
 
   GString    serr = "GMConv<TypePack>::dudt_dry: ";
   GINT       nice, nliq ;
-  StateComp *irhoT;
   StateComp *dd, *e, *p, *rhoT, *T; // energy, den, pressure, temperature
   StateComp *Mass=grid_->massop().data();
   StateComp *tmp1, *tmp2;
   StateComp *mask=&grid_->get_mask();
   State      stmp(4);
+  State      gradp(nc_);
 
   typename Grid::BinnedBdyIndex *igb = &grid_->igbdy_binned();
 
@@ -265,30 +225,22 @@ void GMConv<TypePack>::dudt_dry(const Time &t, const State &u, const State &uf,
   assert(urhstmp_.size() >= szrhstmp());
   for ( auto j=0; j<stmp.size(); j++ ) stmp[j]=urhstmp_[j];
   rhoT  = urhstmp_[stmp.size()+0];
-  irhoT = urhstmp_[stmp.size()+1];
   tmp1  = urhstmp_[stmp.size()+2];
   tmp2  = urhstmp_[stmp.size()+3];
+  for ( auto j=0; j<nc_; j++ ) gradp[j] = urhstmp_[szrhstmp()-nc_+j];
 
-  // Get total density and inverse: *rhoT  = *u[DENSITY]; 
-  *rhoT = *u[DENSITY];
-  if ( traits_.usebase ) *rhoT +=  *ubase_[0];   
- *irhoT = *rhoT; irhoT->rpow(-1.0); // 1/rhoT
+  p     = urhstmp_[stmp.size()+1]; // holds pressure
+  e     = u[ENERGY];               // current internal energy density
 
-  // Compute velocity for timestep:
-  compute_v(s_, *irhoT, v_); // stored in v_
+  // Get total density, velocity, and pressure in one pass:
+  compute_thermo(u, rhoT, NULLPTR, &v_, p, NULLPTR, NULLPTR);
   
   // Compute all terms as though they are on the LHS, then
   // change the sign and divide by Mass at the end....
 
-  p     = urhstmp_[stmp.size()+1]; // holds pressure
-  e     = u[ENERGY];               // current internal energy density
-
   // *************************************************************
   // Energy equation RHS:
   // *************************************************************
-  compute_cv(u, *tmp1, *tmp2);                            // Cv
-  compute_qd(u, *tmp1);                                   // dry mass ratio
-  geoflow::compute_p<Ftype>(*e, *tmp1, RD, *tmp2, *p);    // partial pressure for dry air
 
 //set_stagnation(*rhoT, v_, urhstmp_, *p, *e);
 
@@ -329,22 +281,22 @@ void GMConv<TypePack>::dudt_dry(const Time &t, const State &u, const State &uf,
    *dd -= *ubase_[0];                  // density fluctuation
    *p  -= *ubase_[1];                  // pressure fluctuation
   }
+  grid_->grad(*p, TRUE, *tmp2, gradp);                // Grad p', all comps
   for ( auto j=0; j<s_.size(); j++ ) { // for each component
 
     gdiv_->apply(*s_[j], v_, stmp, *dudt[j], -2); //j+1 );
 
-    grid_->deriv(*p, j+1, *tmp2, *tmp1);              // Grad p'
 #if defined(GEOFLOW_USE_NEUMANN_HACK)
 if ( j==0) {
-GMTK::zero<Ftype>(*tmp1,(*igb)[1][GBDY_0FLUX]);
-GMTK::zero<Ftype>(*tmp1,(*igb)[3][GBDY_0FLUX]);
+GMTK::zero<Ftype>(*gradp[j],(*igb)[1][GBDY_0FLUX]);
+GMTK::zero<Ftype>(*gradp[j],(*igb)[3][GBDY_0FLUX]);
 } else {
-GMTK::zero<Ftype>(*tmp1,(*igb)[0][GBDY_0FLUX]);
-GMTK::zero<Ftype>(*tmp1,(*igb)[2][GBDY_0FLUX]);
+GMTK::zero<Ftype>(*gradp[j],(*igb)[0][GBDY_0FLUX]);
+GMTK::zero<Ftype>(*gradp[j],(*igb)[2][GBDY_0FLUX]);
 }
 #endif
-   *tmp1 *= *Mass;                                    // M Grad p' 
-   *dudt[j] += *tmp1;                                 // += Grad p'
+   *gradp[j] *= *Mass;                                // M Grad p' 
+   *dudt[j] += *gradp[j];                             // += Grad p'
 
 #if 0
     if ( traits_.docoriolis ) {
@@ -410,6 +362,7 @@ void GMConv<TypePack>::dudt_wet(const Time &t, const State &u, const State &uf,
   StateComp *tmp1, *tmp2;
   State      g(nc_); 
   State      stmp(4);
+  State      gradp(nc_);
 
   // NOTE:
   // Make sure that, in init(), Helmholtz op is using only
@@ -429,15 +382,15 @@ void GMConv<TypePack>::dudt_wet(const Time &t, const State &u, const State &uf,
   irhoT = urhstmp_[stmp.size()+2];
   tmp1  = urhstmp_[stmp.size()+3];
   tmp2  = urhstmp_[stmp.size()+4];
+  T     = urhstmp_[stmp.size()+5]; // holds temperature
+  p     = urhstmp_[stmp.size()+6]; // holds pressure
+  e     = u[ENERGY];                   // internal energy density
+  for ( auto j=0; j<nc_; j++ ) gradp[j] = urhstmp_[szrhstmp()-nc_+j];
 
 
-  // Get total density and inverse: *rhoT  = *u[DENSITY]; 
- *rhoT = *u[DENSITY];
-  if ( traits_.usebase ) *rhoT +=  *ubase_[0];   
- *irhoT = *rhoT; irhoT->rpow(-1.0);
-
-  // Compute velocity for timestep:
-  compute_v(s_, *irhoT, v_); // stored in v_
+  // Get total density and inverse, velocity, temperature,
+  // and pressure in one pass:
+  compute_thermo(u, rhoT, irhoT, &v_, p, T, NULLPTR);
   
   // Compute all operators as though they are on the LHS, then
   // change the sign and add Mass at the end....
@@ -479,22 +432,9 @@ void GMConv<TypePack>::dudt_wet(const Time &t, const State &u, const State &uf,
     }
   }
  
-  p     = urhstmp_[stmp.size()+2]; // holds pressure
-  T     = urhstmp_[stmp.size()+5]; // holds temperature
-  e     = u[ENERGY];                   // internal energy density
-
   // *************************************************************
   // Energy equation RHS:
   // *************************************************************
-  compute_cv(u, *tmp1, *tmp2);                            // Cv
-  geoflow::compute_temp<Ftype>(*e, *rhoT, *tmp2, *T);     // temperature
-  compute_qd  (u, *tmp1);                                 // dry mass ratio
-  geoflow::compute_p<Ftype>(*T, *rhoT, *tmp1, RD, *p);    // partial pressure for dry air
-  if ( !traits_.dodry ) {
-    geoflow::compute_p<Ftype>(*T, *rhoT, *u[VAPOR], RV, *tmp1); // partial pressure for vapor
-   *p += *tmp1;
-  }
-
   GMTK::saxpby<Ftype>(*tmp1, *e, 1.0, *p, 1.0);    // h = p+e, enthalpy density
 
   gdiv_->apply(*tmp1, v_, stmp, *dudt[ENERGY]); 
@@ -541,6 +481,7 @@ void GMConv<TypePack>::dudt_wet(const Time &t, const State &u, const State &uf,
    *dd -= *ubase_[0];                 // density fluctuation
    *p  -= *ubase_[1];                 // pressure fluctuation
   }
+  grid_->grad(*p, TRUE, *tmp2, gradp);                // Grad p', all comps
   for ( auto j=0; j<s_.size(); j++ ) { // for each component
 
     gdiv_->apply(*s_[j], v_, stmp, *dudt[j]); 
@@ -555,9 +496,8 @@ void GMConv<TypePack>::dudt_wet(const Time &t, const State &u, const State &uf,
     grid_->wderiv(*p, j+1, TRUE, *tmp2, *tmp1);       // Grad p'
    *dudt[j] -= *tmp1;                                 // -= Grad p'
 #else
-    grid_->deriv(*p, j+1, *tmp2, *tmp1);              // Grad p'
-   *tmp1 *= *Mass;                                    // M Grad p' 
-   *dudt[j] += *tmp1;                                 // += Grad p'
+   *gradp[j] *= *Mass;                                // M Grad p' 
+   *dudt[j] += *gradp[j];                             // += Grad p'
 #endif
 
     gstressen_->apply(*rhoT, v_, j+1, stmp, 
@@ -876,9 +816,10 @@ void GMConv<TypePack>::init_impl(State &u, State &tmp)
   typename GExRKStepper<Grid,Ftype>::Traits rktraits;
   switch ( traits_.isteptype ) {
     case GSTEPPER_EXRK:
-      rktraits.bSSP   = traits_.bSSP;
-      rktraits.norder = traits_.itorder;
-      rktraits.nstage = traits_.nstage;
+      rktraits.bSSP        = traits_.bSSP;
+      rktraits.bLowStorage = traits_.bLowStorage;
+      rktraits.norder      = traits_.itorder;
+      rktraits.nstage      = traits_.nstage;
       gexrk_ = new GExRKStepper<Grid,Ftype>(rktraits, *grid_);
       gexrk_->setRHSfunction(rhs);
       gexrk_->set_apply_bdy_callback(applybc);
@@ -887,7 +828,7 @@ void GMConv<TypePack>::init_impl(State &u, State &tmp)
       // we're sure there's no overlap:
       uold_   .resize(traits_.nsolve); // RK-solution at time level n
       uevolve_.resize(traits_.nsolve); // current RK solution
-      urktmp_ .resize(traits_.nsolve*(traits_.itorder+1)+1); // RK stepping work space
+      urktmp_ .resize(GExRKStepper<Grid,Ftype>::tmp_size(rktraits, traits_.nsolve)); // RK stepping work space
       urhstmp_.resize(szrhstmp());     // work space for RHS
       nrhstmp = utmp_.size()-uold_.size()-urktmp_.size();
 
@@ -1128,18 +1069,17 @@ void GMConv<TypePack>::compute_cv(const State &u, StateComp &utmp, StateComp &cv
    utmp    -= (*u[VAPOR]);      // -q_v
    cv       = (*u[VAPOR])*CVV;  // Cv = Cvv * q_vapor
    ibeg     = LIQMASS;
-   for ( auto k=ibeg; k<ibeg+traits_.nlsector+1; k++ ) { // liquids
+   for ( auto k=ibeg; k<ibeg+traits_.nlsector; k++ ) { // liquids
       utmp    -= *u[k];         // subtract in ql_k
-      GMTK::saxpby<Ftype>(cv, 0.0, *u[k], CVL); // add in Cvl * ql_k
+      GMTK::saxpby<Ftype>(cv, 1.0, *u[k], CVL); // add in Cvl * ql_k
    }
-   ibeg = LIQMASS + traits_.nlsector;;
+   ibeg = LIQMASS + traits_.nlsector;
    for ( auto k=ibeg; k<ibeg+traits_.nisector; k++ ) { // ices
      utmp    -= *u[k];         // subtract in qi_k
-     cv       += (*u[k]) * CVI; // add in Cvi * qi_k
-     GMTK::saxpby<Ftype>(cv, 0.0, *u[k], CVI); // add in Cvi * qi_k
+     GMTK::saxpby<Ftype>(cv, 1.0, *u[k], CVI); // add in Cvi * qi_k
    }
    // After subtracting q_i, final result is qd=q_dry, so:
-   GMTK::saxpby<Ftype>(cv, 0.0, utmp, CVD); // Final Cv += Cvd * qd
+   GMTK::saxpby<Ftype>(cv, 1.0, utmp, CVD); // Final Cv += Cvd * qd
 
 } // end of method compute_cv
 
@@ -1166,10 +1106,10 @@ void GMConv<TypePack>::compute_qd(const State &u, StateComp &qd)
 
    qd -= (*u[VAPOR]);      // running total 1- Sum_k q_k
    ibeg = LIQMASS;
-   for ( auto k=ibeg; k<ibeg+traits_.nlsector+1; k++ ) { // liquids
+   for ( auto k=ibeg; k<ibeg+traits_.nlsector; k++ ) { // liquids
      qd -= *u[k];         // subtract in ql_k
    }
-   ibeg = LIQMASS + traits_.nlsector;;
+   ibeg = LIQMASS + traits_.nlsector;
    for ( auto k=ibeg; k<ibeg+traits_.nisector; k++ ) { // ices
      qd  -= *u[k];         // subtract in qi_k
    }
@@ -1177,6 +1117,116 @@ void GMConv<TypePack>::compute_qd(const State &u, StateComp &qd)
 } // end of method compute_qd
 
 
+//**********************************************************************************
+//**********************************************************************************
+// METHOD : compute_thermo
+// DESC   : Compute, in a single pass over nodes, the pointwise
+//          thermodynamic quantities required by the RHS and timestep:
+//             rhoT = d (+ d_base),  v_i = s_i / rhoT,
+//             qd   = 1 - qv - Sum_i ql_i - Sum_j qi_j,
+//             Cv   = Cvd qd + Cvv qv + Sum_i(Cl_i ql_i) + Sum_j(Ci_j qi_j),
+//             T    = e / (rhoT Cv),
+//             p    = rhoT (qd Rd + qv Rv) T,
+//          and, for each element, max(v^2 + c^2), with c^2 = p/rhoT.
+//          Only quantities with non-NULL output arguments are
+//          stored, so no tmp space is needed for intermediate
+//          quantities.
+// ARGS   : u    : state
+//          rhoT : total density; may be NULLPTR
+//          irhoT: 1/rhoT; may be NULLPTR
+//          v    : velocity; may be NULLPTR. If state isn't in momentum
+//                 density form, components point to state on exit
+//          p    : total pressure; may be NULLPTR
+//          T    : temperature; may be NULLPTR
+//          vcmax: max(v^2 + c^2) on each element; may be NULLPTR
+// RETURNS: none.
+//**********************************************************************************
+template<typename TypePack>
+void GMConv<TypePack>::compute_thermo(const State &u, StateComp *rhoT, StateComp *irhoT,
+                                      State *v, StateComp *p, StateComp *T,
+                                      GTVector<Ftype> *vcmax)
+{
+   GString      serr = "GMConv<TypePack>::compute_thermo: ";
+   GBOOL        bdry  = traits_.dodry;
+   GINT         nliq  = bdry ? 0 : traits_.nlsector;
+   GINT         nh    = bdry ? 0 : traits_.nlsector + traits_.nisector;
+   GSIZET       ne    = grid_->nelems();
+   Ftype       *pd, *pdb, *pe, *pqv;
+   Ftype       *prho, *pirho, *pp, *pT, *pvcm;
+   Ftype       *ps[3], *pv[3];
+   GTVector<Ftype*>
+                pq(nh);
+   typename Grid::GElemList *gelems = &grid_->elems();
+
+   assert(nc_ <= 3);
+
+   pd    = u[DENSITY]->data();
+   pdb   = traits_.usebase ? ubase_[0]->data() : NULLPTR;
+   pe    = u[ENERGY] ->data();
+   pqv   = bdry            ? NULLPTR : u[VAPOR]->data();
+   prho  = rhoT  != NULLPTR ? rhoT ->data() : NULLPTR;
+   pirho = irhoT != NULLPTR ? irhoT->data() : NULLPTR;
+   pp    = p     != NULLPTR ? p    ->data() : NULLPTR;
+   pT    = T     != NULLPTR ? T    ->data() : NULLPTR;
+   for ( auto k=0; k<nh; k++ ) pq[k] = u[LIQMASS+k]->data(); // liquids, then ices
+   for ( auto i=0; i<nc_; i++ ) {
+     ps[i] = u[i]->data();
+     pv[i] = NULLPTR;
+     if ( v == NULLPTR ) continue;
+     if ( traits_.usemomden ) pv[i] = (*v)[i]->data();
+     else                    (*v)[i] = u[i];  // state is velocity
+   }
+   if ( vcmax != NULLPTR ) vcmax->resizem(ne);
+   pvcm  = vcmax != NULLPTR ? vcmax->data() : NULLPTR;
+
+   GEXEC_PARALLEL_FOR_ELEMS(ne)
+   for ( GSIZET e=0; e<ne; e++ ) {
+     GSIZET ibeg = (*gelems)[e]->igbeg();
+     GSIZET iend = ibeg + (*gelems)[e]->nnodes();
+     Ftype  rho, irho, vi, vsq, qd, qv, cv, tt, pres, vcm=0.0;
+     for ( GSIZET j=ibeg; j<iend; j++ ) {
+       rho  = pdb != NULLPTR ? pd[j] + pdb[j] : pd[j];
+       irho = 1.0 / rho;
+
+       // Velocity, and its square:
+       vsq  = 0.0;
+       for ( auto i=0; i<nc_; i++ ) {
+         vi   = traits_.usemomden ? ps[i][j]*irho : ps[i][j];
+         vsq += vi*vi;
+         if ( pv[i] != NULLPTR ) pv[i][j] = vi;
+       }
+
+       // Dry mass fraction, specific heat:
+       qd   = 1.0;
+       qv   = 0.0;
+       cv   = CVD;
+       if ( !bdry ) {
+         qv  = pqv[j];
+         qd -= qv;
+         cv  = CVV*qv;
+         for ( auto k=0; k<nh; k++ ) {
+           qd -= pq[k][j];
+           cv += (k < nliq ? CVL : CVI) * pq[k][j];
+         }
+         cv += CVD*qd;
+       }
+
+       // Temperature, and pressure from partial pressures:
+       tt   = pe[j] * irho / cv;
+       pres = rho * (qd*RD + qv*RV) * tt;
+
+       if ( prho  != NULLPTR ) prho [j] = rho;
+       if ( pirho != NULLPTR ) pirho[j] = irho;
+       if ( pT    != NULLPTR ) pT   [j] = tt;
+       if ( pp    != NULLPTR ) pp   [j] = pres;
+       vcm = MAX(vcm, vsq + pres*irho);
+     }
+     if ( pvcm != NULLPTR ) pvcm[e] = vcm;
+   }
+
+} // end of method compute_thermo
+
+
 //**********************************************************************************
 //**********************************************************************************
 // METHOD : compute_v (1)
@@ -1207,7 +1257,7 @@ void GMConv<TypePack>::compute_v(const State &u, StateComp &dinv, State &v)
    
    for ( auto j=0; j<v.size(); j++ ) {
      *v[j]  = *u[j];  // deep copy
-     *v[j] *= dinv[j];  // divide by density
+     *v[j] *= dinv;     // divide by density
    }
 
 } // end of method compute_v (1)
@@ -1241,7 +1291,7 @@ void GMConv<TypePack>::compute_v(const State &u, GINT idir, StateComp &id, State
 
    // Find velocity from momentum density:
    v  = *u[idir-1];  // deep copy
-   v *= id[idir-1];  // divide by density
+   v *= id;          // divide by density
 
 } // end of method compute_v (2)
 
@@ -1612,7 +1662,8 @@ GINT GMConv<TypePack>::szrhstmp()
   if ( traits_.dofallout && !traits_.dodry ) maxop = MAX(5,maxop);
 
   sum += maxop;
-  sum += 6;              // size for misc tmp space in dudt_impl
+  sum += 7;              // size for misc tmp space in dudt_impl
+  sum += nc_;            // Grad p in dudt_impl, dudt_dry
 
 
   return sum;
@@ -1630,13 +1681,17 @@ template<typename TypePack>
 GINT GMConv<TypePack>::tmp_size_impl()
 {
   GINT sum = 0;
+  typename GExRKStepper<Grid,Ftype>::Traits rktraits;
+
+  rktraits.bLowStorage = traits_.bLowStorage;
+  rktraits.norder      = traits_.itorder;
  
   sum += nc_;                                 // for v_ 
   sum += traits_.nlsector || traits_.nisector ? nc_ : 0;  // for W_
   sum += traits_.nfallout;                   // size for fallout speeds
   sum += traits_.nsolve;                     // old state storage
-  sum += traits_.nsolve
-       * (traits_.itorder+1)+1;              // RKK storage
+  sum += GExRKStepper<Grid,Ftype>
+         ::tmp_size(rktraits, traits_.nsolve); // RK storage
   sum += szrhstmp();                         // RHS tmp size
  
   return sum;
@@ -12,6 +12,7 @@
 #include "gtvector.hpp"
 #include "gutils.hpp"
 #include "gmconv.hpp"
+#include "gdiag_aggregator.hpp"
 #include "pdeint/equation_base.hpp"
 #include "pdeint/observer_base.hpp"
 #include "tbox/property_tree.hpp"
@@ -47,20 +48,24 @@ public:
 
                            GMConvDiag() = delete;
                            GMConvDiag(EqnBasePtr &equation, Grid &grid, typename ObserverBase<EquationType>::Traits &traits);
-                          ~GMConvDiag() = default ;
+                          ~GMConvDiag();
                            GMConvDiag(const GMConvDiag &a) = default;
                            GMConvDiag &operator=(const GMConvDiag &bu) = default;
 
         void               observe_impl(const Time &t, const Time &dt, const State &u, const State &uf);
 
         void               init_impl(StateInfo &);
+        void               set_grid_impl(EqnBasePtr &equation, Grid &grid);
 private:
 // Private methods:
-        void               do_L2 (const Time &t, const Time &dt, const State &u, const State &uf, const GString file);
-        void               do_max(const Time &t, const Time &dt, const State &u, const State &uf, const GString file);
+        void               do_L2 (const Time &t, const Time &dt, const State &u, const State &uf);
+        void               do_max(const Time &t, const Time &dt, const State &u, const State &uf);
 // Private data:
         GBOOL              bInit_;
         GINT               myrank_;     // MPI rank
+        GINT               iclient_;    // id as diagnostics aggregator client
+        GINT               isL2_;       // aggregator stream for L2 quantities
+        GINT               ismax_;      // aggregator stream for max quantities
         GSIZET             cycle_last_; // most recent output cycle
         GSIZET             cycle_;      // continuously-running cycle
         GSIZET             ocycle_;     // output cycle number
@@ -30,15 +30,33 @@ grid_           (&grid)
   solver_ = dynamic_cast<GMConv<EquationType>*>(equation.get());
   assert(solver_); // must be for GMConv
 
+  iclient_ = GDiagAggregator<Ftype>::instance().add_client(grid.get_comm());
+
 } // end of constructor (1) method
 
 
+//**********************************************************************************
+//**********************************************************************************
+// METHOD : Destructor method 
+// DESC   : De-register from diagnostics aggregator
+// ARGS   : none
+//**********************************************************************************
+template<typename EquationType>
+GMConvDiag<EquationType>::~GMConvDiag()
+{
+  GDiagAggregator<Ftype>::instance().remove_client(iclient_);
+
+} // end of destructor method
+
+
 //**********************************************************************************
 //**********************************************************************************
 // METHOD     : observe_impl
 // DESCRIPTION: Compute energy, enstrophy, helicity, and energy injection, 
 //              and output to one file. Compute max of energy, enstrophy,
-//              and output to another file.
+//              and output to another file. Reductions and output are
+//              carried out by the diagnostics aggregator, which must
+//              be told that this observer is done each time it's called.
 //
 // ARGUMENTS  : t    : time, t^n, for state, uin=u^n
 //              dt   : time step
@@ -62,13 +80,15 @@ void GMConvDiag<EquationType>::observe_impl(const Time &t, const Time &dt, const
         &&  (t-time_last_ >= traits_.time_interval))
     || (cycle_ == 0) ) {
 
-    do_L2 (t, dt, u, uf, "gbalance.txt");
-    do_max(t, dt, u, uf, "gmax.txt");
+    do_L2 (t, dt, u, uf);
+    do_max(t, dt, u, uf);
     cycle_last_ = cycle_;
     time_last_  = t;
     ocycle_++;
   }
   cycle_++;
+
+  GDiagAggregator<Ftype>::instance().done(iclient_);
   
 } // end of method observe_impl
 
@@ -94,24 +114,64 @@ void GMConvDiag<EquationType>::init_impl(StateInfo &info)
    time_last_  = this->traits_.start_time ;
    ocycle_     = this->traits_.start_ocycle;
 
+   // Register output files with aggregator; header
+   // quantities are global, so must be found by all tasks:
+   GSIZET             ne;
+   Ftype              dxmin, elmin, elmax, elavg;
+   std::ostringstream os;
+
+   ne    = grid_->ngelems();
+   dxmin = grid_->minnodedist();
+   elmin = grid_->minlength();
+   elmax = grid_->maxlength();
+   elavg = grid_->avglength();
+   os << "#nelems=" << ne << " dxmin=" << dxmin << " elmin=" << elmin << " elmax=" << elmax << " elavg=" << elavg << std::endl;
+
+   GDiagAggregator<Ftype> &agg = GDiagAggregator<Ftype>::instance();
+   isL2_  = agg.add_stream(sodir_ + "/gbalance.txt",
+                           os.str() + "#time    dt      Mass       <e>         <d KE>     \n", TRUE);
+   ismax_ = agg.add_stream(sodir_ + "/gmax.txt",
+                           os.str() + "#time    dt      den_tot        e           d KE      \n", TRUE);
+
    bInit_ = TRUE;
  
 } // end of method init_impl
 
 
+//**********************************************************************************
+//**********************************************************************************
+// METHOD     : set_grid_impl
+// DESCRIPTION: Re-target observer to new equation and grid,
+//              e.g., after repartitioning
+// ARGUMENTS  : equation: new equation
+//              grid    : new grid
+// RETURNS    : none.
+//**********************************************************************************
+template<typename EquationType>
+void GMConvDiag<EquationType>::set_grid_impl(EqnBasePtr &equation, Grid &grid)
+{
+  GEOFLOW_TRACE();
+
+  grid_   = &grid;
+  solver_ = dynamic_cast<GMConv<EquationType>*>(equation.get());
+  assert(solver_); // must be for GMConv
+
+} // end of method set_grid_impl
+
+
 //**********************************************************************************
 //**********************************************************************************
 // METHOD     : do_L2
-// DESCRIPTION: Compute integrated diagnostic quantities, and output to file
+// DESCRIPTION: Compute integrated diagnostic quantities, and post
+//              for reduction and output
 // ARGUMENTS  : t  : state time
 //              dt : time step
 //              u  : state variable
 //              uf : forcing
-//              fname: file name
 // RETURNS    : none.
 //**********************************************************************************
 template<typename EquationType>
-void GMConvDiag<EquationType>::do_L2(const Time &t, const Time &dt, const State &u, const State &uf, const GString fname)
+void GMConvDiag<EquationType>::do_L2(const Time &t, const Time &dt, const State &u, const State &uf)
 {
   assert(utmp_ != NULLPTR && utmp_->size() > 3
       && "tmp space not set, or is insufficient");
@@ -122,7 +182,7 @@ void GMConvDiag<EquationType>::do_L2(const Time &t, const Time &dt, const State
   GINT    nd, ndim = grid_->gtype() == GE_2DEMBEDDED ? 3 : GDIM;
   GFTYPE  absu, absw, eint, ke, mass;
   GTVector<GFTYPE> *d, *e;
-  GTVector<GFTYPE> lmax(3), gmax(3);
+  GTVector<GFTYPE> lmax(3);
   State   *ubase = &solver_->get_base_state();
   typename GMConv<EquationType>::Traits trsolver;
 
@@ -156,42 +216,11 @@ void GMConvDiag<EquationType>::do_L2(const Time &t, const Time &dt, const State
   lmax[2] = grid_->integrate(*utmp[2], *utmp[0], FALSE);
 
 
-  // Gather final sums:
-  GComm::Allreduce(lmax.data(), gmax.data(), 3, T2GCDatatype<GFTYPE>(), GC_OP_SUM, grid_->get_comm());
-  mass = gmax[0]; eint = gmax[1]/grid_->volume(); ke = gmax[2]/grid_->volume(); 
-
-  // Print data to file:
-  GBOOL         doheader=FALSE;
-  GSIZET        le, ne;
-  GFTYPE        dxmin, elmin, elmax, elavg;
-  std::ofstream ios;
-  GString       fullfile = sodir_ + "/" + fname;
-
-  if ( geoflow::file_empty(fullfile) ) {
-    le    = grid_->nelems();
-    dxmin = grid_->minnodedist();
-    elmin = grid_->minlength();
-    elmax = grid_->maxlength();
-    elavg = grid_->avglength();
-    GComm::Allreduce(&le, &ne, 1, T2GCDatatype<GSIZET>() , GC_OP_SUM, grid_->get_comm());
-    doheader = TRUE;
-  }
-
-  if ( myrank_ == 0 ) {
-    ios.open(fullfile,std::ios_base::app);
-    if ( doheader ) {
-      ios << "#nelems=" << ne << " dxmin=" << dxmin << " elmin=" << elmin << " elmax=" << elmax << " elavg=" << elavg << std::endl;
-      ios << "#time    dt      Mass       <e>         <d KE>     " << std::endl;
-    }
-
-    ios << t  
-        << "    " << dt
-        << scientific << setprecision(15) 
-        << "    " << mass  << "    "  << eint
-        << "    " << ke
-        << std::endl;
-    ios.close();
-  }
+  // Post for global sums; <e>, <d KE> are then
+  // divided by volume:
+  GTVector<GFTYPE> vdiv(3);
+  vdiv[0] = 1.0; vdiv[1] = grid_->volume(); vdiv[2] = grid_->volume();
+  GDiagAggregator<Ftype>::instance().post(isL2_, GC_OP_SUM, t, dt, lmax, &vdiv);
  
 } // end of method do_L2
 
@@ -199,16 +228,16 @@ void GMConvDiag<EquationType>::do_L2(const Time &t, const Time &dt, const State
 //**********************************************************************************
 //**********************************************************************************
 // METHOD     : do_max
-// DESCRIPTION: Compute max quantities, and output to file
+// DESCRIPTION: Compute max quantities, and post for reduction
+//              and output
 // ARGUMENTS  : t    : state time
 //              dt   : time step
 //              u    : state variable
 //              uf   : forcing
-//              fname: file name
 // RETURNS    : none.
 //**********************************************************************************
 template<typename EquationType>
-void GMConvDiag<EquationType>::do_max(const Time &t, const Time &dt, const State &u, const State &uf, const GString fname)
+void GMConvDiag<EquationType>::do_max(const Time &t, const Time &dt, const State &u, const State &uf)
 {
   assert(utmp_ != NULLPTR && utmp_->size() > 3
       && "tmp space not set, or is insufficient");
@@ -218,7 +247,7 @@ void GMConvDiag<EquationType>::do_max(const Time &t, const Time &dt, const State
   GINT    nd, ndim = grid_->gtype() == GE_2DEMBEDDED ? 3 : GDIM;
   GFTYPE absu, absw, eint, ke, mass;
   GTVector<GFTYPE> *d, *e;
-  GTVector<GFTYPE> lmax(3), gmax(3);
+  GTVector<GFTYPE> lmax(3);
   State   *ubase = &solver_->get_base_state();
   typename GMConv<EquationType>::Traits trsolver;
 
@@ -252,42 +281,8 @@ void GMConvDiag<EquationType>::do_max(const Time &t, const Time &dt, const State
   lmax[2] = utmp[2]->amax();
 
 
-  // Gather final extrema:
-  GComm::Allreduce(lmax.data(), gmax.data(), 3, T2GCDatatype<GFTYPE>(), GC_OP_MAX, grid_->get_comm());
-  mass = gmax[0]; eint = gmax[1]; ke = gmax[2]; 
-
-
-  // Print data to file:
-  GBOOL         doheader=FALSE;
-  GSIZET        le, ne;
-  GFTYPE        dxmin, elmin, elmax, elavg;
-  std::ofstream ios;
-  GString       fullfile = sodir_ + "/" + fname;
-
-  if ( geoflow::file_empty(fullfile) ) {
-    le    = grid_->nelems();
-    dxmin = grid_->minnodedist();
-    elmin = grid_->minlength();
-    elmax = grid_->maxlength();
-    elavg = grid_->avglength();
-    GComm::Allreduce(&le, &ne, 1, T2GCDatatype<GSIZET>() , GC_OP_SUM, grid_->get_comm());
-    doheader = TRUE;
-  }
-  if ( myrank_ == 0 ) {
-    ios.open(fullfile,std::ios_base::app);
-    if ( doheader ) {
-      ios << "#nelems=" << ne << " dxmin=" << dxmin << " elmin=" << elmin << " elmax=" << elmax << " elavg=" << elavg << std::endl;
-      ios << "#time    dt      den_tot        e           d KE      " << std::endl;
-    }
-
-    ios << t  
-        << "    " << dt
-        << scientific << setprecision(15) 
-        << "    " << mass  << "    "  << eint
-        << "    " << ke
-        << std::endl;
-    ios.close();
-  }
+  // Post for global extrema:
+  GDiagAggregator<Ftype>::instance().post(ismax_, GC_OP_MAX, t, dt, lmax);
  
 } // end of method do_max
 
@@ -58,6 +58,7 @@ public:
 
 private:
         Grid                         *grid_;   // grid set on construction
+        State                         grad_;   // gradient components, pointers into utmp
 
 
 };
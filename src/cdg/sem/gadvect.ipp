@@ -47,7 +47,9 @@ GAdvect<TypePack>::~GAdvect()
 //                for GE_2DEMBEDDED elements.
 // ARGS   : p   : input p field
 //          u   : input vector field
-//          utmp: tmp arrays, sie >= 2
+//          utmp: tmp arrays, sie >= 2. If size > no. velocity 
+//                components, all components of Grad p are computed
+//                in one pass (see GGrid::grad)
 //          po  : output (result) vector
 //          ivec: if d is a vector component, specifies which component. 
 //                Default is -1 (meaning, a scalar).
@@ -69,6 +71,33 @@ void GAdvect<TypePack>::apply(StateComp &p, const State &u, State &utmp, StateCo
     return;
   }
 
+  if ( utmp.size() > nxy && u.size() == nxy ) {
+    // Compute all components of Grad p at once:
+    grad_.resize(nxy);
+    for ( auto j=0; j<nxy; j++ ) grad_[j] = utmp[j+1];
+    grid_->grad(p, TRUE, *utmp[0], grad_);
+#if defined(GEOFLOW_USE_NEUMANN_HACK)
+if ( ivec == -1 || ivec == 2 ) {
+GMTK::zero<Ftype>(*grad_[0],(*igb)[1][GBDY_0FLUX]);
+GMTK::zero<Ftype>(*grad_[0],(*igb)[3][GBDY_0FLUX]);
+}
+if ( ivec == -1 || ivec == 1 ) {
+for ( auto j=1; j<nxy; j++ ) {
+GMTK::zero<Ftype>(*grad_[j],(*igb)[0][GBDY_0FLUX]);
+GMTK::zero<Ftype>(*grad_[j],(*igb)[2][GBDY_0FLUX]);
+}
+}
+#endif
+    po = 0.0;
+    for ( auto j=0; j<nxy; j++ ) { 
+      if ( u[j] == NULLPTR ) continue;
+      grad_[j]->pointProd(*u[j]);
+      po += *grad_[j];
+    }
+    po.pointProd(*grid_->massop().data()); // multiply by mass
+    return;
+  }
+
   if ( u[0] != NULLPTR ) {
     grid_->deriv(p, 1, *utmp[0], po);
 #if defined(GEOFLOW_USE_NEUMANN_HACK)
@@ -21,6 +21,7 @@
 #include "gtvector.hpp"
 #include "gmass.hpp"
 #include "gelem_base.hpp"
+#include "gtpderiv.hpp"
 #include "pdeint/equation_base.hpp"
 
 
@@ -58,6 +59,10 @@ public:
         void              opVec_prod(StateComp &in, 
                                      State     &utmp,
                                      StateComp &out);                         // Operator-vector product 
+        void              opVec_prod(StateComp &in, 
+                                     State     &utmp,
+                                     StateComp &out,
+                                     typename Grid::GElemClass ec);           // Op-vec product on elem class 
         void              set_Lap_scalar(GTVector<Ftype> &p);                // Scalar multipliying Laplacian
         void              set_mass_scalar(GTVector<Ftype> &q);               // Scalar multiplying Mass
         void              init();                                             // must call after all 'sets'
@@ -77,6 +82,13 @@ private:
         void              embed_prod(StateComp  &in, 
                                      State      &utmp,
                                      StateComp  &out);
+        void              elems_prod(StateComp  &in, 
+                                     State      &utmp,
+                                     StateComp  &out,
+                                     GSIZET ebeg, GSIZET eend);
+        GBOOL             fused_prod(StateComp  &in, 
+                                     StateComp  &out,
+                                     GSIZET ebeg, GSIZET eend);
         void              compute_refderivs(GTVector<Ftype> &, 
                                             GTVector<GTVector<Ftype>*> &, GBOOL btrans=FALSE);
         void              compute_refderivsW(GTVector<Ftype> &, 
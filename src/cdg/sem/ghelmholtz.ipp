@@ -93,6 +93,134 @@ void GHelmholtz<Types>::opVec_prod(StateComp  &u,
 } // end of method opVec_prod
 
 
+//**********************************************************************************
+//**********************************************************************************
+// METHOD : opVec_prod (2)
+// DESC   : Compute application of this operator to input vector, only 
+//          for the elements in specified class (see GGrid::classify_elems).
+//          Since the operator is element-local, computing the 
+//          GEC_SHARED and GEC_INTERIOR classes in turn is equivalent to
+//          opVec_prod (1), but allows the exchange of shared nodes to
+//          proceed while interior elements are computed.
+// ARGS   : u   : input field (component)
+//          utmp: tmp space
+//          uo  : output (result) field; only nodes of elements in
+//                class are written
+//          ec  : element class
+//             
+// RETURNS:  none
+//**********************************************************************************
+template<typename Types>
+void GHelmholtz<Types>::opVec_prod(StateComp  &u, 
+                                   State      &utmp,
+                                   StateComp  &uo,
+                                   typename Grid::GElemClass ec)
+{
+  assert(bInitialized_ && "Operator not initialized");
+
+  GTVector<GSIZET> *eruns = &grid_->elem_runs(ec);
+
+  for ( auto j=0; j<eruns->size(); j+=2 ) {
+    elems_prod(u, utmp, uo, (*eruns)[j], (*eruns)[j+1]);
+  }
+
+} // end of method opVec_prod (2)
+
+
+//**********************************************************************************
+//**********************************************************************************
+// METHOD : elems_prod
+// DESC   : Compute application of this operator to input vector for
+//          the elements ebeg <= e < eend, for any element type. Carries
+//          out the same operations as reg_prod, def_prod, and embed_prod, 
+//          in the same order, but on the nodes of these elements only.
+//          NOTE: must have GDIM utmp vectors for GE_REGULAR, 2*GDIM 
+//                otherwise
+// ARGS   : u   : input vector
+//          utmp: tmp space
+//          uo  : output (result) vector
+//          ebeg: first element
+//          eend: one past last element
+//             
+// RETURNS:  none
+//**********************************************************************************
+template<typename Types>
+void GHelmholtz<Types>::elems_prod(StateComp  &u, 
+                                   State      &utmp,
+                                   StateComp  &uo,
+                                   GSIZET ebeg, GSIZET eend)
+{
+  GBOOL                       bregular = grid_->gtype() == GE_REGULAR;
+  GBOOL                       bpvar, bqvar;
+  GSIZET                      ibeg, iend;
+  Ftype                       t;
+  GTVector<GTVector<Ftype>*>  gdu(GDIM);
+  GTVector<Ftype>            *mass = grid_->massop().data();
+  typename Grid::GElemList   *gelems = &grid_->elems();
+
+  assert( utmp.size() >= (bregular ? GDIM : 2*GDIM)
+       && "Insufficient temp space specified");
+
+  if ( ebeg >= eend ) return;
+  if ( bregular && fused_prod(u, uo, ebeg, eend) ) return;
+
+  ibeg  = (*gelems)[ebeg]->igbeg(); iend = (*gelems)[eend-1]->igend();
+  bpvar = p_ != NULLPTR && p_->size() >= grid_->ndof();
+  bqvar = q_ != NULLPTR && q_->size() >= grid_->ndof();
+
+  // Compute reference derivatives, D^j u:
+  for ( auto j=0; j<GDIM; j++ ) gdu[j] = bregular ? utmp[j] : utmp[j+GDIM];
+  if ( bregular ) {
+    grid_->compute_grefderivs(u, etmp1_, FALSE, gdu , ebeg, eend);
+  }
+  else {
+    grid_->compute_grefderivs(u, etmp1_, FALSE, utmp, ebeg, eend);
+  }
+
+  // Compute Ti = p Gij D^j u; for regular elements, Gij is
+  // diagonal, and does not contain mass:
+  for ( auto j=0; j<GDIM; j++ ) {
+    for ( auto n=ibeg; n<=iend; n++ ) {
+      if ( bregular ) {
+        t = (*gdu[j])[n];
+        if ( buse_metric_ ) t *= G_(j,0)->size() > 1 ? (*G_(j,0))[n] : (*G_(j,0))[0];
+      }
+      else if ( buse_metric_ ) {
+        t = 0.0;
+        for ( auto i=0; i<GDIM; i++ ) {
+          t += (*utmp[i])[n] * (G_(i,j)->size() > 1 ? (*G_(i,j))[n] : (*G_(i,j))[0]);
+        }
+      }
+      else {
+        t = (*utmp[j])[n];
+      }
+      if ( bpvar    ) t *= (*p_)[n];
+      if ( bregular ) t *= (*mass)[n];
+      (*gdu[j])[n] = t;
+    }
+  }
+
+  // Now compute DT^j ( T^j ):
+  grid_->compute_grefdiv(gdu, etmp1_, TRUE, uo, ebeg, eend);
+
+  // If p_ is constant, multiply at the end:
+  if ( p_ != NULLPTR && !bpvar && (*p_)[0] != 1.0 ) {
+    for ( auto n=ibeg; n<=iend; n++ ) uo[n] *= (*p_)[0];
+  }
+
+  // Add q X mass operator if necessary:
+  if ( bcompute_helm_ ) {
+    for ( auto n=ibeg; n<=iend; n++ ) {
+      t = (*mass)[n] * u[n];
+      if      ( bqvar               ) t *= (*q_)[n];
+      else if ( (*q_)[0] != 1.0 ) t *= (*q_)[0];
+      uo[n] += t;
+    }
+  }
+
+} // end of method elems_prod
+
+
 //**********************************************************************************
 //**********************************************************************************
 // METHOD : def_prod
@@ -293,6 +421,66 @@ void GHelmholtz<Types>::embed_prod(StateComp &u,
 } // end of method embed_prod
 
 
+//**********************************************************************************
+//**********************************************************************************
+// METHOD : fused_prod
+// DESC   : Compute application of this operator to input vector for
+//          GE_REGULAR elements ebeg <= e < eend, with fused, order-
+//          specialized kernel, GTPDeriv::helm, that does gradient,
+//          metric/mass/p scaling, transpose gradient, and q M term
+//          on each element block in cache. Used only if grid uses 
+//          GTPDeriv kernels (GGrid::GDV_SPECP); no tmp space is required.
+// ARGS   : u   : input vector
+//          uo  : output (result) vector
+//          ebeg: first element
+//          eend: one past last element
+//             
+// RETURNS: TRUE if applied; else FALSE, and uo is not set
+//**********************************************************************************
+template<typename Types>
+GBOOL GHelmholtz<Types>::fused_prod(StateComp  &u, 
+                                    StateComp  &uo,
+                                    GSIZET ebeg, GSIZET eend)
+{
+  if ( grid_->gtype() != GE_REGULAR 
+    || grid_->get_derivtype() != Grid::GDV_SPECP ) return FALSE;
+
+  GBOOL                       bpvar, bqvar;
+  Ftype                       pfact=1.0, qfact=0.0;
+  GTVector<Ftype>            *p=NULLPTR, *q=NULLPTR;
+  GTVector<GTMatrix<Ftype>*>  D(GDIM), DT(GDIM);
+  GTVector<GTVector<Ftype>*>  G;
+  typename Grid::GElemList   *gelems = &grid_->elems();
+
+  if ( ebeg >= eend ) return TRUE;
+
+  bpvar = p_ != NULLPTR && p_->size() >= grid_->ndof();
+  bqvar = q_ != NULLPTR && q_->size() >= grid_->ndof();
+  if      ( bpvar         ) p     = p_;
+  else if ( p_ != NULLPTR ) pfact = (*p_)[0];
+  if ( bcompute_helm_ ) {
+    if ( bqvar ) q     = q_;
+    else         qfact = (*q_)[0];
+  }
+  if ( buse_metric_ ) {
+    G.resize(GDIM);
+    for ( auto k=0; k<GDIM; k++ ) G[k] = G_(k,0);
+  }
+
+  D [0] = (*gelems)[ebeg]->gbasis(0)->getDerivMatrix(FALSE);
+  DT[0] = (*gelems)[ebeg]->gbasis(0)->getDerivMatrix(TRUE);
+  for ( auto k=1; k<GDIM; k++ ) {
+    D [k] = (*gelems)[ebeg]->gbasis(k)->getDerivMatrix(TRUE);
+    DT[k] = (*gelems)[ebeg]->gbasis(k)->getDerivMatrix(FALSE);
+  }
+
+  return GTPDeriv::helm<Ftype>(D, DT, u, (*gelems)[ebeg]->size(0), eend-ebeg,
+                               (*gelems)[ebeg]->igbeg(), G, 
+                              *grid_->massop().data(), p, pfact, q, qfact, uo);
+
+} // end of method fused_prod
+
+
 //**********************************************************************************
 //**********************************************************************************
 // METHOD : reg_prod
@@ -319,6 +507,9 @@ void GHelmholtz<Types>::reg_prod(StateComp   &u,
   Mass                     *massop = &grid_->massop();                     
   GElem_base               *elem;
 
+  // Use fused, order-specialized kernel if possible:
+  if ( fused_prod(u, uo, 0, gelems->size()) ) return;
+
   // Compute:
   //   uo = ( p L + q M ) u
   // where
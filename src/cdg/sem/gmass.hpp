@@ -37,6 +37,10 @@ public:
         void              opVec_prod(GTVector<Ftype> &in, 
                                      GTVector<GTVector<Ftype>*> &utmp,
                                      GTVector<Ftype> &out);                       // Operator-vector product
+        void              opVec_prod(GTVector<Ftype> &in, 
+                                     GTVector<GTVector<Ftype>*> &utmp,
+                                     GTVector<Ftype> &out,
+                                     typename Grid::GElemClass ec);            // Op-vec product on elem class
         GTVector<Ftype>  *data() { return &mass_; }
 //      void              do_mass_lumping(GBOOL bml);                              // Set mass lumping flag
 
@@ -231,3 +231,34 @@ void GMass<Types>::opVec_prod(GTVector<Ftype> &input, GTVector<GTVector<Ftype>*>
   mass_.pointProd(input, output);
 
 } // end of method opVec_prod
+
+
+//**********************************************************************************
+//**********************************************************************************
+// METHOD : opVec_prod (2)
+// DESC   : Compute application of this operator to input vector, only
+//          for the elements in specified class (see GGrid::classify_elems).
+// ARGS   : input : input vector
+//          utmp  : required tmp space. Not used here.
+//          output: output (result) vector; only nodes of elements in
+//                  class are written
+//          ec    : element class
+//             
+// RETURNS:  none
+//**********************************************************************************
+template<typename Types>
+void GMass<Types>::opVec_prod(GTVector<Ftype> &input, GTVector<GTVector<Ftype>*> &utmp, 
+                       GTVector<Ftype> &output, typename Grid::GElemClass ec)
+{
+  assert(bInitialized_);
+
+  GSIZET                    ibeg, iend;
+  GTVector<GSIZET>         *eruns  = &grid_->elem_runs(ec);
+  typename Grid::GElemList *gelems = &grid_->elems();
+
+  for ( auto j=0; j<eruns->size(); j+=2 ) {
+    ibeg = (*gelems)[(*eruns)[j]]->igbeg(); iend = (*gelems)[(*eruns)[j+1]-1]->igend();
+    for ( auto n=ibeg; n<=iend; n++ ) output[n] = mass_[n] * input[n];
+  }
+
+} // end of method opVec_prod (2)
@@ -68,18 +68,27 @@ public:
                                               const StateComp& xb, StateComp& x);
                       GINT         solve_impl(const StateComp& b, StateComp& x) {assert(FALSE);
                                        return 1;}
-                      void         set_precond(Preconditioner& precond)
-                                   {precond_ = &precond;}
+                      void         set_precond(SolverBase& precond)
+                                   {precond_ = &precond;}      // e.g., GJacobiPrecond
                       StateComp&   get_residuals() { return residuals_; }  
                       GFTYPE       get_resid_max() { return residmax_; }
                       GFTYPE       get_resid_min() { return residmin_; }
                       GINT         get_iteration_count() { return iter_+1; }  
+                      GINT         get_nproject() { return nproj_; }   // no. projection vectors
+                      void         reset_projection() { nproj_ = 0; } // e.g., if operator changes
 
 
 private:
 // Private methods:
                        void        init();
                        GFTYPE      compute_norm(const StateComp& x, State& tmp);
+                       GINT        solve_pipelined(Operator& A, const StateComp& b, 
+                                                   StateComp& x);
+                       void        project(StateComp& r, StateComp& x);
+                       void        update_projection(Operator& A, StateComp& x, 
+                                                     State& tmp);
+                       void        opVec_dss(Operator& A, StateComp& u, State& tmp, 
+                                             StateComp& q);
 // Private data:
      GC_COMM           comm_;        // communicator
      GBOOL             bInit_;       // initialization flag
@@ -90,6 +99,17 @@ private:
      GFTYPE            residmax_;    // max residual
      GFTYPE            residmin_;    // min residual
      StateComp         residuals_;   // list of resituals for each iteration
+     GFTYPE            ngdof_;       // global no. dof (for GCG_NORM_EUC)
+     StateComp         imult_;       // inverse multiplicity, cached on init
+     GTVector<StateComp>
+                       pwork_;       // work vectors for pipelined CG
+     GINT              nproj_;       // no. vectors in projection basis
+     GTVector<StateComp>
+                       xproj_;       // A-orthonormal projection basis
+     GTVector<StateComp>
+                       Axproj_;      // DSS A xproj_
+     StateComp         xstart_;      // solution on entry
+     GTVector<GFTYPE>  lpdot_, gpdot_;// projection inner products
      LinSolverBase<TypePack>
                       *precond_;     // preconditioner
 
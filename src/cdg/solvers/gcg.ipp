@@ -35,6 +35,8 @@ irank_                        (0),
 residmax_                   (0.0),
 residmin_
   (std::numeric_limits<GFTYPE>::max()),
+ngdof_                      (0.0),
+nproj_                        (0),
 precond_            (NULLPTR)
 {
   irank_   = GComm::WorldRank(comm_);
@@ -90,7 +92,9 @@ GCG<Types>& GCG<Types>::operator=(const GCG<Types> &a)
 //************************************************************************************
 //************************************************************************************
 // METHOD : init
-// DESC   : Performs initialization of global GCG operator
+// DESC   : Performs initialization of global GCG operator. Data
+//          that depend only on the grid (e.g., inverse multiplicity)
+//          are computed here once, and reused by all solves.
 // ARGS   : none.
 // RETURNS: none.
 //************************************************************************************
@@ -99,7 +103,33 @@ void GCG<Types>::init()
 {
   if ( bInit_ ) return;
 
+  GFTYPE ndof = this->grid_->ndof();
+
   residuals_.resize(this->traits_.maxit);
+  if ( !this->grid_->elems_classified(*this->ggfx_) ) {
+    this->grid_->classify_elems(*this->ggfx_);
+  }
+
+  imult_.resize(this->grid_->ndof());
+  this->ggfx_->get_imult(imult_);
+
+  GComm::Allreduce(&ndof, &ngdof_, 1, T2GCDatatype<GFTYPE>() , GC_OP_SUM, comm_);
+
+  if ( this->traits_.pipelined ) {
+    pwork_.resize(5);
+    for ( auto j=0; j<pwork_.size(); j++ ) pwork_[j].resize(this->grid_->ndof());
+  }
+  if ( this->traits_.nproject > 0 ) {
+    xproj_ .resize(this->traits_.nproject);
+    Axproj_.resize(this->traits_.nproject);
+    for ( auto j=0; j<xproj_.size(); j++ ) {
+      xproj_ [j].resize(this->grid_->ndof());
+      Axproj_[j].resize(this->grid_->ndof());
+    }
+    xstart_.resize(this->grid_->ndof());
+    lpdot_ .resize(this->traits_.nproject+1);
+    gpdot_ .resize(this->traits_.nproject+1);
+  }
   bInit_ = TRUE;
 
 } // end of method init
@@ -154,7 +184,7 @@ GINT GCG<Types>::solve_impl(Operator& A, const StateComp& b, StateComp& x)
 
  *r -= (*w);                            // r = b - Ax, initial residual
 
-  this->ggfx_->doOp(*r, typename GGFX<decltype(r[0])>::Sum());// DSS r
+  this->ggfx_->doOp(*r, typename GGFX<Ftype>::Sum());// DSS r
 
 
   // Create effective initial residual
@@ -191,7 +221,7 @@ GINT GCG<Types>::solve_impl(Operator& A, const StateComp& b, StateComp& x)
 
     A.opVec_prod(*w, tmp, *q);          // q = A w
 
-    this->ggfx_->doOp(*q, typename GGFX<decltype(q[0])>::Sum()); // q <- DSS q
+    this->ggfx_->doOp(*q, typename GGFX<Ftype>::Sum()); // q <- DSS q
 
     if ( bbv_ ) q->pointProd(*mask);    // Mask(q)
 
@@ -228,7 +258,8 @@ GINT GCG<Types>::solve_impl(Operator& A, const StateComp& b, StateComp& x)
 // METHOD : solve_impl (1)
 // DESC   : Solve implementation to find homogeneous solution. 
 //          Taken from High Order Methods for Incompressible Fluid 
-//          Flow, Deville, Fischer, Mund, Cambridge 2002, p 197-198
+//          Flow, Deville, Fischer, Mund, Cambridge 2002, p 197-198.
+//          If traits.pipelined is set, solve_pipelined is used instead.
 //           
 // ARGS   : A    : linear operator to invert
 //          b    : right-hand side vector
@@ -245,13 +276,13 @@ GINT GCG<Types>::solve_impl(Operator& A, const StateComp& b, StateComp& x)
   StateComp *q, *r, *w, *z;
   State      tmp(this->tmp_->size()-4);
   StateComp *mask  = &this->grid_->get_mask();
-
-  StateComp imult_actual(this->grid_->ndof());
-  this->ggfx_->get_imult(imult_actual);
-  StateComp* imult = &imult_actual;
+  StateComp *imult;
 
   assert(this->tmp_->size() > 5);
   init();
+  if ( this->traits_.pipelined ) return solve_pipelined(A, b, x);
+
+  imult = &imult_;
 
   // Set some pointers:
   tmp.resize(this->tmp_->size()-4);
@@ -271,9 +302,12 @@ GINT GCG<Types>::solve_impl(Operator& A, const StateComp& b, StateComp& x)
 
  *r -= (*w);                            // r = b - Ax, initial residual
 
- this->ggfx_->doOp(*r, typename GGFX<decltype(r[0])>::Sum());   // DSS r
+ this->ggfx_->doOp(*r, typename GGFX<Ftype>::Sum());   // DSS r
 
   if ( bbv_ ) r->pointProd(*mask);      // Mask DSS r
+  if ( this->traits_.nproject > 0 ) {   // project x onto prior solutions
+    project(*r, x);
+  }
   if ( precond_ != NULLPTR ) {          // solve P z = r for z
     iret = precond_->solve(*r, *z);  
     if ( iret >  0 ) iret = GCGERR_PRECOND; 
@@ -291,6 +325,9 @@ GINT GCG<Types>::solve_impl(Operator& A, const StateComp& b, StateComp& x)
   rtol = rnorm < 1.0 ? this->traits_.tol : this->traits_.tol * rnorm;
 
   iter_ = 0; rnorm = 10.0*rtol;
+  if ( this->traits_.nproject > 0 ) {   // projection may have converged
+    rnorm = compute_norm(*r, tmp);
+  }
 
 //cout << "solve_impl: rnorm_0=" << rnorm << " traits.tol=" << this->traits_.tol <<  " rtol=" << rtol << endl;
 
@@ -298,9 +335,7 @@ GINT GCG<Types>::solve_impl(Operator& A, const StateComp& b, StateComp& x)
        && iter_ < this->traits_.maxit 
        && rnorm > rtol ) {
 
-    A.opVec_prod(*w, tmp, *q);          // q = A w
-
-    this->ggfx_->doOp(*q, typename GGFX<decltype(q[0])>::Sum()); // q <- DSS q
+    opVec_dss(A, *w, tmp, *q);          // q = DSS A w
 
     if ( bbv_ ) q->pointProd(*mask);    // Mask(q)
 
@@ -334,6 +369,10 @@ GINT GCG<Types>::solve_impl(Operator& A, const StateComp& b, StateComp& x)
 
   } // end, CG loop
 
+  if ( this->traits_.nproject > 0 && iret == GCGERR_NONE ) {
+    update_projection(A, x, tmp);
+  }
+
   if ( bbv_ ) x.pointProd(*mask);
 
   if ( iret == GCGERR_NONE 
@@ -382,6 +421,309 @@ GINT GCG<Types>::solve_impl(Operator& A, const StateComp& b, const StateComp& xb
 } // end of method solve_impl (2)
 
 
+//************************************************************************************
+//************************************************************************************
+// METHOD : solve_pipelined
+// DESC   : Pipelined (preconditioned) CG, after Ghysels & Vanroose, 
+//          Parallel Computing 40 (2014) 224-238, Alg. 4. All inner 
+//          products, and the residual norm, of an iteration are 
+//          formed in one pass, and reduced by a single non-blocking 
+//          allreduce, which proceeds while the preconditioner and 
+//          the operator (with its DSS exchange) are applied. The 
+//          price is 5 extra vectors, and an extra operator 
+//          application on the final iteration. Residuals are
+//          recorded as in solve_impl (1).
+// ARGS   : A    : linear operator to invert
+//          b    : right-hand side vector
+//          x    : solution, returned
+// RETURNS: integer error code
+//************************************************************************************
+template<typename Types>
+GINT GCG<Types>::solve_pipelined(Operator& A, const StateComp& b, StateComp& x)
+{
+  GINT         iret=GCGERR_NONE, nreq;
+  GLLONG       n;
+  GFTYPE       alpha, alpham, beta, gamma, gammam, delta, rnorm;
+  GFTYPE       rtol = this->traits_.tol;
+  GFTYPE       lsum[3], gsum[3], lmax, gmax;
+  GCReqHandle  hreq[2];
+  typename LinSolverBase<Types>::GNormType
+               ntype = this->traits_.normtype;
+  StateComp   *m, *nv, *p, *q, *r, *s, *u, *w, *z;
+  State        tmp(this->tmp_->size()-4);
+  StateComp   *mask  = &this->grid_->get_mask();
+  StateComp   *wnorm = this->grid_->massop().data();
+
+  assert(ntype != LinSolverBase<Types>::GCG_NORM_NONE && "Invalid norm type");
+
+  // Set some pointers:
+  nv = (*this->tmp_)[0];
+  r  = (*this->tmp_)[1];
+  w  = (*this->tmp_)[2];
+  m  = (*this->tmp_)[3];
+  for ( auto j=0; j<this->tmp_->size()-4; j++ ) {
+    tmp[j] = (*this->tmp_)[j+4];
+  }
+  u  = &pwork_[0];
+  z  = &pwork_[1];
+  q  = &pwork_[2];
+  s  = &pwork_[3];
+  p  = &pwork_[4];
+  residuals_ = 0.0;
+  n = x.size();
+
+  // Initial residual, r = DSS(b - Ax), u = P^-1 r, and w = DSS A u:
+ *r = b;
+  A.opVec_prod(x, tmp, *w);             
+ *r -= (*w);                           
+  this->ggfx_->doOp(*r, typename GGFX<Ftype>::Sum());
+  if ( bbv_ ) r->pointProd(*mask);      
+  if ( this->traits_.nproject > 0 ) project(*r, x);
+  if ( precond_ != NULLPTR ) {         
+    if ( precond_->solve(*r, *u) > 0 ) return GCGERR_PRECOND;
+  }
+  else {
+    *u = *r;                           
+  }
+  opVec_dss(A, *u, tmp, *w);
+  if ( bbv_ ) w->pointProd(*mask);
+
+  // Create effective tolerance:
+  rnorm = compute_norm(b, tmp);
+  rtol = rnorm < 1.0 ? this->traits_.tol : this->traits_.tol * rnorm;
+
+  gammam = alpham = 1.0;
+  iter_ = 0;
+  while ( TRUE ) {
+
+    // Local parts of gamma = r^T imult u, delta = w^T imult u, 
+    // and norm of r:
+    lsum[0] = lsum[1] = lsum[2] = 0.0; lmax = 0.0;
+    if ( ntype == LinSolverBase<Types>::GCG_NORM_INF ) {
+      GEXEC_PARALLEL_FOR_REDUCE(n, (+:lsum[:2]) reduction(max:lmax))
+      for ( GLLONG j=0; j<n; j++ ) {
+        lsum[0] += (*r)[j]*(*u)[j]*imult_[j];
+        lsum[1] += (*w)[j]*(*u)[j]*imult_[j];
+        lmax     = MAX(lmax, fabs((*r)[j]));
+      }
+    }
+    else if ( ntype == LinSolverBase<Types>::GCG_NORM_L1 ) {
+      GEXEC_PARALLEL_FOR_REDUCE(n, (+:lsum[:3]))
+      for ( GLLONG j=0; j<n; j++ ) {
+        lsum[0] += (*r)[j]*(*u)[j]*imult_[j];
+        lsum[1] += (*w)[j]*(*u)[j]*imult_[j];
+        lsum[2] += (*wnorm)[j]*fabs((*r)[j]);
+      }
+    }
+    else {                              // GCG_NORM_EUC, GCG_NORM_L2
+      GEXEC_PARALLEL_FOR_REDUCE(n, (+:lsum[:3]))
+      for ( GLLONG j=0; j<n; j++ ) {
+        lsum[0] += (*r)[j]*(*u)[j]*imult_[j];
+        lsum[1] += (*w)[j]*(*u)[j]*imult_[j];
+        lsum[2] += (ntype == LinSolverBase<Types>::GCG_NORM_EUC ? 1.0 : (*wnorm)[j])
+                 * (*r)[j]*(*r)[j];
+      }
+    }
+
+    // Post reduction (a max is posted alongside, if required), 
+    // and overlap with m = P^-1 w, n = DSS A m:
+    nreq = 1;
+    GComm::IAllreduce(lsum, gsum, 3, T2GCDatatype<GFTYPE>(), GC_OP_SUM, hreq, comm_);
+    if ( ntype == LinSolverBase<Types>::GCG_NORM_INF ) {
+      GComm::IAllreduce(&lmax, &gmax, 1, T2GCDatatype<GFTYPE>(), GC_OP_MAX, hreq+1, comm_);
+      nreq++;
+    }
+
+    if ( precond_ != NULLPTR ) {
+      if ( precond_->solve(*w, *m) > 0 ) iret = GCGERR_PRECOND;
+    }
+    else {
+      *m = *w;
+    }
+    if ( iret == GCGERR_NONE ) {
+      opVec_dss(A, *m, tmp, *nv);
+      if ( bbv_ ) nv->pointProd(*mask);
+    }
+
+    GComm::Wait(hreq, nreq);
+    if ( iret != GCGERR_NONE ) break;
+
+    switch ( ntype ) {
+      case LinSolverBase<Types>::GCG_NORM_INF:
+        rnorm = gmax; break;
+      case LinSolverBase<Types>::GCG_NORM_EUC:
+        rnorm = sqrt(gsum[2]/ngdof_); break;
+      case LinSolverBase<Types>::GCG_NORM_L2:
+        rnorm = sqrt(gsum[2]*this->grid_->ivolume()); break;
+      default:
+        rnorm = gsum[2]*this->grid_->ivolume(); break;
+    }
+    if ( iter_ > 0 ) {                  // norm of r after last update
+      residuals_[iter_-1] = rnorm;
+      residmax_ = MAX(rnorm,residmax_);
+      residmin_ = MIN(rnorm,residmin_);
+    }
+    if ( rnorm <= rtol || iter_ >= this->traits_.maxit ) break;
+
+    gamma = gsum[0];
+    delta = gsum[1];
+    if ( iter_ == 0 ) {
+      alpha = gamma / delta;
+     *z = *nv; *q = *m; *s = *w; *p = *u;
+    }
+    else {
+      beta  = gamma / gammam;
+      alpha = gamma / (delta - beta*gamma/alpham);
+      GMTK::saxpby<Ftype>(*z, beta, *nv, 1.0); // z = n + beta z
+      GMTK::saxpby<Ftype>(*q, beta, *m , 1.0); // q = m + beta q
+      GMTK::saxpby<Ftype>(*s, beta, *w , 1.0); // s = w + beta s
+      GMTK::saxpby<Ftype>(*p, beta, *u , 1.0); // p = u + beta p
+    }
+    GMTK::saxpby<Ftype>( x, 1.0, *p,  alpha);  // x = x + alpha p
+    GMTK::saxpby<Ftype>(*r, 1.0, *s, -alpha);  // r = r - alpha s
+    GMTK::saxpby<Ftype>(*u, 1.0, *q, -alpha);  // u = u - alpha q
+    GMTK::saxpby<Ftype>(*w, 1.0, *z, -alpha);  // w = w - alpha z
+
+    gammam = gamma;
+    alpham = alpha;
+    iter_++;
+
+  } // end, CG loop
+
+  if ( this->traits_.nproject > 0 && iret == GCGERR_NONE ) {
+    update_projection(A, x, tmp);
+  }
+
+  if ( bbv_ ) x.pointProd(*mask);
+
+  if ( iret == GCGERR_NONE 
+    && iter_ >= this->traits_.maxit 
+    && rnorm > this->traits_.tol ) iret = GCGERR_NOCONVERGE;
+
+  return iret;
+
+} // end of method solve_pipelined
+
+
+//************************************************************************************
+//************************************************************************************
+// METHOD : project
+// DESC   : Improve initial guess by projection onto the A-orthonormal 
+//          basis of prior solutions, {x_i}, after Fischer, Comput. 
+//          Methods Appl. Mech. Engrg. 163 (1998) 193-204:
+//              x <- x + sum_i (x_i^T r) x_i,
+//              r <- r - sum_i (x_i^T r) A x_i.
+//          All inner products are reduced together. The solution
+//          on entry is saved for update_projection.
+// ARGS   : r    : (DSS-ed, masked) initial residual; updated
+//          x    : initial guess; updated
+// RETURNS: none
+//************************************************************************************
+template<typename Types>
+void GCG<Types>::project(StateComp& r, StateComp& x)
+{
+  GEOFLOW_TRACE();
+  GFTYPE sum;
+
+  xstart_ = x;
+  if ( nproj_ == 0 ) return;
+
+  for ( auto i=0; i<nproj_; i++ ) {
+    sum = 0.0;
+    GEXEC_PARALLEL_FOR_REDUCE(r.size(), (+:sum))
+    for ( GLLONG j=0; j<r.size(); j++ ) sum += xproj_[i][j]*r[j]*imult_[j];
+    lpdot_[i] = sum;
+  }
+  GComm::Allreduce(lpdot_.data(), gpdot_.data(), nproj_, T2GCDatatype<GFTYPE>(), GC_OP_SUM, comm_);
+
+  for ( auto i=0; i<nproj_; i++ ) {
+    GMTK::saxpby<Ftype>(x, 1.0, xproj_ [i],  gpdot_[i]);
+    GMTK::saxpby<Ftype>(r, 1.0, Axproj_[i], -gpdot_[i]);
+  }
+
+} // end, project
+
+
+//************************************************************************************
+//************************************************************************************
+// METHOD : update_projection
+// DESC   : Add change in solution over the last solve to the projection 
+//          basis, A-orthonormalized against the basis by (classical) 
+//          Gram-Schmidt. If the basis is full, it is restarted from 
+//          the current solution. Costs one operator application.
+// ARGS   : A    : linear operator
+//          x    : solution 
+//          tmp  : tmp space for operator
+// RETURNS: none
+//************************************************************************************
+template<typename Types>
+void GCG<Types>::update_projection(Operator& A, StateComp& x, State& tmp)
+{
+  GEOFLOW_TRACE();
+  GBOOL      brestart = nproj_ >= this->traits_.nproject;
+  GFTYPE     sum, enorm;
+  StateComp *e, *Ae;
+  StateComp *mask  = &this->grid_->get_mask();
+
+  if ( brestart ) nproj_ = 0;
+  e  = &xproj_ [nproj_];
+  Ae = &Axproj_[nproj_];
+
+ *e  = x;
+  if ( !brestart ) *e -= xstart_;
+  if ( bbv_ ) e->pointProd(*mask);
+  opVec_dss(A, *e, tmp, *Ae);
+  if ( bbv_ ) Ae->pointProd(*mask);
+
+  // Find x_i^T A e, and e^T A e:
+  for ( auto i=0; i<=nproj_; i++ ) {
+    sum = 0.0;
+    GEXEC_PARALLEL_FOR_REDUCE(e->size(), (+:sum))
+    for ( GLLONG j=0; j<e->size(); j++ ) sum += xproj_[i][j]*(*Ae)[j]*imult_[j];
+    lpdot_[i] = sum;                    // xproj_[nproj_] is e
+  }
+  GComm::Allreduce(lpdot_.data(), gpdot_.data(), nproj_+1, T2GCDatatype<GFTYPE>(), GC_OP_SUM, comm_);
+  enorm = gpdot_[nproj_];
+
+  for ( auto i=0; i<nproj_; i++ ) {
+    GMTK::saxpby<Ftype>(*e , 1.0, xproj_ [i], -gpdot_[i]);
+    GMTK::saxpby<Ftype>(*Ae, 1.0, Axproj_[i], -gpdot_[i]);
+  }
+
+  // Normalize, unless e is (nearly) in span of basis:
+  sum = e->gdot(*Ae, imult_, comm_);
+  if ( sum <= 1.0e-12*enorm || sum <= 0.0 ) return;
+ *e  *= 1.0/sqrt(sum);
+ *Ae *= 1.0/sqrt(sum);
+  nproj_++;
+
+} // end, update_projection
+
+
+//************************************************************************************
+//************************************************************************************
+// METHOD : opVec_dss
+// DESC   : Compute operator-vector product, followed by direct stiffness
+//          summation, q = DSS A u. Shared elements are computed first, so
+//          that the exchange may proceed while interior elements are
+//          computed.
+// ARGS   : A    : linear operator
+//          u    : input vector
+//          tmp  : tmp space for operator
+//          q    : result
+// RETURNS: none
+//************************************************************************************
+template<typename Types>
+void GCG<Types>::opVec_dss(Operator& A, StateComp& u, State& tmp, StateComp& q)
+{
+  A.opVec_prod(u, tmp, q, Grid::GEC_SHARED);
+  this->ggfx_->doOp_begin(q, typename GGFX<Ftype>::Sum());
+  A.opVec_prod(u, tmp, q, Grid::GEC_INTERIOR);
+  this->ggfx_->doOp_end(q);
+
+} // end, opVec_dss
+
+
 //************************************************************************************
 //************************************************************************************
 // METHOD : compute_norm
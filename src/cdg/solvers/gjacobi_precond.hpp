@@ -0,0 +1,75 @@
+//==================================================================================
+// Module       : gjacobi_precond.hpp
+// Date         : 10/17/26
+// Description  : Encapsulates the methods and data associated with
+//                a Jacobi (diagonal) preconditioner. The preconditioner,
+//                    P^-1 = diag(DSS A)^-1,
+//                is formed from the assembled diagonal of the operator,
+//                A, which is found on initialization, and is applied
+//                to (DSS-ed) residuals, e.g., by GCG.
+// Copyright    : Copyright 2026. Colorado State University. All rights reserved.
+// Derived From : LinSolverBase.
+//==================================================================================
+
+#if !defined(_GJACOBI_PRECOND_HPP)
+#define _GJACOBI_PRECOND_HPP
+
+#include "gexec.h"
+#include "gtvector.hpp"
+#include "ggfx.hpp"
+#include "pdeint/lin_solver_base.hpp"
+
+using namespace geoflow::pdeint;
+using namespace std;
+
+
+template<typename TypePack>
+class GJacobiPrecond : public LinSolverBase<TypePack>
+{
+public:
+                      using Types          = TypePack;
+                      using SolverBase     = LinSolverBase<Types>;
+                      using Operator       = typename Types::Operator;
+                      using State          = typename Types::State;
+                      using StateComp      = typename Types::StateComp;
+                      using Grid           = typename Types::Grid;
+                      using Ftype          = typename Types::Ftype;
+                      using ConnectivityOp = typename Types::ConnectivityOp;
+                      using Traits         = typename SolverBase::Traits;
+
+                      static_assert(std::is_same<State,GTVector<GTVector<GFTYPE>*>>::value,
+                                    "State is of incorrect type");
+                      static_assert(std::is_same<StateComp,GTVector<GFTYPE>>::value,
+                                    "StateComp is of incorrect type");
+                      static_assert(std::is_same<ConnectivityOp,GGFX<Ftype>>::value,
+                                    "ConnectivityOp is of incorrect type");
+
+                      GJacobiPrecond() = delete;
+                      GJacobiPrecond(Traits& traits, Grid& grid, ConnectivityOp& ggfx,
+                                     State& tmppack, Operator& A);
+                     ~GJacobiPrecond();
+                      GJacobiPrecond(const GJacobiPrecond &a) = default;
+                      GJacobiPrecond  &operator=(const GJacobiPrecond &) = default;
+
+                      GINT         solve_impl(const StateComp& b, StateComp& x);
+                      GINT         solve_impl(Operator& A, const StateComp& b, StateComp& x)
+                                   {assert(FALSE); return 1;}
+                      GINT         solve_impl(Operator& A, const StateComp& b,
+                                              const StateComp& xb, StateComp& x)
+                                   {assert(FALSE); return 1;}
+                      StateComp&   get_diag() { return diag_; }   // assembled diagonal
+                      StateComp&   get_idiag() { return idiag_; } // its inverse
+
+private:
+// Private methods:
+                       void        init(Operator& A);
+
+// Private data:
+     StateComp         diag_;        // assembled diagonal of A
+     StateComp         idiag_;       // inverse of diag_
+
+};
+
+#include "gjacobi_precond.ipp"
+
+#endif
@@ -0,0 +1,116 @@
+//==================================================================================
+// Module       : gjacobi_precond.ipp
+// Date         : 10/17/26
+// Description  : Encapsulates the methods and data associated with
+//                a Jacobi (diagonal) preconditioner
+// Copyright    : Copyright 2026. Colorado State University. All rights reserved.
+// Derived From : LinSolverBase.
+//==================================================================================
+#include <cassert>
+
+using namespace std;
+
+//************************************************************************************
+//************************************************************************************
+// METHOD : Constructor
+// DESC   : Builds assembled operator diagonal
+// ARGS   : traits : solver traits; not used
+//          grid   : grid object
+//          ggfx   : connectivity operator
+//          tmppack: tmp space for operator applications
+//          A      : operator whose diagonal is required
+// RETURNS: GJacobiPrecond
+//************************************************************************************
+template<typename Types>
+GJacobiPrecond<Types>::GJacobiPrecond(Traits& traits, Grid& grid, ConnectivityOp& ggfx,
+                                      State& tmppack, Operator& A)
+: SolverBase(traits, grid, ggfx, tmppack)
+{
+  init(A);
+
+} // end of constructor method
+
+
+//************************************************************************************
+//************************************************************************************
+// METHOD : Destructor
+// DESC   :
+// ARGS   : none.
+// RETURNS: none.
+//************************************************************************************
+template<typename Types>
+GJacobiPrecond<Types>::~GJacobiPrecond()
+{
+}
+
+
+//************************************************************************************
+//************************************************************************************
+// METHOD : init
+// DESC   : Computes assembled diagonal of operator, and its inverse.
+//          Operators act element-by-element, so the diagonal is probed
+//          with unit vectors that are nonzero at the same local node
+//          of every element, requiring max(nnodes) operator
+//          applications. This is done once, on construction.
+// ARGS   : A : operator
+// RETURNS: none.
+//************************************************************************************
+template<typename Types>
+void GJacobiPrecond<Types>::init(Operator& A)
+{
+  GINT       nmax=0;
+  GLONG      ibeg;
+  StateComp  e(this->grid_->ndof()), Ae(this->grid_->ndof());
+  typename Grid::GElemList *gelems = &this->grid_->elems();
+
+  for ( auto i=0; i<gelems->size(); i++ ) nmax = MAX(nmax, (*gelems)[i]->nnodes());
+
+  diag_.resize(this->grid_->ndof());
+  idiag_.resize(this->grid_->ndof());
+  diag_ = 0.0;
+
+  e = 0.0;
+  for ( auto k=0; k<nmax; k++ ) {
+    for ( auto i=0; i<gelems->size(); i++ ) {
+      ibeg = (*gelems)[i]->igbeg();
+      if ( k < (*gelems)[i]->nnodes() ) e[ibeg+k] = 1.0;
+    }
+    A.opVec_prod(e, *this->tmp_, Ae);
+    for ( auto i=0; i<gelems->size(); i++ ) {
+      ibeg = (*gelems)[i]->igbeg();
+      if ( k < (*gelems)[i]->nnodes() ) {
+        diag_[ibeg+k] = Ae[ibeg+k];
+        e    [ibeg+k] = 0.0;
+      }
+    }
+  }
+
+  this->ggfx_->doOp(diag_, typename GGFX<Ftype>::Sum()); // DSS diag
+
+  for ( auto j=0; j<diag_.size(); j++ ) {
+    idiag_[j] = diag_[j] != 0.0 ? 1.0/diag_[j] : 0.0;
+  }
+
+} // end of method init
+
+
+//************************************************************************************
+//************************************************************************************
+// METHOD : solve_impl
+// DESC   : Apply preconditioner, x = diag^-1 b
+// ARGS   : b    : (DSS-ed) input vector
+//          x    : result
+// RETURNS: integer error code; 0 on success
+//************************************************************************************
+template<typename Types>
+GINT GJacobiPrecond<Types>::solve_impl(const StateComp& b, StateComp& x)
+{
+  GEOFLOW_TRACE();
+
+  GEXEC_PARALLEL_FOR(x.size())
+  for ( GLLONG j=0; j<x.size(); j++ ) x[j] = idiag_[j]*b[j];
+
+  return 0;
+
+} // end of method solve_impl
+
@@ -0,0 +1,114 @@
+//==================================================================================
+// Module       : gpmg_precond.hpp
+// Date         : 10/17/26
+// Description  : Encapsulates the methods and data associated with
+//                a p-multigrid (pMG) preconditioner. One symmetric
+//                V-cycle is applied per call: damped Jacobi smoothing
+//                on each level, and transfer between levels by
+//                tensor-product GLL interpolation (as in GProjectionFilter),
+//                  e_N = (I_M^N X I_M^N) e_M,    r_M = DSS_M (I_M^N)^T r_N,
+//                where I_M^N interpolates from order M to order N.
+//                Levels are grids of decreasing (constant) order, with
+//                the same elements; the caller builds these, with their
+//                operators and connectivity, and registers each with
+//                add_level, finest to coarsest. Taken largely from Deville,
+//                Fischer & Mund "High-Order Methods for Incompressible
+//                Flow", Cambridge 2002, Sec. 4.7.
+// Copyright    : Copyright 2026. Colorado State University. All rights reserved.
+// Derived From : LinSolverBase.
+//==================================================================================
+
+#if !defined(_GPMG_PRECOND_HPP)
+#define _GPMG_PRECOND_HPP
+
+#include "gtvector.hpp"
+#include "gtmatrix.hpp"
+#include "gmtk.hpp"
+#include "gcomm.hpp"
+#include "ggfx.hpp"
+#include "gjacobi_precond.hpp"
+#include "pdeint/lin_solver_base.hpp"
+
+using namespace geoflow::pdeint;
+using namespace std;
+
+
+template<typename TypePack>
+class GPMGPrecond : public LinSolverBase<TypePack>
+{
+public:
+                      using Types          = TypePack;
+                      using SolverBase     = LinSolverBase<Types>;
+                      using Operator       = typename Types::Operator;
+                      using State          = typename Types::State;
+                      using StateComp      = typename Types::StateComp;
+                      using Grid           = typename Types::Grid;
+                      using Ftype          = typename Types::Ftype;
+                      using ConnectivityOp = typename Types::ConnectivityOp;
+                      using Traits         = typename SolverBase::Traits;
+
+                      static_assert(std::is_same<State,GTVector<GTVector<GFTYPE>*>>::value,
+                                    "State is of incorrect type");
+                      static_assert(std::is_same<StateComp,GTVector<GFTYPE>>::value,
+                                    "StateComp is of incorrect type");
+                      static_assert(std::is_same<ConnectivityOp,GGFX<Ftype>>::value,
+                                    "ConnectivityOp is of incorrect type");
+
+                      GPMGPrecond() = delete;
+                      GPMGPrecond(Traits& traits, Grid& grid, ConnectivityOp& ggfx,
+                                  State& tmppack, Operator& A);
+                     ~GPMGPrecond();
+                      GPMGPrecond(const GPMGPrecond &a) = delete;
+                      GPMGPrecond  &operator=(const GPMGPrecond &) = delete;
+
+                      GINT         solve_impl(const StateComp& b, StateComp& x);
+                      GINT         solve_impl(Operator& A, const StateComp& b, StateComp& x)
+                                   {assert(FALSE); return 1;}
+                      GINT         solve_impl(Operator& A, const StateComp& b,
+                                              const StateComp& xb, StateComp& x)
+                                   {assert(FALSE); return 1;}
+                      void         add_level(Grid& grid, ConnectivityOp& ggfx, Operator& A);
+                      void         set_smoother(GINT nsmooth, GINT ncoarse)
+                                   {nsmooth_ = nsmooth; ncoarse_ = ncoarse;}
+                      GINT         nlevels() { return levels_.size(); }
+
+private:
+                      struct Level {
+                        Grid            *grid;  // level grid
+                        ConnectivityOp  *ggfx;  // level connectivity
+                        Operator        *A;     // level operator
+                        GJacobiPrecond<Types>
+                                        *jac;   // level diagonal
+                        Ftype            omega; // Jacobi damping factor
+                        StateComp        imult; // inverse multiplicity
+                        StateComp        r, x, w;// RHS, solution, work
+                        GTVector<StateComp>
+                                         wtmp;  // operator tmp storage
+                        State            tmp;   // operator tmp
+                        GTVector<GTMatrix<Ftype>>
+                                         P, PT; // interp. from next coarser
+                                                // level, and transposes
+                      };
+
+// Private methods:
+                       void        init();
+                       void        init_transfer(Level& fine, Level& coarse);
+                       Ftype       estimate_lmax(Level& lev);
+                       void        vcycle(GINT l);
+                       void        smooth(Level& lev, GINT nsweep, GBOOL bzero);
+                       void        residual(Level& lev);
+                       void        tensor_apply(GTVector<GTMatrix<Ftype>>& D,
+                                                GTVector<GINT>& nin, Ftype *u, Ftype *y);
+
+// Private data:
+     GBOOL             bInit_;       // initialization flag
+     GINT              nsmooth_;     // no. pre-/post-smoothing sweeps
+     GINT              ncoarse_;     // no. smoothing sweeps on coarsest level
+     GTVector<Level*>  levels_;      // levels, finest first
+     GTVector<Ftype>   w1_, w2_;     // tensor product work space
+
+};
+
+#include "gpmg_precond.ipp"
+
+#endif
@@ -0,0 +1,393 @@
+//==================================================================================
+// Module       : gpmg_precond.ipp
+// Date         : 10/17/26
+// Description  : Encapsulates the methods and data associated with
+//                a p-multigrid (pMG) preconditioner
+// Copyright    : Copyright 2026. Colorado State University. All rights reserved.
+// Derived From : LinSolverBase.
+//==================================================================================
+#include <cmath>
+#include <cassert>
+
+using namespace std;
+
+//************************************************************************************
+//************************************************************************************
+// METHOD : Constructor
+// DESC   : Registers finest level
+// ARGS   : traits : solver traits; not used
+//          grid   : finest grid
+//          ggfx   : connectivity operator on finest grid
+//          tmppack: tmp space for operator applications on finest
+//                   grid. Must not share vectors with the calling
+//                   solver's work space.
+//          A      : operator on finest grid
+// RETURNS: GPMGPrecond
+//************************************************************************************
+template<typename Types>
+GPMGPrecond<Types>::GPMGPrecond(Traits& traits, Grid& grid, ConnectivityOp& ggfx,
+                                State& tmppack, Operator& A)
+: SolverBase(traits, grid, ggfx, tmppack),
+bInit_                    (FALSE),
+nsmooth_                      (2),
+ncoarse_                     (16)
+{
+  Level *lev = new Level;
+
+  lev->grid = &grid;
+  lev->ggfx = &ggfx;
+  lev->A    = &A;
+  lev->jac  = NULLPTR;
+  lev->tmp  = tmppack;
+  levels_.push_back(lev);
+
+} // end of constructor method
+
+
+//************************************************************************************
+//************************************************************************************
+// METHOD : Destructor
+// DESC   :
+// ARGS   : none.
+// RETURNS: none.
+//************************************************************************************
+template<typename Types>
+GPMGPrecond<Types>::~GPMGPrecond()
+{
+  for ( auto l=0; l<levels_.size(); l++ ) {
+    if ( levels_[l]->jac != NULLPTR ) delete levels_[l]->jac;
+    delete levels_[l];
+  }
+}
+
+
+//************************************************************************************
+//************************************************************************************
+// METHOD : add_level
+// DESC   : Register next coarser level. Grid must have the same
+//          elements, in the same order, as the finer levels, with
+//          lower (constant) order.
+// ARGS   : grid   : level grid
+//          ggfx   : connectivity operator on grid
+//          A      : operator on grid
+// RETURNS: none.
+//************************************************************************************
+template<typename Types>
+void GPMGPrecond<Types>::add_level(Grid& grid, ConnectivityOp& ggfx, Operator& A)
+{
+  GString serr = "GPMGPrecond::add_level: ";
+  Level  *lev;
+
+  if ( grid.nelems() != levels_[0]->grid->nelems() ) {
+    cout << serr << "level element count differs from finest level" << endl;
+    exit(1);
+  }
+
+  lev = new Level;
+  lev->grid = &grid;
+  lev->ggfx = &ggfx;
+  lev->A    = &A;
+  lev->jac  = NULLPTR;
+  lev->wtmp.resize(this->tmp_->size());
+  lev->tmp .resize(this->tmp_->size());
+  for ( auto j=0; j<lev->wtmp.size(); j++ ) {
+    lev->wtmp[j].resize(grid.ndof());
+    lev->tmp [j] = &lev->wtmp[j];
+  }
+  levels_.push_back(lev);
+  bInit_ = FALSE;
+
+} // end of method add_level
+
+
+//************************************************************************************
+//************************************************************************************
+// METHOD : init
+// DESC   : Set up level data: inverse multiplicity, diagonal, smoother
+//          damping, and transfer operators
+// ARGS   : none.
+// RETURNS: none.
+//************************************************************************************
+template<typename Types>
+void GPMGPrecond<Types>::init()
+{
+  GString serr = "GPMGPrecond::init: ";
+  GSIZET  nmax=1;
+  Level  *lev;
+
+  for ( auto l=0; l<levels_.size(); l++ ) {
+    lev = levels_[l];
+    if ( !lev->grid->ispconst() ) {
+      cout << serr << "level order must be constant" << endl;
+      exit(1);
+    }
+    lev->imult.resize(lev->grid->ndof());
+    lev->r    .resize(lev->grid->ndof());
+    lev->x    .resize(lev->grid->ndof());
+    lev->w    .resize(lev->grid->ndof());
+    lev->ggfx->get_imult(lev->imult);
+    if ( lev->jac == NULLPTR ) {
+      lev->jac  = new GJacobiPrecond<Types>(this->traits_, *lev->grid, *lev->ggfx,
+                                            lev->tmp, *lev->A);
+    }
+    // Damping for Jacobi smoother, omega = 4/(3 lambda_max(D^-1 A)):
+    lev->omega = 4.0 / (3.0*estimate_lmax(*lev));
+    nmax = MAX(nmax, lev->grid->elems()[0]->nnodes());
+    if ( l > 0 ) init_transfer(*levels_[l-1], *lev);
+  }
+  w1_.resize(nmax);
+  w2_.resize(nmax);
+
+  bInit_ = TRUE;
+
+} // end of method init
+
+
+//************************************************************************************
+//************************************************************************************
+// METHOD : init_transfer
+// DESC   : Compute 1d interpolation matrices from coarse to fine
+//          level, I_M^N(i,j) = h_M,j(xi_N,i), and their transposes
+// ARGS   : fine   : fine level; transfer operators stored here
+//          coarse : next coarser level
+// RETURNS: none.
+//************************************************************************************
+template<typename Types>
+void GPMGPrecond<Types>::init_transfer(Level& fine, Level& coarse)
+{
+  GString          serr = "GPMGPrecond::init_transfer: ";
+  GTVector<Ftype>  xif;
+  GTVector<GNBasis<GCTYPE,Ftype>*> *bf, *bc;
+
+  bf = &fine  .grid->elems()[0]->gbasis();
+  bc = &coarse.grid->elems()[0]->gbasis();
+
+  fine.P .resize(GDIM);
+  fine.PT.resize(GDIM);
+  for ( auto j=0; j<GDIM; j++ ) {
+    if ( (*bc)[j]->getOrder() >= (*bf)[j]->getOrder() ) {
+      cout << serr << "levels must decrease in order" << endl;
+      exit(1);
+    }
+    (*bf)[j]->getXiNodes(xif);
+    fine.P [j].resize((*bf)[j]->getOrder()+1, (*bc)[j]->getOrder()+1);
+    fine.PT[j].resize((*bc)[j]->getOrder()+1, (*bf)[j]->getOrder()+1);
+    (*bc)[j]->evalBasis(xif, fine.P[j]);
+    fine.P[j].transpose(fine.PT[j]);
+  }
+
+} // end of method init_transfer
+
+
+//************************************************************************************
+//************************************************************************************
+// METHOD : estimate_lmax
+// DESC   : Estimate largest eigenvalue of D^-1 A on level by power
+//          iteration, with Rayleigh quotient,
+//              lambda = v^T A v / v^T D v
+// ARGS   : lev : level
+// RETURNS: estimate
+//************************************************************************************
+template<typename Types>
+typename Types::Ftype GPMGPrecond<Types>::estimate_lmax(Level& lev)
+{
+  GC_COMM    comm = lev.ggfx->getComm();
+  Ftype      lambda=1.0, vAv, vDv, vnorm, gnorm;
+  StateComp *mask = &lev.grid->get_mask();
+  StateComp *diag = &lev.jac->get_diag();
+
+  // Arbitrary (continuous) starting vector:
+  for ( auto j=0; j<lev.x.size(); j++ ) lev.x[j] = 1.0 + 0.5*sin(1.0*j);
+  lev.ggfx->doOp(lev.x, typename GGFX<Ftype>::Sum());
+  lev.x.pointProd(*mask);
+
+  for ( auto k=0; k<20; k++ ) {
+    lev.A->opVec_prod(lev.x, lev.tmp, lev.w);
+    lev.ggfx->doOp(lev.w, typename GGFX<Ftype>::Sum());
+    lev.w.pointProd(*mask);
+    vAv = lev.x.gdot(lev.w, lev.imult, comm);
+    lev.r = lev.x; lev.r.pointProd(*diag);
+    vDv = lev.x.gdot(lev.r, lev.imult, comm);
+    lambda = vAv / vDv;
+
+    // x = D^-1 A x, normalized:
+    lev.x = lev.w; lev.x.pointProd(lev.jac->get_idiag());
+    vnorm = lev.x.infnorm();
+    GComm::Allreduce(&vnorm, &gnorm, 1, T2GCDatatype<Ftype>(), GC_OP_MAX, comm);
+    lev.x *= 1.0/gnorm;
+  }
+
+  return lambda;
+
+} // end of method estimate_lmax
+
+
+//************************************************************************************
+//************************************************************************************
+// METHOD : solve_impl
+// DESC   : Apply preconditioner: one V-cycle, from zero initial
+//          guess, to the (DSS-ed) input vector
+// ARGS   : b    : (DSS-ed) input vector
+//          x    : result
+// RETURNS: integer error code; 0 on success
+//************************************************************************************
+template<typename Types>
+GINT GPMGPrecond<Types>::solve_impl(const StateComp& b, StateComp& x)
+{
+  GEOFLOW_TRACE();
+
+  if ( !bInit_ ) init();
+
+  levels_[0]->r = b;
+  vcycle(0);
+  x = levels_[0]->x;
+
+  return 0;
+
+} // end of method solve_impl
+
+
+//************************************************************************************
+//************************************************************************************
+// METHOD : vcycle
+// DESC   : Recursive V-cycle, for x on level l, given r on level l.
+//          Pre- and post-smoothing are the same, so that the cycle
+//          is symmetric, as required for use with CG.
+// ARGS   : l : level index
+// RETURNS: none.
+//************************************************************************************
+template<typename Types>
+void GPMGPrecond<Types>::vcycle(GINT l)
+{
+  GLONG  ibeg;
+  Level *fine = levels_[l], *coarse;
+  typename Grid::GElemList *ef, *ec;
+
+  if ( l == levels_.size()-1 ) {        // coarsest level
+    smooth(*fine, ncoarse_, TRUE);
+    return;
+  }
+
+  coarse = levels_[l+1];
+  ef     = &fine  ->grid->elems();
+  ec     = &coarse->grid->elems();
+
+  smooth(*fine, nsmooth_, TRUE);        // pre-smooth
+
+  // Restrict residual, r_c = DSS_c P^T imult w, where imult
+  // splits the assembled residual among its element copies:
+  residual(*fine);
+  fine->w.pointProd(fine->imult);
+  for ( auto e=0; e<ef->size(); e++ ) {
+    tensor_apply(fine->PT, (*ef)[e]->size(),
+                 fine->w.data()+(*ef)[e]->igbeg(), coarse->r.data()+(*ec)[e]->igbeg());
+  }
+  coarse->ggfx->doOp(coarse->r, typename GGFX<Ftype>::Sum());
+  coarse->r.pointProd(coarse->grid->get_mask());
+
+  vcycle(l+1);
+
+  // Prolongate and add coarse correction, x += P x_c:
+  for ( auto e=0; e<ec->size(); e++ ) {
+    tensor_apply(fine->P, (*ec)[e]->size(),
+                 coarse->x.data()+(*ec)[e]->igbeg(), fine->w.data()+(*ef)[e]->igbeg());
+  }
+  fine->w.pointProd(fine->grid->get_mask());
+  fine->x += fine->w;
+
+  smooth(*fine, nsmooth_, FALSE);       // post-smooth
+
+} // end of method vcycle
+
+
+//************************************************************************************
+//************************************************************************************
+// METHOD : smooth
+// DESC   : Damped Jacobi sweeps, x <- x + omega D^-1 (r - DSS A x)
+// ARGS   : lev   : level
+//          nsweep: no. sweeps
+//          bzero : if TRUE, start from x = 0
+// RETURNS: none.
+//************************************************************************************
+template<typename Types>
+void GPMGPrecond<Types>::smooth(Level& lev, GINT nsweep, GBOOL bzero)
+{
+  StateComp *idiag = &lev.jac->get_idiag();
+
+  for ( auto k=0; k<nsweep; k++ ) {
+    if ( k == 0 && bzero ) {
+      lev.w = lev.r;
+      lev.x = 0.0;
+    }
+    else {
+      residual(lev);
+    }
+    GEXEC_PARALLEL_FOR(lev.x.size())
+    for ( GLLONG j=0; j<lev.x.size(); j++ ) lev.x[j] += lev.omega*(*idiag)[j]*lev.w[j];
+  }
+
+} // end of method smooth
+
+
+//************************************************************************************
+//************************************************************************************
+// METHOD : residual
+// DESC   : Compute level residual, w = Mask(r - DSS A x)
+// ARGS   : lev : level
+// RETURNS: none.
+//************************************************************************************
+template<typename Types>
+void GPMGPrecond<Types>::residual(Level& lev)
+{
+  lev.A->opVec_prod(lev.x, lev.tmp, lev.w);
+  lev.ggfx->doOp(lev.w, typename GGFX<Ftype>::Sum());
+  GMTK::saxpby<Ftype>(lev.w, -1.0, lev.r, 1.0);
+  lev.w.pointProd(lev.grid->get_mask());
+
+} // end of method residual
+
+
+//************************************************************************************
+//************************************************************************************
+// METHOD : tensor_apply
+// DESC   : Apply tensor product of 1d operators to element data,
+//            y = D[GDIM-1] X ... X D[0] u,
+//          one direction at a time; D[j] need not be square
+// ARGS   : D   : 1d operators, one per direction
+//          nin : no. nodes of u in each direction
+//          u   : element input data
+//          y   : element result
+// RETURNS: none.
+//************************************************************************************
+template<typename Types>
+void GPMGPrecond<Types>::tensor_apply(GTVector<GTMatrix<Ftype>>& D,
+                                      GTVector<GINT>& nin, Ftype *u, Ftype *y)
+{
+  GSIZET  na, nb, nl, nm;
+  GSIZET  n[GDIM];
+  Ftype   s, *src=u, *dst;
+
+  for ( auto j=0; j<GDIM; j++ ) n[j] = nin[j];
+
+  for ( auto d=0; d<GDIM; d++ ) {
+    dst = d == GDIM-1 ? y : (d % 2 == 0 ? w1_.data() : w2_.data());
+    na  = nb = 1;
+    for ( auto j=0; j<d; j++ ) na *= n[j];
+    for ( auto j=d+1; j<GDIM; j++ ) nb *= n[j];
+    nl  = n[d];
+    nm  = D[d].size(1);
+    for ( GSIZET k=0; k<nb; k++ ) {
+      for ( GSIZET m=0; m<nm; m++ ) {
+        for ( GSIZET i=0; i<na; i++ ) {
+          s = 0.0;
+          for ( GSIZET l=0; l<nl; l++ ) s += D[d](m,l)*src[i+na*(l+nl*k)];
+          dst[i+na*(m+nm*k)] = s;
+        }
+      }
+    }
+    n[d] = nm;
+    src  = dst;
+  }
+
+} // end of method tensor_apply
+
@@ -54,6 +54,7 @@ EquationFactory<ET>::build(const tbox::PropertyTree& ptree, Grid& grid){
                 btraits.itorder   = stp_ptree.getValue<int>   ("time_deriv_order",4);
                 btraits.nstage    = stp_ptree.getValue<int>   ("nstage",4);
                 btraits.bSSP      = stp_ptree.getValue<int>   ("stab_preserving",false);
+                btraits.bLowStorage = stp_ptree.getValue<bool>("low_storage",false);
                 btraits.inorder   = stp_ptree.getValue<int>   ("extrap_order",2);
                 btraits.ssteptype = stp_ptree.getValue<std::string>
                                                              ("stepping_method","GSTEPPER_EXRK");
@@ -102,6 +103,7 @@ EquationFactory<ET>::build(const tbox::PropertyTree& ptree, Grid& grid){
                 ctraits.itorder     = stp_ptree.getValue<int>   ("time_deriv_order",4);
                 ctraits.nstage      = stp_ptree.getValue<int>   ("nstage",4);
                 ctraits.bSSP        = stp_ptree.getValue<int>   ("stab_preserving",false);
+                ctraits.bLowStorage = stp_ptree.getValue<bool>  ("low_storage",false);
                 ctraits.inorder     = stp_ptree.getValue<int>   ("extrap_order",2);
                 ctraits.courant     = stp_ptree.getValue<double>("courant",0.5);
                 ctraits.ssteptype   = stp_ptree.getValue<std::string>
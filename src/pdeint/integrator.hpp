@@ -68,6 +68,7 @@ public:
 		Time      dt_max      = std::numeric_limits<Time>::max();   
 		Time      dt          = static_cast<Time>(1.0e-2);
 		Time      time_end    = static_cast<Time>(1.0);
+		bool      observe_end = true; // observe at end of steps/time?
 	};
 
 	Integrator() = delete;
@@ -172,6 +173,12 @@ public:
          */
         size_t &get_numsteps() {return cycle_;}
 
+        /**
+         * Get most recent time step size.
+         *
+         */
+        Time get_dt_last() {return dt_last_;}
+
         /**
          * Get traits.
          *
@@ -180,6 +187,7 @@ public:
 
 protected:
         size_t       cycle_; // no. time cycles taken so far
+        Time         dt_last_; // most recent time step size
 	Traits       traits_;
         EqnBasePtr   eqn_ptr_;
 	MixerBasePtr mixer_ptr_;
@@ -16,7 +16,7 @@ Integrator<ET>::Integrator(const EqnBasePtr&   equation,
 		           const ObsBasePtr&   observer,
                            Grid&               grid,
 		           const Traits&       traits) :
-	cycle_(0), traits_(traits), eqn_ptr_(equation), 
+	cycle_(0), dt_last_(traits.dt), traits_(traits), eqn_ptr_(equation), 
         mixer_ptr_(mixer), obs_ptr_(observer), grid_(&grid) {
 	ASSERT(nullptr != eqn_ptr_);
 	ASSERT(nullptr != mixer_ptr_);
@@ -82,6 +82,7 @@ void Integrator<ET>::time( const Time& t0,
 		// Take Step
 		this->eqn_ptr_->step(t, u, uf, dt_eff);
 		t += dt_eff;
+                dt_last_ = dt_eff;
 
                 ++cycle_;
 
@@ -92,7 +93,7 @@ void Integrator<ET>::time( const Time& t0,
 	} while( t != t1 );
 
 	// Call observer on solution at final time:
-        for ( auto j = 0 ; j < this->obs_ptr_->size(); j++ ) 
+        for ( auto j = 0 ; traits_.observe_end && j < this->obs_ptr_->size(); j++ ) 
           (*this->obs_ptr_)[j]->observe(t,dt_eff,u,uf);
  
 
@@ -128,6 +129,7 @@ void Integrator<ET>::steps( const Time&  t0,
 		// Take Step
 		this->eqn_ptr_->step(t, u, uf, dt_eff);
 		t += dt_eff;
+                dt_last_ = dt_eff;
 #if 0
                 // Update due to boundary conditions:
                 this->bdy_update(t, u);
@@ -138,7 +140,7 @@ void Integrator<ET>::steps( const Time&  t0,
 
 	}
         // Call observer on solution at final time:
-        for ( auto j = 0 ; j < this->obs_ptr_->size(); j++ ) 
+        for ( auto j = 0 ; traits_.observe_end && j < this->obs_ptr_->size(); j++ ) 
 	  (*this->obs_ptr_)[j]->observe(t,dt_eff,u,uf);
 
 
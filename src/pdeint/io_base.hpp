@@ -10,6 +10,8 @@
 
 
 #include <memory>
+#include <string>
+#include <utility>
 #include <vector>
 
 namespace geoflow {
@@ -37,12 +39,15 @@ public:
           int          ivers   = 0;        // IO version tag
           bool         multivar= false;    // multiple vars in file (only of COLL types)?
           bool         prgrid  = false;    // flag to print grid
+          bool         async   = false;    // non-blocking, double-buffered writes (only of COLL types)?
           int          wtime   = 6;        // time-field width
           int          wtask   = 5;        // task-field width (only for POSIX types)
           int          wfile   = 2048;     // file name max
           int          dim     = GDIM;     // problem dimension
           std::string  idir         ;      // input directory
           std::string  odir         ;      // output directory
+          std::vector<std::pair<std::string,std::string>>
+                       hints        ;      // MPI-IO hints (key, value) (only of COLL types)
         };
 
       
@@ -93,6 +98,14 @@ public:
                           StateInfo&   info ){
                return this->read_state_info_impl(filename, info);
              }
+        /**
+	 * Complete all outstanding (asynchronous) writes. Must be 
+	 * called by all tasks before communication is terminated.
+	 *
+	 */
+	void flush() {
+               return this->flush_impl();
+             }
         /**
 	 * Get traits
 	 *
@@ -101,6 +114,17 @@ public:
                return traits_;
              }
 
+        /**
+	 * Set new grid on which to do IO, e.g., after 
+	 * repartitioning. Must be called by all tasks.
+	 *
+	 * @param[in] grid: new grid
+	 */
+	void set_grid( Grid& grid ) { 
+               grid_ = &grid;
+               return this->set_grid_impl(grid);
+             }
+
 protected:
         virtual void write_state_impl(std::string  filename,
                                       StateInfo&   info,
@@ -111,6 +135,8 @@ protected:
                                       bool         bstate) = 0;
         virtual void read_state_info_impl (std::string  filename,
                                            StateInfo&   info) = 0;
+        virtual void flush_impl() {}
+        virtual void set_grid_impl(Grid& grid) {}
         Grid   *grid_;
         Traits  traits_;
 };
@@ -39,6 +39,7 @@ IOFactory<ET>::build(const tbox::PropertyTree& ptree, Grid& grid, GC_COMM comm){
                 siotype           = ioobj_ptree.getValue <std::string>("io_type","collective");
                 gtraits.multivar  = ioobj_ptree.getValue <bool>       ("multivar",false);
                 gtraits.prgrid    = ioobj_ptree.getValue <bool>       ("prgrid",false);
+                gtraits.async     = ioobj_ptree.getValue <bool>       ("async",false);
                 gtraits.wtime     = ioobj_ptree.getValue <int>        ("wtime",6);
                 gtraits.wtask     = ioobj_ptree.getValue <int>        ("wtask",5);
                 gtraits.wfile     = ioobj_ptree.getValue <int>        ("wfile",2048);
@@ -46,6 +47,14 @@ IOFactory<ET>::build(const tbox::PropertyTree& ptree, Grid& grid, GC_COMM comm){
                 gtraits.idir      = ioobj_ptree.getValue <std::string>("idir",".");
                 gtraits.odir      = ioobj_ptree.getValue <std::string>("odir",".");
 
+                // MPI-IO hints, e.g., "striping_factor", "cb_nodes":
+                if ( ioobj_ptree.isPropertyTree("hints") ) {
+                  PropertyTree hints_ptree = ioobj_ptree.getPropertyTree("hints");
+                  for ( auto key : hints_ptree.getKeys() ) {
+                    gtraits.hints.push_back({key, hints_ptree.getValue<std::string>(key)});
+                  }
+                }
+
                 if      ( "collective" == siotype ) gtraits.io_type = GIO<ET>::GIO_COLL;
                 else if ( "POSIX"      == siotype ) gtraits.io_type = GIO<ET>::GIO_POSIX;
                 else assert(false); 
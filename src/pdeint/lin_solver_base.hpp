@@ -41,6 +41,10 @@ public:
           GNormType    normtype = GCG_NORM_INF;
                                             // norm type
           double       tol      = 1e-6;     // tolerance
+          bool         pipelined= false;    // pipelined CG (one fused, 
+                                            // non-blocking reduction per iter)?
+          int          nproject = 0;        // no. prior solutions kept to project
+                                            // initial guess (0: none)
         };
 
       
@@ -129,6 +129,18 @@ public:
 		utmp_ = &utmp;
         } 
 
+	/**
+	 * Set new equation and grid, e.g., after repartitioning
+	 *
+	 * @param[in] equation: new equation
+	 * @param[in] grid    : new grid
+	 */
+	void set_grid(EqnBasePtr& equation, Grid& grid){
+		eqn_ptr_ = equation;
+		grid_    = &grid;
+		set_grid_impl(equation, grid);
+        } 
+
         /**
          * Get traits.
          *
@@ -145,6 +157,7 @@ protected:
 	 */
 	virtual void observe_impl(const Time& t, const Time& dt, const State& u, const State& uf) = 0;
 	virtual void init_impl   (StateInfo &) = 0;
+	virtual void set_grid_impl(EqnBasePtr &, Grid &) {}
 
 };
 
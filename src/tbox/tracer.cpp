@@ -11,6 +11,10 @@
 
 #if defined(GEOFLOW_USE_TRACER)
 
+#if defined(_OPENMP)
+#include <omp.h>
+#endif
+
 #if defined(GEOFLOW_TRACER_USE_GPTL)
 #include "gptl.h"
 #include "gptlmpi.h"
@@ -28,9 +32,18 @@ namespace geoflow {
 namespace tbox {
 
 // Initialize the number of times the Tracer has been called
-std::size_t Tracer::m_count = 0;
+thread_local std::size_t Tracer::m_count = 0;
 
+// Tracers constructed by loop bodies inside an OpenMP parallel
+// region (see gexec.h) do nothing: the trace backends nest
+// timers per process, and would interleave across threads
 Tracer::Tracer(const std::string message) : name_(message) {
+#if defined(_OPENMP)
+    active_ = !omp_in_parallel();
+#else
+    active_ = true;
+#endif
+    if (!active_) return;
 #if defined(GEOFLOW_TRACER_USE_PIO)
     std::string full_text = std::string(indent(), ' ') + name_ + " -->";
     pio::pout << full_text << std::endl;
@@ -59,6 +72,7 @@ Tracer::Tracer(const std::string message) : name_(message) {
 }
 
 Tracer::~Tracer() {
+    if (!active_) return;
 #if defined(GEOFLOW_TRACER_USE_PIO)
     indent() = indent() - m_nest_indent;
     pio::pout << std::string(indent(), ' ') << "<--" << std::endl;
@@ -74,7 +88,7 @@ Tracer::~Tracer() {
 }
 
 std::size_t& Tracer::indent() {
-    static std::size_t m_current_indent{0};
+    static thread_local std::size_t m_current_indent{0};
     return m_current_indent;
 }
 
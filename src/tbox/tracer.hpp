@@ -74,15 +74,17 @@ class Tracer {
 	 * line indention.  This is determined by the current
 	 * level of nesting.  This is implemented as a static
 	 * function since static data members cannot be
-	 * initialized within header files.
+	 * initialized within header files.  The count is
+	 * kept per thread.
 	 */
     static std::size_t& indent();
 
    private:
     static constexpr std::size_t m_nest_indent = 3;
     static std::size_t m_current_indent;
-    static std::size_t m_count;
+    static thread_local std::size_t m_count;
     std::string name_;
+    bool active_;  // false if constructed inside a threaded region
 };
 
 class StackTracer {
@@ -0,0 +1,298 @@
+//==================================================================================
+// Module       : cdg_balance.cpp
+// Date         : 10/17/26
+// Description  : GeoFLOW test of dynamic load balancing (GLoadBalance).
+//                A synthetic cost that is 4x higher in one quadrant of
+//                a box grid must be measured as imbalanced; the
+//                rebalanced grid must hold all elements, with fewer
+//                on the task that had the expensive ones; migrated
+//                fields must equal the analytic fields on the new grid,
+//                be unchanged by DSS, and keep their integral; and the
+//                re-measured imbalance must drop. Time spent waiting in
+//                GGFX exchanges must not be counted as cost.
+// Copyright    : Copyright 2026. Colorado State University. All rights reserved
+// Derived From : none.
+//==================================================================================
+
+#include <unistd.h>
+
+#include <cstdio>
+#include <iostream>
+
+#include "gcomm.hpp"
+#include "ggfx.hpp"
+#include "ggrid_box.hpp"
+#include "ggrid_factory.hpp"
+#include "gllbasis.hpp"
+#include "gload_balance.hpp"
+#include "gmass.hpp"
+#include "gtypes.h"
+#include "pdeint/io_base.hpp"
+#include "pdeint/observer_base.hpp"
+#include "pdeint/observer_factory.hpp"
+#include "tbox/error_handler.hpp"
+#include "tbox/global_manager.hpp"
+#include "tbox/mpixx.hpp"
+#include "tbox/property_tree.hpp"
+
+using namespace geoflow::pdeint;
+using namespace geoflow::tbox;
+using namespace std;
+
+struct TypePack {
+    using State = GTVector<GTVector<GFTYPE> *>;
+    using StateComp = GTVector<GFTYPE>;
+    using StateInfo = GStateInfo;
+    using Grid = GGrid<TypePack>;
+    using GridBox = GGridBox<TypePack>;
+    using GridIcos = GGridIcos<TypePack>;
+    using Mass = GMass<TypePack>;
+    using Ftype = GFTYPE;
+    using Derivative = State;
+    using Time = Ftype;
+    using CompDesc = GTVector<GStateCompType>;
+    using Jacobian = State;
+    using Size = GSIZET;
+    using EqnBase = EquationBase<TypePack>;       // Equation Base type
+    using EqnBasePtr = std::shared_ptr<EqnBase>;  // Equation Base ptr
+    using IBdyVol = GTVector<GSIZET>;
+    using TBdyVol = GTVector<GBdyType>;
+    using Operator = GHelmholtz<TypePack>;
+    using GElemList = GTVector<GElem_base *>;
+    using Preconditioner = GHelmholtz<TypePack>;
+    using ConnectivityOp = GGFX<Ftype>;
+    using FilterBasePtr = std::shared_ptr<FilterBase<TypePack>>;
+    using FilterList = std::vector<FilterBasePtr>;
+};
+using Types = TypePack;                         // Define types used
+using IOBaseType = IOBase<Types>;               // IO Base type
+using IOBasePtr = std::shared_ptr<IOBaseType>;  // IO Base ptr
+using Grid = TypePack::Grid;
+using Ftype = TypePack::Ftype;
+using State = TypePack::State;
+using LoadBalance = GLoadBalance<Types>;
+
+GC_COMM comm_ = GC_COMM_WORLD;  // communicator
+
+GINT szMatCache_ = _G_MAT_CACHE_SIZE;
+GINT szVecCache_ = _G_VEC_CACHE_SIZE;
+
+void set_fields(Grid &grid, State &u);
+void do_work(Grid &grid, GGFX<Ftype> &ggfx, LoadBalance &lb);
+void init_ggfx(Grid &grid, GGFX<Ftype> &ggfx);
+
+int main(int argc, char **argv) {
+    GString serr = "main: ";
+    GINT errcode = 0, gerrcode, nprocs;
+    std::vector<GINT> pstd(GDIM);
+    GSIZET nel, gnel, gmin;
+    Ftype imb0, imb1, err, gerr, cost, gcost, int0, int1;
+    IOBasePtr pIO;
+    typename ObserverBase<Types>::Traits binobstraits;
+    LoadBalance::Traits lbtraits;
+
+    // Initialize comm:
+    GComm::InitComm(&argc, &argv);
+    mpixx::environment env(argc, argv);  // init GeoFLOW comm
+    mpixx::communicator world;
+    GlobalManager::initialize(argc, argv);
+    GlobalManager::startup();
+    nprocs = GComm::WorldSize(comm_);
+
+    // Build grid with SFC partitioner:
+    PropertyTree ptree;
+    ptree.load_file("cg_input.jsn");
+    ptree.setArray<GINT>("grid_box.num_elems", {8, 8, 1});
+    ptree.setValue<GString>("grid_box.partitioner", "sfc_hilbert");
+    pstd = ptree.getArray<GINT>("exp_order");
+
+    GTVector<GNBasis<GCTYPE, Ftype> *> gbasis(GDIM);
+    for (GSIZET k = 0; k < GDIM; k++) {
+        gbasis[k] = new GLLBasis<GCTYPE, Ftype>(pstd[k]);
+    }
+    ObserverFactory<Types>::get_traits(ptree, "gio_observer", binobstraits);
+    Grid *grid = GGridFactory<Types>::build(ptree, gbasis, pIO, binobstraits, comm_);
+    GGFX<Ftype> *ggfx = new GGFX<Ftype>();
+    init_ggfx(*grid, *ggfx);
+
+    // State with one unallocated component, which must be skipped:
+    State u(3), unew(3);
+    for (auto j = 0; j < 2; j++) u[j] = new GTVector<Ftype>(grid->ndof());
+    u[2] = NULLPTR;
+    set_fields(*grid, u);
+    GTVector<Ftype> tmp(grid->ndof());
+    int0 = grid->integrate(*u[0], tmp);
+
+    // Measure cost, and rebalance:
+    lbtraits.threshold = 1.1;
+    LoadBalance lb(lbtraits, comm_);
+    do_work(*grid, *ggfx, lb);
+    imb0 = lb.imbalance();
+    if (nprocs > 1 && !lb.need_rebalance()) {
+        cout << serr << " imbalance not detected: " << imb0 << endl;
+        errcode = 1;
+    }
+
+    Grid *gnew = lb.rebalance(ptree, *grid, gbasis, pIO, binobstraits);
+    if (lb.cost() != 0.0 || lb.nrebalanced() != 1) errcode = 2;
+
+    nel = gnew->nelems();
+    GComm::Allreduce(&nel, &gnel, 1, T2GCDatatype<GSIZET>(), GC_OP_SUM, comm_);
+    GComm::Allreduce(&nel, &gmin, 1, T2GCDatatype<GSIZET>(), GC_OP_MIN, comm_);
+    if (gnel != 64 || (nprocs > 1 && gmin >= gnel / nprocs)) {
+        cout << serr << " new grid: nelems=" << gnel << " min=" << gmin << endl;
+        errcode = 3;
+    }
+
+    // Migrate, and check against analytic fields on new grid:
+    for (auto j = 0; j < 2; j++) unew[j] = new GTVector<Ftype>(1);
+    unew[2] = NULLPTR;
+    LoadBalance::migrate(*grid, u, *gnew, unew);
+    set_fields(*gnew, u);
+    err = 0.0;
+    for (auto j = 0; j < 2; j++) {
+        for (auto i = 0; i < gnew->ndof(); i++) err = MAX(err, fabs((*unew[j])[i] - (*u[j])[i]));
+    }
+    GComm::Allreduce(&err, &gerr, 1, T2GCDatatype<Ftype>(), GC_OP_MAX, comm_);
+    if (gerr != 0.0) {
+        cout << serr << " migrated field error=" << gerr << endl;
+        errcode = 4;
+    }
+
+    delete ggfx;
+    ggfx = new GGFX<Ftype>();
+    init_ggfx(*gnew, *ggfx);
+    *u[0] = *unew[0];
+    ggfx->doOp(*u[0], GGFX<Ftype>::Smooth());
+    err = 0.0;
+    for (auto i = 0; i < gnew->ndof(); i++) err = MAX(err, fabs((*unew[0])[i] - (*u[0])[i]));
+    GComm::Allreduce(&err, &gerr, 1, T2GCDatatype<Ftype>(), GC_OP_MAX, comm_);
+    tmp.resize(gnew->ndof());
+    int1 = gnew->integrate(*unew[0], tmp);
+    if (gerr > 1.0e-12 || fabs(int1 - int0) > 1.0e-12 * fabs(int0)) {
+        cout << serr << " DSS error=" << gerr << " integral=" << int1 << "; was " << int0 << endl;
+        errcode = 5;
+    }
+
+    // Re-measure cost on new grid:
+    do_work(*gnew, *ggfx, lb);
+    imb1 = lb.imbalance();
+    if (GComm::WorldRank(comm_) == 0) {
+        cout << "main: imbalance before=" << imb0 << " after=" << imb1 << endl;
+    }
+    if (nprocs > 1 && (imb1 >= imb0 || imb1 > 1.5)) errcode = 6;
+
+    // Time waiting for late task in GGFX exchange is not cost:
+    if (nprocs > 1) {
+        lb.reset();
+        lb.start(ggfx);
+        if (GComm::WorldRank(comm_) == 0) usleep(200000);
+        ggfx->doOp(*u[0], GGFX<Ftype>::Smooth());
+        lb.stop();
+        cost = GComm::WorldRank(comm_) == 0 ? 0.0 : lb.cost();
+        GComm::Allreduce(&cost, &gcost, 1, T2GCDatatype<Ftype>(), GC_OP_MAX, comm_);
+        if (GComm::WorldRank(comm_) == 0) {
+            cout << "main: cost of waiting tasks=" << gcost << "; wait time=" << ggfx->wait_time() << endl;
+        }
+        if (gcost > 0.1) errcode = 7;
+    }
+
+    // Accumulate error codes:
+    GComm::Allreduce(&errcode, &gerrcode, 1, T2GCDatatype<GINT>(), GC_OP_MAX, comm_);
+
+    if (gerrcode != 0) {
+        cout << serr << " Error: code=" << errcode << endl;
+    } else {
+        cout << serr << " Success!" << endl;
+    }
+
+    delete ggfx;
+    delete gnew;
+    delete grid;
+    for (auto j = 0; j < 2; j++) {
+        delete u[j];
+        delete unew[j];
+    }
+    for (auto k = 0; k < gbasis.size(); k++) delete gbasis[k];
+
+    GComm::TermComm();
+
+    return (gerrcode);
+
+}  // end, main
+
+//**********************************************************************************
+//**********************************************************************************
+// METHOD: set_fields
+// DESC  : Set continuous analytic fields on grid nodes
+// ARGS  : grid: grid
+//         u   : fields; first 2 components are resized and set
+//**********************************************************************************
+void set_fields(Grid &grid, State &u) {
+    GTVector<GTVector<Ftype>> *xnodes = &grid.xNodes();
+
+    for (auto j = 0; j < 2; j++) u[j]->resize(grid.ndof());
+    for (auto i = 0; i < grid.ndof(); i++) {
+        (*u[0])[i] = (*xnodes)[0][i] + 2.0 * (*xnodes)[1][i] * (*xnodes)[1][i];
+        (*u[1])[i] = (*xnodes)[0][i] * (*xnodes)[1][i];
+    }
+
+}  // end, set_fields
+
+//**********************************************************************************
+//**********************************************************************************
+// METHOD: do_work
+// DESC  : Do synthetic work whose cost is 4x higher for elements in
+//         the lower-left quadrant, followed by a DSS, and measure it
+// ARGS  : grid: grid
+//         ggfx: GGFX operator on grid
+//         lb  : load balancer
+//**********************************************************************************
+void do_work(Grid &grid, GGFX<Ftype> &ggfx, LoadBalance &lb) {
+    GSIZET ib, nn, usec = 0;
+    Ftype xc, yc;
+    GTVector<GTVector<Ftype>> *xnodes = &grid.xNodes();
+    GTVector<Ftype> f(grid.ndof());
+
+    for (auto e = 0; e < grid.nelems(); e++) {
+        ib = grid.elems()[e]->igbeg();
+        nn = grid.elems()[e]->nnodes();
+        xc = (*xnodes)[0].sum(ib, ib + nn - 1) / nn;
+        yc = (*xnodes)[1].sum(ib, ib + nn - 1) / nn;
+        usec += xc < 0.5 && yc < 0.5 ? 4000 : 1000;
+    }
+
+    f = 1.0;
+    lb.reset();
+    lb.start(&ggfx);
+    usleep(usec);
+    ggfx.doOp(f, GGFX<Ftype>::Smooth());
+    lb.stop();
+
+}  // end, do_work
+
+//**********************************************************************************
+//**********************************************************************************
+// METHOD: init_ggfx
+// DESC  : Initialize GGFX operator from grid nodes
+// ARGS  : grid: grid
+//         ggfx: GGFX operator, initialized on exit
+//**********************************************************************************
+void init_ggfx(Grid &grid, GGFX<Ftype> &ggfx) {
+    const auto ndof = grid.ndof();
+    const auto nxyz = grid.xNodes().size();
+    ASSERT(nxyz <= GGFX<Ftype>::NDIM);
+    std::vector<std::array<Ftype, GGFX<Ftype>::NDIM>> xyz(ndof);
+    for (std::size_t i = 0; i < ndof; i++) {
+        for (std::size_t d = 0; d < nxyz; d++) {
+            xyz[i][d] = grid.xNodes()[d][i];
+        }
+        for (std::size_t d = nxyz; d < GGFX<Ftype>::NDIM; d++) {
+            xyz[i][d] = 0;
+        }
+    }
+
+    // Max duplicate points: 6 in 2d, 12 in 3d
+    ggfx.init(GDIM == 3 ? 12 : 6, 0.25 * grid.minnodedist(), xyz);
+
+}  // end method init_ggfx
@@ -6,13 +6,21 @@
 //                    Nabla^2 u = -f,
 //                In a 2D box, where f =  6xy(1-y) - 2x^3
 //                on 0 <= x,y <= 1, and u(x,y=0)=u(x,y=1)=0;
-//                u(x=0,y)=0; u(x=1,y) = y(1-y).
+//                u(x=0,y)=0; u(x=1,y) = y(1-y). The system is solved
+//                with both the standard and the pipelined CG, and with
+//                Jacobi and p-multigrid preconditioners, for which
+//                iteration counts and times to solution are reported.
+//                Last, a sequence of slowly varying systems is solved,
+//                with and without projection of the initial guess onto
+//                prior solutions, and the fused Helmholtz operator
+//                is checked against the unfused one.
 // Copyright    : Copyright 2020. Colorado State University. All rights reserved.
 // Derived From : none.
 //==================================================================================
 
 #include <unistd.h>
 
+#include <chrono>
 #include <cstdio>
 #include <iostream>
 
@@ -24,9 +32,11 @@
 #include "ghelmholtz.hpp"
 #include "gio.hpp"
 #include "gio_observer.hpp"
+#include "gjacobi_precond.hpp"
 #include "gllbasis.hpp"
 #include "gmass.hpp"
 #include "gmorton_keygen.hpp"
+#include "gpmg_precond.hpp"
 #include "gtypes.h"
 #include "pdeint/io_base.hpp"
 #include "pdeint/null_observer.hpp"
@@ -324,6 +334,193 @@ int main(int argc, char **argv) {
     }
     assert(iret == GCG<CGTypes>::GCGERR_NONE && "Solve failure");
 
+    // Solve again with pipelined CG; it must reach the same accuracy
+    // in about the same no. iterations:
+    {
+        EH_MESSAGE("main: Solve linear system with pipelined CG...");
+
+        GSIZET pniter;
+        Ftype perr;
+        GTVector<Ftype> up(grid_->ndof());
+
+        cgtraits.pipelined = TRUE;
+        GCG<CGTypes> pcg(cgtraits, *grid_, ggfx, utmp);
+
+        up = 0.0;  // initial guess
+        iret = pcg.solve(L, f, ub, up);
+        pniter = pcg.get_iteration_count();
+
+        *utmp[0] = up - ua;
+        utmp[0]->rpow(2);
+        perr = grid_->integrate(*utmp[0], *utmp[1]) * grid_->ivolume();
+
+        if (perr >= 1e-12 || iret != GCG<CGTypes>::GCGERR_NONE || pniter > niter + 2) {
+            cout << serr << " pipelined: err=" << perr << " niter=" << pniter
+                 << " (classic: " << niter << ") iret=" << iret << endl;
+            cout << serr << " pipelined: residuals=" << pcg.get_residuals() << endl;
+            errcode = 3;
+        }
+    }
+
+    // Benchmark preconditioners: each must reach the same accuracy,
+    // in no more iterations than unpreconditioned CG; pMG in at most
+    // half as many:
+    {
+        EH_MESSAGE("main: Solve linear system with preconditioned CG...");
+
+        GINT nlev = 0;
+        GSIZET pniter[3];
+        Ftype perr[3];
+        GDOUBLE ptime[3];
+        const char *sprecond[3] = {"none", "jacobi", "pmg"};
+        std::chrono::steady_clock::time_point tstart;
+        std::chrono::duration<double> tdiff;
+        GTVector<Ftype> up(grid_->ndof());
+        GTVector<GTVector<Ftype> *> ptmp(utmp.size());
+        GTVector<GTVector<GNBasis<GCTYPE, Ftype> *>> cbasis;
+        GTVector<Grid *> cgrid;
+        GTVector<GGFX<Ftype> *> cggfx;
+        GTVector<GHelmholtz<Types> *> cL;
+
+        for (auto j = 0; j < ptmp.size(); j++) ptmp[j] = new GTVector<Ftype>(grid_->ndof());
+
+        // Coarse pMG levels, halving order down to 1:
+        for (GINT p = pstd[0] / 2; p >= 1; p = p > 1 ? p / 2 : 0) nlev++;
+        cbasis.resize(nlev);
+        cgrid.resize(nlev);
+        cggfx.resize(nlev);
+        cL.resize(nlev);
+        for (auto l = 0, p = pstd[0] / 2; l < nlev; l++, p /= 2) {
+            cbasis[l].resize(GDIM);
+            for (auto k = 0; k < GDIM; k++) cbasis[l][k] = new GLLBasis<GCTYPE, Ftype>(p);
+            cgrid[l] = GGridFactory<Types>::build(ptree, cbasis[l], pIO, binobstraits, comm_);
+            cggfx[l] = new GGFX<Ftype>;
+            init_ggfx(ptree, *cgrid[l], *cggfx[l]);
+            cL[l] = new GHelmholtz<Types>(*cgrid[l]);
+        }
+
+        cgtraits.pipelined = FALSE;
+        GJacobiPrecond<CGTypes> jac(cgtraits, *grid_, ggfx, ptmp, L);
+        GPMGPrecond<CGTypes> pmg(cgtraits, *grid_, ggfx, ptmp, L);
+        for (auto l = 0; l < nlev; l++) pmg.add_level(*cgrid[l], *cggfx[l], *cL[l]);
+
+        for (auto i = 0; i < 3; i++) {
+            GCG<CGTypes> pcg(cgtraits, *grid_, ggfx, utmp);
+            if (i == 1) pcg.set_precond(jac);
+            if (i == 2) pcg.set_precond(pmg);
+
+            up = 0.0;  // initial guess
+            tstart = std::chrono::steady_clock::now();
+            iret = pcg.solve(L, f, ub, up);
+            tdiff = std::chrono::steady_clock::now() - tstart;
+            ptime[i] = tdiff.count();
+            pniter[i] = pcg.get_iteration_count();
+
+            *utmp[0] = up - ua;
+            utmp[0]->rpow(2);
+            perr[i] = grid_->integrate(*utmp[0], *utmp[1]) * grid_->ivolume();
+
+            if (myrank == 0) {
+                cout << serr << " precond=" << sprecond[i] << " niter=" << pniter[i]
+                     << " time=" << ptime[i] << "s err=" << perr[i] << endl;
+            }
+            if (perr[i] >= 1e-12 || iret != GCG<CGTypes>::GCGERR_NONE || pniter[i] > pniter[0]
+            || (i == 2 && 2 * pniter[i] > pniter[0])) {
+                cout << serr << " precond=" << sprecond[i] << ": err=" << perr[i]
+                     << " niter=" << pniter[i] << " (none: " << pniter[0] << ") iret=" << iret << endl;
+                errcode = 4;
+            }
+        }
+
+        for (auto l = 0; l < nlev; l++) {
+            delete cL[l];
+            delete cggfx[l];
+            delete cgrid[l];
+            for (auto k = 0; k < GDIM; k++) delete cbasis[l][k];
+        }
+        for (auto j = 0; j < ptmp.size(); j++) delete ptmp[j];
+    }
+
+    // Solve sequence of systems with slowly varying RHS, with
+    // projected initial guess. It must match the solutions found
+    // without projection, in at most half as many iterations:
+    {
+        EH_MESSAGE("main: Solve sequence with projected initial guess...");
+
+        GINT nsolve = 12;
+        GSIZET nit[2] = {0, 0};
+        Ftype diff, gdiff, unorm, gunorm;
+        GTVector<Ftype> fk(grid_->ndof()), up(grid_->ndof()), ur(grid_->ndof());
+
+        cgtraits.pipelined = FALSE;
+        GCG<CGTypes> rcg(cgtraits, *grid_, ggfx, utmp);  // reference
+        cgtraits.nproject = 6;                           // restarts at k=6
+        GCG<CGTypes> pcg(cgtraits, *grid_, ggfx, utmp);
+
+        for (auto k = 0; k < nsolve; k++) {
+            for (auto j = 0; j < grid_->ndof(); j++) {
+                fk[j] = f[j] * exp(0.2 * k * ((*xnodes)[0][j] - 0.5));
+            }
+            ur = 0.0;
+            iret = rcg.solve(L, fk, ub, ur);
+            nit[0] += rcg.get_iteration_count();
+            up = 0.0;
+            iret += pcg.solve(L, fk, ub, up);
+            nit[1] += pcg.get_iteration_count();
+
+            *utmp[0] = up - ur;
+            diff = utmp[0]->infnorm();
+            unorm = ur.infnorm();
+            GComm::Allreduce(&diff, &gdiff, 1, T2GCDatatype<Ftype>(), GC_OP_MAX, comm_);
+            GComm::Allreduce(&unorm, &gunorm, 1, T2GCDatatype<Ftype>(), GC_OP_MAX, comm_);
+            if (iret != GCG<CGTypes>::GCGERR_NONE || gdiff > 1.0e-5 * gunorm) {
+                cout << serr << " projection: solve " << k << ": diff=" << gdiff
+                     << " iret=" << iret << endl;
+                errcode = 5;
+            }
+        }
+        if (myrank == 0) {
+            cout << serr << " projection: niter=" << nit[1]
+                 << " (none: " << nit[0] << ") over " << nsolve << " solves" << endl;
+        }
+        if (2 * nit[1] > nit[0]) {
+            cout << serr << " projection: too many iterations" << endl;
+            errcode = 5;
+        }
+    }
+
+    // Fused, order-specialized operator (used on regular grids
+    // with GTPDeriv kernels) must match the unfused operator:
+    if (grid_->gtype() == GE_REGULAR && GTPDeriv::supported(grid_->elems()[0]->size(0))) {
+        EH_MESSAGE("main: Check fused operator...");
+
+        Ftype diff, gdiff, unorm, gunorm;
+        Grid::GDerivType dtype = grid_->get_derivtype();
+        GTVector<Ftype> uf(grid_->ndof()), ur(grid_->ndof());
+
+        for (auto j = 0; j < grid_->ndof(); j++) {
+            f[j] = sin(3.0 * (*xnodes)[0][j] + 1.0) * cos(2.0 * (*xnodes)[1][j]);
+        }
+        grid_->set_derivtype(Grid::GDV_CONSTP);
+        L.opVec_prod(f, utmp, ur);
+        grid_->set_derivtype(Grid::GDV_SPECP);
+        L.opVec_prod(f, utmp, uf);
+        grid_->set_derivtype(dtype);
+
+        *utmp[0] = uf - ur;
+        diff = utmp[0]->amax();
+        unorm = ur.amax();
+        GComm::Allreduce(&diff, &gdiff, 1, T2GCDatatype<Ftype>(), GC_OP_MAX, comm_);
+        GComm::Allreduce(&unorm, &gunorm, 1, T2GCDatatype<Ftype>(), GC_OP_MAX, comm_);
+        if (myrank == 0) {
+            cout << serr << " fused operator: rel. diff=" << gdiff / gunorm << endl;
+        }
+        if (gdiff > 1e-12 * gunorm) {
+            cout << serr << " fused operator: mismatch" << endl;
+            errcode = 6;
+        }
+    }
+
 prerror:
     // Accumulate error codes:
     GComm::Allreduce(&errcode, &gerrcode, 1, T2GCDatatype<GINT>(), GC_OP_MAX, comm_);
@@ -359,7 +556,7 @@ prerror:
 //**********************************************************************************
 //**********************************************************************************
 void init_ggfx(PropertyTree &ptree, Grid &grid, GGFX<Ftype> &ggfx) {
-    const auto ndof = grid_->ndof();
+    const auto ndof = grid.ndof();
     const auto nxyz = grid.xNodes().size();
     ASSERT(nxyz <= GGFX<Ftype>::NDIM);
     std::vector<std::array<Ftype, GGFX<Ftype>::NDIM>> xyz(ndof);
@@ -0,0 +1,73 @@
+//==================================================================================
+// Module       : cdg_gemm.cpp
+// Date         : 10/17/26
+// Description  : GeoFLOW test of CBLAS batched_gemm: small-GEMM kernels
+//                for each supported inner dimension, and per-element BLAS
+//                fallback for an unsupported one, against cblas_dgemm
+// Copyright    : Copyright 2021. Colorado State University. All rights reserved.
+// Derived From : none.
+//==================================================================================
+
+#include "gtypes.h"
+#include <cmath>
+#include <iostream>
+#include "gtvector.hpp"
+#include "gcblas.hpp"
+
+
+using namespace std;
+
+int main(int argc, char **argv)
+{
+    GString serr ="main: ";
+    GINT    errcode=0;
+    GINT    M, nbatch=7;
+    GDOUBLE alpha=1.5, beta, diff, norm;
+    GCBLAS::cuMatBlockDat cudat;
+
+    cudat.nbatch = nbatch;
+
+    // Check all kernel sizes, and one past the largest, which
+    // must take the per-element fallback:
+    for ( GINT K=1; K<=GCBLAS_SMALL_MAXK+1; K++ ) {
+      for ( GINT ib=0; ib<2; ib++ ) { // beta == 0 and beta != 0 branches
+        beta = ib == 0 ? 0.0 : -0.5;
+        M    = K*K;                   // e.g., 2d derivative in x_2
+        GTVector<GDOUBLE> A(M*K*nbatch), B(K*K), C(M*K*nbatch), Cref(M*K*nbatch);
+
+        for ( auto j=0; j<A.size(); j++ ) A[j] = sin(0.1*j + K);
+        for ( auto j=0; j<B.size(); j++ ) B[j] = cos(0.3*j - K);
+        for ( auto j=0; j<C.size(); j++ ) C[j] = Cref[j] = 1.0 + 0.01*j;
+
+        GCBLAS::batched_gemm<GDOUBLE>(cudat, GCBLAS::CblasColMajor, GCBLAS::CblasNoTrans,
+                                      GCBLAS::CblasNoTrans,
+                                      M, K, K, alpha, A.data(), M, B.data(), K, beta,
+                                      C.data(), M);
+        for ( auto e=0; e<nbatch; e++ ) {
+          cblas_dgemm(CblasColMajor, CblasNoTrans, CblasNoTrans, M, K, K,
+                      alpha, A.data()+e*M*K, M, B.data(), K, beta,
+                      Cref.data()+e*M*K, M);
+        }
+
+        diff = 0.0; norm = 0.0;
+        for ( auto j=0; j<C.size(); j++ ) {
+          diff = MAX(diff, fabs(C[j]-Cref[j]));
+          norm = MAX(norm, fabs(Cref[j]));
+        }
+        if ( diff > 1.0e-13*MAX(norm,1.0) ) {
+          std::cout << serr << "K=" << K << " beta=" << beta
+                    << ": max error=" << diff << std::endl;
+          errcode = 1;
+        }
+      }
+    }
+
+    if ( errcode != 0 ) {
+      std::cout << "main: -------------------------------------batched_gemm FAILED" << std::endl;
+    } else {
+      std::cout << "main: -------------------------------------batched_gemm OK" << std::endl;
+    }
+
+    return errcode;
+
+} // end, main
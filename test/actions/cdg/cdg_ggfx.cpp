@@ -224,6 +224,37 @@ int main(int argc, char** argv) {
         }
     }
 
+    // Sum of ones must give the multiplicity
+    std::vector<value_type> ones(num_points, 1.0);
+    std::vector<value_type> mult(num_points);
+    ggfx.doOp(ones, GGFX<value_type>::Sum());
+    ggfx.get_mult(mult);
+    for (size_type i = 0; i < num_points; ++i) {
+        if (ones[i] != mult[i]) {
+            return 2;
+        }
+    }
+
+    // Batched reduction of several fields must match single reductions
+    std::vector<value_type> f0(num_points, 1.0);
+    std::vector<value_type> f1(original);
+    std::vector<value_type> f2(num_points);
+    for (size_type i = 0; i < num_points; ++i) {
+        f2[i] = xyz[i][0] * xyz[i][0];
+    }
+    std::vector<value_type> s2(f2);
+    GTVector<std::vector<value_type>*> fields(3);
+    fields[0] = &f0;
+    fields[1] = &f1;
+    fields[2] = &f2;
+    ggfx.doOp(fields, GGFX<value_type>::Sum());
+    ggfx.doOp(s2, GGFX<value_type>::Sum());
+    for (size_type i = 0; i < num_points; ++i) {
+        if (f0[i] != mult[i] || f1[i] != mult[i] * original[i] || f2[i] != s2[i]) {
+            return 3;
+        }
+    }
+
     //	ggfx.display();
     //	std::vector<value_type> imult(num_points);
     //	ggfx.get_imult(imult);
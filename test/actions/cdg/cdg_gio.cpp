@@ -0,0 +1,316 @@
+//==================================================================================
+// Module       : cdg_gio.cpp
+// Date         : 10/17/26
+// Description  : GeoFLOW test of GIO collective state IO. A known
+//                state is written and read back for each combination
+//                of the multivar and async traits, and must be
+//                recovered exactly. A state written on a subset of 
+//                tasks must also be recovered when read on all tasks,
+//                as must a state whose elements are stored in a
+//                different order, which requires remapping by key.
+// Copyright    : Copyright 2021. Colorado State University. All rights reserved
+// Derived From : none.
+//==================================================================================
+
+#include <unistd.h>
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <vector>
+
+#include "gcomm.hpp"
+#include "ggfx.hpp"
+#include "ggrid_box.hpp"
+#include "ggrid_factory.hpp"
+#include "gio.hpp"
+#include "gio_observer.hpp"
+#include "gllbasis.hpp"
+#include "gmass.hpp"
+#include "gtypes.h"
+#include "pdeint/io_base.hpp"
+#include "pdeint/null_observer.hpp"
+#include "pdeint/observer_base.hpp"
+#include "pdeint/observer_factory.hpp"
+#include "tbox/error_handler.hpp"
+#include "tbox/global_manager.hpp"
+#include "tbox/mpixx.hpp"
+#include "tbox/property_tree.hpp"
+
+using namespace geoflow::pdeint;
+using namespace geoflow::tbox;
+using namespace std;
+
+struct TypePack {
+    using State = GTVector<GTVector<GFTYPE> *>;
+    using StateComp = GTVector<GFTYPE>;
+    using StateInfo = GStateInfo;
+    using Grid = GGrid<TypePack>;
+    using GridBox = GGridBox<TypePack>;
+    using GridIcos = GGridIcos<TypePack>;
+    using Mass = GMass<TypePack>;
+    using Ftype = GFTYPE;
+    using Derivative = State;
+    using Time = Ftype;
+    using CompDesc = GTVector<GStateCompType>;
+    using Jacobian = State;
+    using Size = GSIZET;
+    using EqnBase = EquationBase<TypePack>;       // Equation Base type
+    using EqnBasePtr = std::shared_ptr<EqnBase>;  // Equation Base ptr
+    using IBdyVol = GTVector<GSIZET>;
+    using TBdyVol = GTVector<GBdyType>;
+    using Operator = GHelmholtz<TypePack>;
+    using GElemList = GTVector<GElem_base *>;
+    using Preconditioner = GHelmholtz<TypePack>;
+    using ConnectivityOp = GGFX<Ftype>;
+    using FilterBasePtr = std::shared_ptr<FilterBase<TypePack>>;
+    using FilterList = std::vector<FilterBasePtr>;
+};
+using Types = TypePack;                         // Define types used
+using IOBaseType = IOBase<Types>;               // IO Base type
+using IOBasePtr = std::shared_ptr<IOBaseType>;  // IO Base ptr
+using Grid = TypePack::Grid;
+using Ftype = TypePack::Ftype;
+using State = TypePack::State;
+
+Grid *grid_ = NULLPTR;
+GC_COMM comm_ = GC_COMM_WORLD;  // communicator
+
+GINT szMatCache_ = _G_MAT_CACHE_SIZE;
+GINT szVecCache_ = _G_VEC_CACHE_SIZE;
+
+//
+// Reverse the order of elements in collective, multivar file fin,
+// holding nf components of gsize dof each, and write it to fout.
+// Element keys end the header, and all elements have the same
+// no. dof, so nothing else about the format need be known:
+//
+void reverse_elems(const GString &fin, const GString &fout, GINT nf, GSIZET gsize) {
+    std::ifstream is(fin, std::ios::binary);
+    std::vector<char> in((std::istreambuf_iterator<char>(is)), std::istreambuf_iterator<char>());
+    std::vector<char> out(in);
+    GSIZET nelems, nbhead, nbelem, ikeys, idata, ie, je;
+
+    std::memcpy(&nelems, in.data() + 2 * sizeof(GINT), sizeof(GSIZET));
+    nbhead = in.size() - nf * gsize * sizeof(Ftype);
+    nbelem = (gsize / nelems) * sizeof(Ftype);
+    ikeys = nbhead - nelems * sizeof(GKEY);
+    for (GSIZET e = 0; e < nelems; e++) {
+        ie = e;
+        je = nelems - 1 - e;
+        std::memcpy(out.data() + ikeys + je * sizeof(GKEY), in.data() + ikeys + ie * sizeof(GKEY), sizeof(GKEY));
+        for (auto k = 0; k < nf; k++) {
+            idata = nbhead + k * gsize * sizeof(Ftype);
+            std::memcpy(out.data() + idata + je * nbelem, in.data() + idata + ie * nbelem, nbelem);
+        }
+    }
+
+    std::ofstream os(fout, std::ios::binary | std::ios::trunc);
+    os.write(out.data(), out.size());
+}
+
+int main(int argc, char **argv) {
+    GString serr = "main: ";
+    GINT errcode = 0, gerrcode;
+    GSIZET nbad;
+    IOBasePtr pIO;  // ptr to IOBase operator
+    GTVector<GTVector<Ftype>> *xnodes;
+    typename ObserverBase<Types>::Traits binobstraits;
+    typename IOBaseType::Traits iotraits;
+    GStateInfo info;
+
+    if (argc > 1) {
+        cout << "No arguments accepted" << endl;
+        exit(1);
+    }
+
+    // Initialize comm:
+    GComm::InitComm(&argc, &argv);
+    mpixx::environment env(argc, argv);  // init GeoFLOW comm
+    mpixx::communicator world;
+    GlobalManager::initialize(argc, argv);
+    GlobalManager::startup();
+
+    // Get minimal property tree; any box grid will do:
+    PropertyTree ptree;
+    std::vector<GINT> pstd(GDIM);
+
+    ptree.load_file("cg_input.jsn");
+    pstd = ptree.getArray<GINT>("exp_order");
+
+    // Create basis:
+    GTVector<GNBasis<GCTYPE, Ftype> *> gbasis(GDIM);
+    for (GSIZET k = 0; k < GDIM; k++) {
+        gbasis[k] = new GLLBasis<GCTYPE, Ftype>(pstd[k]);
+    }
+
+    EH_MESSAGE("main: Create grid...");
+
+    ObserverFactory<Types>::get_traits(ptree, "gio_observer", binobstraits);
+    grid_ = GGridFactory<Types>::build(ptree, gbasis, pIO, binobstraits, comm_);
+    xnodes = &(grid_->xNodes());
+
+    // Set known state, and space to read it into:
+    const GINT nstate = 3;
+    State u(nstate), v(nstate);
+    GTVector<GTVector<Ftype>> uref(nstate);
+    for (auto k = 0; k < nstate; k++) {
+        u[k] = new GTVector<Ftype>(grid_->ndof());
+        v[k] = new GTVector<Ftype>(grid_->ndof());
+        uref[k].resize(grid_->ndof());
+        for (auto j = 0; j < grid_->ndof(); j++) {
+            uref[k][j] = (*xnodes)[0][j] + (k + 1) * (*xnodes)[1][j] * (*xnodes)[1][j];
+            (*u[k])[j] = uref[k][j];
+        }
+    }
+
+    info.sttype = 0;
+    info.svars = {"gio_u0", "gio_u1", "gio_u2"};
+    info.icomptype.resize(nstate);
+    info.icomptype = GSC_KINETIC;
+    info.idir = ".";
+    info.odir = ".";
+
+    // Write, then read back, for each multivar, async combination:
+    iotraits.io_type = IOBaseType::GIO_COLL;
+    iotraits.hints.push_back({"collective_buffering", "true"});
+    for (auto m = 0; m < 4 && errcode == 0; m++) {
+        iotraits.multivar = (m & 1) != 0;
+        iotraits.async = (m & 2) != 0;
+
+        EH_MESSAGE("main: multivar=" << iotraits.multivar << " async=" << iotraits.async);
+
+        GIO<Types> gio(*grid_, iotraits, comm_);
+
+        // Write twice to same file, so that an async write must
+        // wait for the first to complete:
+        info.index = m;
+        info.time = static_cast<Ftype>(m);
+        gio.write_state("gio_state", info, u);
+        gio.write_state("gio_state", info, u);
+
+        // Input state may be modified once write_state returns:
+        for (auto k = 0; k < nstate; k++) *u[k] = -1.0;
+
+        for (auto k = 0; k < nstate; k++) *v[k] = 0.0;
+        gio.read_state("gio_state", info, v);
+
+        nbad = 0;
+        for (auto k = 0; k < nstate; k++) {
+            for (auto j = 0; j < grid_->ndof(); j++) {
+                nbad += (*v[k])[j] != uref[k][j];
+            }
+            *u[k] = uref[k];
+        }
+        if (nbad > 0 || info.time != static_cast<Ftype>(m)) {
+            cout << serr << " multivar=" << iotraits.multivar
+                 << " async=" << iotraits.async << ": nbad=" << nbad << endl;
+            errcode = 1;
+        }
+    }
+
+    // Write on a subset of tasks, and read back on all tasks:
+    GINT myrank = GComm::WorldRank(comm_);
+    GINT nsub = MAX(1, GComm::WorldSize(comm_) / 2);
+    MPI_Comm subcomm;
+    MPI_Comm_split(comm_, myrank < nsub ? 0 : MPI_UNDEFINED, myrank, &subcomm);
+    for (auto m = 0; m < 2 && errcode == 0; m++) {
+        iotraits.multivar = m != 0;
+        iotraits.async = FALSE;
+
+        EH_MESSAGE("main: N->M restart: multivar=" << iotraits.multivar);
+
+        info.index = 10 + m;
+        info.time = static_cast<Ftype>(info.index);
+        if (subcomm != MPI_COMM_NULL) {
+            GGridBox<Types> sgrid(ptree, gbasis, subcomm);
+            sgrid.grid_init();
+
+            GTVector<GTVector<Ftype>> *sx = &sgrid.xNodes();
+            GTVector<GTVector<Ftype>> us(nstate);
+            State pus(nstate);
+            for (auto k = 0; k < nstate; k++) {
+                us[k].resize(sgrid.ndof());
+                for (auto j = 0; j < sgrid.ndof(); j++) {
+                    us[k][j] = (*sx)[0][j] + (k + 1) * (*sx)[1][j] * (*sx)[1][j];
+                }
+                pus[k] = &us[k];
+            }
+            GIO<Types> sgio(sgrid, iotraits, subcomm);
+            sgio.write_state("gio_rstate", info, pus);
+        }
+        GComm::Synch(comm_);
+
+        GIO<Types> gio(*grid_, iotraits, comm_);
+        for (auto k = 0; k < nstate; k++) *v[k] = 0.0;
+        gio.read_state("gio_rstate", info, v);
+
+        nbad = 0;
+        for (auto k = 0; k < nstate; k++) {
+            for (auto j = 0; j < grid_->ndof(); j++) {
+                nbad += (*v[k])[j] != uref[k][j];
+            }
+        }
+        if (nbad > 0 || info.time != static_cast<Ftype>(10 + m)) {
+            cout << serr << " N->M restart: multivar=" << iotraits.multivar
+                 << ": nbad=" << nbad << endl;
+            errcode = 2;
+        }
+    }
+    if (subcomm != MPI_COMM_NULL) MPI_Comm_free(&subcomm);
+
+    // Read a state whose elements are stored in reverse order, as
+    // if written with a different partition; the read must remap
+    // elements by key:
+    if (errcode == 0) {
+        EH_MESSAGE("main: permuted element order");
+
+        GSIZET ndof = grid_->ndof(), gsize;
+        GComm::Allreduce(&ndof, &gsize, 1, T2GCDatatype<GSIZET>(), GC_OP_SUM, comm_);
+        if (myrank == 0) {
+            reverse_elems("./gio_rstate.000011.out", "./gio_pstate.000011.out", nstate, gsize);
+        }
+        GComm::Synch(comm_);
+
+        iotraits.multivar = TRUE;
+        iotraits.async = FALSE;
+        info.index = 11;
+        GIO<Types> gio(*grid_, iotraits, comm_);
+        for (auto k = 0; k < nstate; k++) *v[k] = 0.0;
+        gio.read_state("gio_pstate", info, v);
+
+        nbad = 0;
+        for (auto k = 0; k < nstate; k++) {
+            for (auto j = 0; j < grid_->ndof(); j++) {
+                nbad += (*v[k])[j] != uref[k][j];
+            }
+        }
+        if (nbad > 0 || gio.nremapped() != 1) {
+            cout << serr << " permuted elements: nbad=" << nbad
+                 << " nremapped=" << gio.nremapped() << endl;
+            errcode = 3;
+        }
+    }
+
+    // Accumulate error codes:
+    GComm::Allreduce(&errcode, &gerrcode, 1, T2GCDatatype<GINT>(), GC_OP_MAX, comm_);
+
+    if (gerrcode != 0) {
+        cout << serr << " Error: code=" << errcode << endl;
+    } else {
+        cout << serr << " Success!" << endl;
+    }
+
+    for (auto k = 0; k < nstate; k++) {
+        delete u[k];
+        delete v[k];
+    }
+    for (auto k = 0; k < gbasis.size(); k++) delete gbasis[k];
+
+    GComm::TermComm();
+
+    return (gerrcode);
+
+}  // end, main
@@ -15,6 +15,7 @@
 #include "gtmatrix.hpp"
 #include "gtpoint.hpp"
 #include "gmtk.hpp"
+#include "gtpderiv.hpp"
 #include "gllbasis.hpp"
 
 GINT szMatCache_ = _G_MAT_CACHE_SIZE;
@@ -268,6 +269,170 @@ std::cout << "y3a  = " << u3da << std::endl;
    }
 
 
+    // Check order-specialized kernels against general ones, 
+    // for a batch of ne elements of isotropic order:
+    GSIZET           Nc = np+1, Nc2 = Nc*Nc, Nc3 = Nc*Nc*Nc;
+    GDOUBLE          tol = 1.0e3*std::numeric_limits<GDOUBLE>::epsilon();
+    GTVector<GDOUBLE> ub (Nc3*ne), yb(Nc3*ne), yr(Nc3*ne);
+    GTMatrix<GDOUBLE> Dc (Nc,Nc), DcT(Nc,Nc);
+
+    for ( GSIZET j=0; j<Nc; j++ ) {
+      for ( GSIZET i=0; i<Nc; i++ ) {
+        Dc(i,j) = 2.0*static_cast<GDOUBLE>(i)-static_cast<GDOUBLE>(j)/Nc;
+      }
+    }
+    Dc.transpose(DcT);
+    for ( GSIZET j=0; j<ub.size(); j++ ) ub[j] = sin(0.1*static_cast<GDOUBLE>(j));
+
+    // 2d:
+    for ( GSIZET e=0; e<ne; e++ ) {
+      ub.range(e*Nc2, (e+1)*Nc2-1); yr.range(e*Nc2, (e+1)*Nc2-1);
+      GMTK::I2_X_D1(Dc, ub, Nc, Nc, yr);
+    }
+    ub.range_reset(); yr.range_reset();
+    GTPDeriv::I2_X_D1(Dc, ub, Nc, Nc, ne, yb);
+    yb -= yr;
+    if ( yb.infnorm() > tol*yr.infnorm() ) {
+      std::cout << "main: -------------------------------------spec I2_X_D1 FAILED" << std::endl;
+      errcode = 3;
+    } else {
+      std::cout << "main: -------------------------------------spec I2_X_D1 OK" << std::endl;
+    }
+
+    for ( GSIZET e=0; e<ne; e++ ) {
+      ub.range(e*Nc2, (e+1)*Nc2-1); yr.range(e*Nc2, (e+1)*Nc2-1);
+      GMTK::D2_X_I1(DcT, ub, Nc, Nc, yr);
+    }
+    ub.range_reset(); yr.range_reset();
+    GTPDeriv::D2_X_I1(DcT, ub, Nc, Nc, ne, yb);
+    yb -= yr;
+    if ( yb.infnorm() > tol*yr.infnorm() ) {
+      std::cout << "main: -------------------------------------spec D2_X_I1 FAILED" << std::endl;
+      errcode = 3;
+    } else {
+      std::cout << "main: -------------------------------------spec D2_X_I1 OK" << std::endl;
+    }
+
+    // 3d:
+    for ( GSIZET e=0; e<ne; e++ ) {
+      ub.range(e*Nc3, (e+1)*Nc3-1); yr.range(e*Nc3, (e+1)*Nc3-1);
+      GMTK::I3_X_I2_X_D1(Dc, ub, Nc, Nc, Nc, yr);
+    }
+    ub.range_reset(); yr.range_reset();
+    GTPDeriv::I3_X_I2_X_D1(Dc, ub, Nc, Nc, Nc, ne, yb);
+    yb -= yr;
+    if ( yb.infnorm() > tol*yr.infnorm() ) {
+      std::cout << "main: -------------------------------------spec I3_X_I2_X_D1 FAILED" << std::endl;
+      errcode = 4;
+    } else {
+      std::cout << "main: -------------------------------------spec I3_X_I2_X_D1 OK" << std::endl;
+    }
+
+    for ( GSIZET e=0; e<ne; e++ ) {
+      ub.range(e*Nc3, (e+1)*Nc3-1); yr.range(e*Nc3, (e+1)*Nc3-1);
+      GMTK::I3_X_D2_X_I1(DcT, ub, Nc, Nc, Nc, yr);
+    }
+    ub.range_reset(); yr.range_reset();
+    GTPDeriv::I3_X_D2_X_I1(DcT, ub, Nc, Nc, Nc, ne, yb);
+    yb -= yr;
+    if ( yb.infnorm() > tol*yr.infnorm() ) {
+      std::cout << "main: -------------------------------------spec I3_X_D2_X_I1 FAILED" << std::endl;
+      errcode = 4;
+    } else {
+      std::cout << "main: -------------------------------------spec I3_X_D2_X_I1 OK" << std::endl;
+    }
+
+    for ( GSIZET e=0; e<ne; e++ ) {
+      ub.range(e*Nc3, (e+1)*Nc3-1); yr.range(e*Nc3, (e+1)*Nc3-1);
+      GMTK::D3_X_I2_X_I1(DcT, ub, Nc, Nc, Nc, yr);
+    }
+    ub.range_reset(); yr.range_reset();
+    GTPDeriv::D3_X_I2_X_I1(DcT, ub, Nc, Nc, Nc, ne, yb);
+    yb -= yr;
+    if ( yb.infnorm() > tol*yr.infnorm() ) {
+      std::cout << "main: -------------------------------------spec D3_X_I2_X_I1 FAILED" << std::endl;
+      errcode = 4;
+    } else {
+      std::cout << "main: -------------------------------------spec D3_X_I2_X_I1 OK" << std::endl;
+    }
+
+    // Fused 3d gradient with full metric, against single-direction kernels:
+    GTVector<GTMatrix<GDOUBLE>*> Dg(3);
+    GTVector<GTVector<GDOUBLE>*> Gg(9), dg(3);
+    GTVector<GTVector<GDOUBLE>>  gmet(9), rref(3), dref(3);
+    Dg[0] = &Dc; Dg[1] = &DcT; Dg[2] = &DcT;
+    for ( auto k=0; k<9; k++ ) {
+      gmet[k].resize(Nc3*ne); Gg[k] = &gmet[k];
+      for ( GSIZET j=0; j<Nc3*ne; j++ ) gmet[k][j] = cos(0.3*k+0.01*j);
+    }
+    for ( auto k=0; k<3; k++ ) {
+      rref[k].resize(Nc3*ne); dref[k].resize(Nc3*ne); dg[k] = &dref[k];
+    }
+    GTPDeriv::I3_X_I2_X_D1(Dc , ub, Nc, Nc, Nc, ne, rref[0]);
+    GTPDeriv::I3_X_D2_X_I1(DcT, ub, Nc, Nc, Nc, ne, rref[1]);
+    GTPDeriv::D3_X_I2_X_I1(DcT, ub, Nc, Nc, Nc, ne, rref[2]);
+    GTPDeriv::grad(Dg, ub, Nc, ne, GTPDeriv::GTP_FULLMETRIC, Gg, dg);
+    for ( auto i=0; i<3; i++ ) {
+      yr = 0.0;
+      for ( auto j=0; j<3; j++ ) {
+        for ( GSIZET n=0; n<Nc3*ne; n++ ) yr[n] += gmet[j+3*i][n]*rref[j][n];
+      }
+      yb = dref[i]; yb -= yr;
+      if ( yb.infnorm() > tol*yr.infnorm() ) errcode = 5;
+    }
+    if ( errcode == 5 ) {
+      std::cout << "main: -------------------------------------spec grad FAILED" << std::endl;
+    } else {
+      std::cout << "main: -------------------------------------spec grad OK" << std::endl;
+    }
+
+    // Fused 3d Helmholtz operator, with diagonal metric, variable p, q,
+    // and constant p factor, against single-direction kernels:
+    GTVector<GTMatrix<GDOUBLE>*> Dh(3), DhT(3);
+    GTVector<GTVector<GDOUBLE>*> Gh(3);
+    GTVector<GDOUBLE>            mh(Nc3*ne), ph(Nc3*ne), qh(Nc3*ne), th(Nc3*ne);
+    Dh [0] = &Dc ; Dh [1] = &DcT; Dh [2] = &DcT;
+    DhT[0] = &DcT; DhT[1] = &Dc ; DhT[2] = &Dc ;
+    for ( auto k=0; k<3; k++ ) Gh[k] = &gmet[k];
+    for ( GSIZET j=0; j<Nc3*ne; j++ ) {
+      mh[j] = 1.0 + 0.5*sin(0.7*j);
+      ph[j] = 2.0 + cos(0.2*j);
+      qh[j] = 0.5 + 0.1*sin(0.3*j);
+    }
+    yr = 0.0;
+    for ( auto k=0; k<3; k++ ) {
+      for ( GSIZET n=0; n<Nc3*ne; n++ ) rref[k][n] *= mh[n]*ph[n]*gmet[k][n];
+    }
+    GTPDeriv::I3_X_I2_X_D1(DcT, rref[0], Nc, Nc, Nc, ne, th); yr += th;
+    GTPDeriv::I3_X_D2_X_I1(Dc , rref[1], Nc, Nc, Nc, ne, th); yr += th;
+    GTPDeriv::D3_X_I2_X_I1(Dc , rref[2], Nc, Nc, Nc, ne, th); yr += th;
+    for ( GSIZET n=0; n<Nc3*ne; n++ ) yr[n] = 3.0*yr[n] + qh[n]*mh[n]*ub[n];
+    GTPDeriv::helm(Dh, DhT, ub, Nc, ne, 0, Gh, mh, &ph, 3.0, &qh, 0.0, yb);
+    yb -= yr;
+    if ( yb.infnorm() > tol*yr.infnorm() ) {
+      std::cout << "main: -------------------------------------spec helm FAILED" << std::endl;
+      errcode = 7;
+    } else {
+      std::cout << "main: -------------------------------------spec helm OK" << std::endl;
+    }
+
+    // Unsupported orders must be reported, and output left unset,
+    // so that callers fall back on general kernels:
+    GSIZET           Nu = GTPDERIV_MAXORDER+2;
+    GTVector<GDOUBLE> uu(Nu*Nu*Nu), yu(Nu*Nu*Nu);
+    GTMatrix<GDOUBLE> Du(Nu,Nu);
+    uu = 1.0; yu = 0.0; Du = 1.0;
+    if ( GTPDeriv::supported(Nu) 
+      || GTPDeriv::I3_X_I2_X_D1(Du, uu, Nu, Nu, Nu, 1, yu) 
+      || GTPDeriv::I2_X_D1(Dc, ub, Nc, Nc+1, 1, yb) 
+      || yu.infnorm() != 0.0 ) {
+      std::cout << "main: -------------------------------------spec unsupported FAILED" << std::endl;
+      errcode = 6;
+    } else {
+      std::cout << "main: -------------------------------------spec unsupported OK" << std::endl;
+    }
+
+
 #if 0
    GLLBasis<GCTYPE,GFTYPE> gbasis(N[0]-1);
    GLLBasis<GCTYPE,GFTYPE> gobasis(N[0]+1);
@@ -0,0 +1,202 @@
+//==================================================================================
+// Module       : gtest_rk.cpp
+// Date         : 10/17/26
+// Description  : GeoFLOW test of low-storage (2N-register) forms of
+//                GExRKStepper. The ODE system
+//                    du1/dt = cos(t) u1,   du2/dt = -2t u2,
+//                with solutions u1 = u1(0) exp(sin t), u2 = u2(0) exp(-t^2),
+//                is integrated with each scheme at two timesteps, and
+//                the observed convergence order is checked.
+// Copyright    : Copyright 2026. Colorado State University. All rights reserved
+// Derived From : none.
+//==================================================================================
+
+#include <unistd.h>
+
+#include <cstdio>
+#include <iostream>
+
+#include "gcomm.hpp"
+#include "gexrk_stepper.hpp"
+#include "ggfx.hpp"
+#include "ggrid_box.hpp"
+#include "ggrid_factory.hpp"
+#include "gmass.hpp"
+#include "gtypes.h"
+#include "pdeint/observer_base.hpp"
+
+using namespace geoflow::pdeint;
+using namespace std;
+
+struct TypePack {
+    using State = GTVector<GTVector<GFTYPE> *>;
+    using StateComp = GTVector<GFTYPE>;
+    using StateInfo = GStateInfo;
+    using Grid = GGrid<TypePack>;
+    using GridBox = GGridBox<TypePack>;
+    using GridIcos = GGridIcos<TypePack>;
+    using Mass = GMass<TypePack>;
+    using Ftype = GFTYPE;
+    using Derivative = State;
+    using Time = Ftype;
+    using CompDesc = GTVector<GStateCompType>;
+    using Jacobian = State;
+    using Size = GSIZET;
+    using EqnBase = EquationBase<TypePack>;       // Equation Base type
+    using EqnBasePtr = std::shared_ptr<EqnBase>;  // Equation Base ptr
+    using IBdyVol = GTVector<GSIZET>;
+    using TBdyVol = GTVector<GBdyType>;
+    using Operator = GHelmholtz<TypePack>;
+    using GElemList = GTVector<GElem_base *>;
+    using Preconditioner = GHelmholtz<TypePack>;
+    using ConnectivityOp = GGFX<Ftype>;
+    using FilterBasePtr = std::shared_ptr<FilterBase<TypePack>>;
+    using FilterList = std::vector<FilterBasePtr>;
+};
+using Grid = TypePack::Grid;
+using Ftype = TypePack::Ftype;
+using Time = TypePack::Time;
+using State = TypePack::State;
+using Stepper = GExRKStepper<Grid, Ftype>;
+
+GINT szMatCache_ = _G_MAT_CACHE_SIZE;
+GINT szVecCache_ = _G_VEC_CACHE_SIZE;
+
+void dudt(const Time &t, const State &u, const State &uf,
+          const Time &dt, State &dudt);
+Ftype solve(Stepper::Traits &traits, GINT nsteps, GBOOL binplace);
+
+int main(int argc, char **argv) {
+    GString serr = "main: ";
+    GINT errcode = 0, gerrcode;
+    GINT nstage[3] = {2, 3, 5};
+    GINT norder[3] = {2, 3, 4};
+    Ftype err[2], rate, eip;
+    Stepper::Traits traits;
+
+    // Initialize comm:
+    GComm::InitComm(&argc, &argv);
+
+    GINT myrank = GComm::WorldRank();
+
+    traits.bLowStorage = TRUE;
+    for (auto i = 0; i < 3; i++) {
+        traits.norder = norder[i];
+        traits.nstage = nstage[i];
+
+        // Only two registers per state component are required:
+        if (Stepper::tmp_size(traits, 2) != 4) {
+            cout << serr << " order " << norder[i] << ": tmp_size="
+                 << Stepper::tmp_size(traits, 2) << endl;
+            errcode = 1;
+        }
+
+        err[0] = solve(traits, 20, FALSE);
+        err[1] = solve(traits, 40, FALSE);
+        rate = log(err[0] / err[1]) / log(2.0);
+        if (myrank == 0) {
+            cout << serr << " low-storage RK(" << norder[i] << "," << nstage[i]
+                 << "): err=" << err[0] << " " << err[1] << " rate=" << rate << endl;
+        }
+        if (rate < norder[i] - 0.2 || err[1] > 1.0e-2) {
+            cout << serr << " low-storage RK(" << norder[i] << "," << nstage[i]
+                 << "): convergence FAILED" << endl;
+            errcode = 2;
+        }
+
+        // In-place stepping must give the same solution:
+        eip = solve(traits, 40, TRUE);
+        if (eip != err[1]) {
+            cout << serr << " low-storage RK(" << norder[i] << "," << nstage[i]
+                 << "): in-place err=" << eip << endl;
+            errcode = 3;
+        }
+    }
+
+    GComm::Allreduce(&errcode, &gerrcode, 1, T2GCDatatype<GINT>(), GC_OP_MAX, GC_COMM_WORLD);
+
+    if (gerrcode != 0) {
+        cout << serr << " Error: errcode=" << gerrcode << endl;
+    } else {
+        cout << serr << "     Success!" << endl;
+    }
+
+    GComm::TermComm();
+
+    return (gerrcode);
+
+}  // end, main
+
+//**********************************************************************************
+//**********************************************************************************
+// METHOD: solve
+// DESC  : Integrate test system to t = 2, and find max error
+// ARGS  : traits  : stepper traits
+//         nsteps  : no. timesteps
+//         binplace: if TRUE, use in-place step method
+// RETURNS: max abs. error
+//**********************************************************************************
+Ftype solve(Stepper::Traits &traits, GINT nsteps, GBOOL binplace) {
+    GSIZET n = 8;
+    Ftype t = 0.0, tmax = 2.0, dt = tmax / nsteps, err = 0.0;
+    State u(2), uout(2), uf(2), utmp(Stepper::tmp_size(traits, 2));
+    Stepper gexrk(traits);
+
+    std::function<void(const Time &t,  // RHS callback function
+                       const State &uin,
+                       const State &uf,
+                       const Time &dt,
+                       State &dudt)>
+        rhs = dudt;
+
+    gexrk.setRHSfunction(rhs);
+
+    for (auto j = 0; j < u.size(); j++) {
+        u[j] = new GTVector<Ftype>(n);
+        uout[j] = new GTVector<Ftype>(n);
+        uf[j] = NULLPTR;
+    }
+    for (auto j = 0; j < utmp.size(); j++) utmp[j] = new GTVector<Ftype>(n);
+    for (auto j = 0; j < n; j++) {
+        (*u[0])[j] = 1.0 + j;
+        (*u[1])[j] = 1.0 - 0.1 * j;
+    }
+
+    for (auto k = 0; k < nsteps; k++, t += dt) {
+        if (binplace) {
+            gexrk.step(t, u, uf, dt, utmp);
+        } else {
+            gexrk.step(t, u, uf, dt, utmp, uout);
+            for (auto i = 0; i < u.size(); i++) *u[i] = *uout[i];
+        }
+    }
+
+    for (auto j = 0; j < n; j++) {
+        err = MAX(err, fabs((*u[0])[j] - (1.0 + j) * exp(sin(tmax))));
+        err = MAX(err, fabs((*u[1])[j] - (1.0 - 0.1 * j) * exp(-tmax * tmax)));
+    }
+
+    for (auto j = 0; j < u.size(); j++) {
+        delete u[j];
+        delete uout[j];
+    }
+    for (auto j = 0; j < utmp.size(); j++) delete utmp[j];
+
+    return err;
+
+}  // end, solve
+
+//**********************************************************************************
+//**********************************************************************************
+// METHOD: dudt
+// DESC  : RHS function
+// ARGS  : see GExRKStepper::setRHSfunction
+//**********************************************************************************
+void dudt(const Time &t, const State &u, const State &uf,
+          const Time &dt, State &dudt) {
+    for (auto j = 0; j < u[0]->size(); j++) {
+        (*dudt[0])[j] = cos(t) * (*u[0])[j];
+        (*dudt[1])[j] = -2.0 * t * (*u[1])[j];
+    }
+
+}  // end, dudt
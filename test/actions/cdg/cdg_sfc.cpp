@@ -0,0 +1,364 @@
+//==================================================================================
+// Module       : cdg_sfc.cpp
+// Date         : 10/17/26
+// Description  : GeoFLOW test of space-filling curve domain decomposition
+//                (GSFC_DD). For Morton and Hilbert curves, partitions of
+//                2d and 3d lattices of element centroids must cover each
+//                element exactly once, be balanced, and cut fewer element
+//                faces than the default linear slices; weighted partitions
+//                must balance total cost. Box and icos grids built with
+//                each partitioner must have the correct area, and
+//                continuous fields must be left unchanged by DSS.
+// Copyright    : Copyright 2026. Colorado State University. All rights reserved
+// Derived From : none.
+//==================================================================================
+
+#include <unistd.h>
+
+#include <cstdio>
+#include <iostream>
+
+#include "gcomm.hpp"
+#include "gdd_base.hpp"
+#include "ggfx.hpp"
+#include "ggrid_box.hpp"
+#include "ggrid_factory.hpp"
+#include "gllbasis.hpp"
+#include "gmass.hpp"
+#include "gsfc_dd.hpp"
+#include "gtypes.h"
+#include "pdeint/io_base.hpp"
+#include "pdeint/observer_base.hpp"
+#include "pdeint/observer_factory.hpp"
+#include "tbox/error_handler.hpp"
+#include "tbox/global_manager.hpp"
+#include "tbox/mpixx.hpp"
+#include "tbox/property_tree.hpp"
+
+using namespace geoflow::pdeint;
+using namespace geoflow::tbox;
+using namespace std;
+
+struct TypePack {
+    using State = GTVector<GTVector<GFTYPE> *>;
+    using StateComp = GTVector<GFTYPE>;
+    using StateInfo = GStateInfo;
+    using Grid = GGrid<TypePack>;
+    using GridBox = GGridBox<TypePack>;
+    using GridIcos = GGridIcos<TypePack>;
+    using Mass = GMass<TypePack>;
+    using Ftype = GFTYPE;
+    using Derivative = State;
+    using Time = Ftype;
+    using CompDesc = GTVector<GStateCompType>;
+    using Jacobian = State;
+    using Size = GSIZET;
+    using EqnBase = EquationBase<TypePack>;       // Equation Base type
+    using EqnBasePtr = std::shared_ptr<EqnBase>;  // Equation Base ptr
+    using IBdyVol = GTVector<GSIZET>;
+    using TBdyVol = GTVector<GBdyType>;
+    using Operator = GHelmholtz<TypePack>;
+    using GElemList = GTVector<GElem_base *>;
+    using Preconditioner = GHelmholtz<TypePack>;
+    using ConnectivityOp = GGFX<Ftype>;
+    using FilterBasePtr = std::shared_ptr<FilterBase<TypePack>>;
+    using FilterList = std::vector<FilterBasePtr>;
+};
+using Types = TypePack;                         // Define types used
+using IOBaseType = IOBase<Types>;               // IO Base type
+using IOBasePtr = std::shared_ptr<IOBaseType>;  // IO Base ptr
+using Grid = TypePack::Grid;
+using Ftype = TypePack::Ftype;
+
+GC_COMM comm_ = GC_COMM_WORLD;  // communicator
+
+GINT szMatCache_ = _G_MAT_CACHE_SIZE;
+GINT szVecCache_ = _G_VEC_CACHE_SIZE;
+
+void lattice(const GINT ne[], GINT ndim, GTVector<GTPoint<Ftype>> &x);
+GSIZET face_cut(const GINT ne[], GINT ndim, GTVector<GINT> &iproc);
+GINT check_dd(GSFC_TYPE itype, const GINT ne[], GINT ndim, GINT np);
+GINT check_grid(PropertyTree &ptree, const GString &spart, Ftype area);
+void init_ggfx(Grid &grid, GGFX<Ftype> &ggfx);
+
+int main(int argc, char **argv) {
+    GString serr = "main: ";
+    GINT errcode = 0, gerrcode, ierr;
+    GINT ne2[3] = {16, 16, 1}, ne3[3] = {8, 8, 8};
+    IOBasePtr pIO;
+
+    // Initialize comm:
+    GComm::InitComm(&argc, &argv);
+    mpixx::environment env(argc, argv);  // init GeoFLOW comm
+    mpixx::communicator world;
+    GlobalManager::initialize(argc, argv);
+    GlobalManager::startup();
+
+    // Partitions of lattices, independent of no. tasks:
+    for (auto itype : {GSFC_MORTON, GSFC_HILBERT}) {
+        ierr = check_dd(itype, ne2, 2, 16);
+        if (ierr == 0) ierr = check_dd(itype, ne3, 3, 8);
+        if (ierr != 0) {
+            cout << serr << " curve " << itype << ": check_dd failed: " << ierr << endl;
+            errcode = ierr;
+        }
+    }
+
+    // Weighted partition: elements in left half cost 3x as much:
+    {
+        GTVector<GTPoint<Ftype>> x;
+        GTVector<Ftype> w;
+        GTVector<GINT> iproc;
+        GTVector<Ftype> load(4);
+        GSFC_DD<Ftype> gdd(4, GSFC_HILBERT);
+        Ftype wtot = 0.0, dmax = 0.0;
+
+        lattice(ne2, 2, x);
+        w.resize(x.size());
+        for (auto j = 0; j < x.size(); j++) {
+            w[j] = x[j].x1 < 0.5 ? 3.0 : 1.0;
+            wtot += w[j];
+        }
+        gdd.set_weights(w);
+        gdd.partition(x, iproc);
+        load = 0.0;
+        for (auto j = 0; j < x.size(); j++) load[iproc[j]] += w[j];
+        for (auto r = 0; r < 4; r++) dmax = MAX(dmax, fabs(load[r] - 0.25 * wtot));
+        if (dmax > 3.0) {
+            cout << serr << " weighted: load imbalance=" << dmax << endl;
+            errcode = 4;
+        }
+    }
+
+    // Grids built with each partitioner:
+    PropertyTree ptree;
+    ptree.load_file("cg_input.jsn");
+    ptree.setArray<GINT>("grid_box.num_elems", {8, 8, 1});
+    for (auto spart : {"default", "sfc_morton", "sfc_hilbert"}) {
+        ierr = check_grid(ptree, spart, 1.0);
+        if (ierr != 0) {
+            cout << serr << " box grid, partitioner=" << spart << ": failed: " << ierr << endl;
+            errcode = 5;
+        }
+    }
+#if defined(_G_IS2D)
+    ptree.load_file("mass_input.jsn");
+    for (auto spart : {"sfc_morton", "sfc_hilbert"}) {
+        ierr = check_grid(ptree, spart, 4.0 * PI);
+        if (ierr != 0) {
+            cout << serr << " icos grid, partitioner=" << spart << ": failed: " << ierr << endl;
+            errcode = 6;
+        }
+    }
+#endif
+
+    // Accumulate error codes:
+    GComm::Allreduce(&errcode, &gerrcode, 1, T2GCDatatype<GINT>(), GC_OP_MAX, comm_);
+
+    if (gerrcode != 0) {
+        cout << serr << " Error: code=" << errcode << endl;
+    } else {
+        cout << serr << " Success!" << endl;
+    }
+
+    GComm::TermComm();
+
+    return (gerrcode);
+
+}  // end, main
+
+//**********************************************************************************
+//**********************************************************************************
+// METHOD: lattice
+// DESC  : Centroids of lattice of elements on unit square/cube, in
+//         lexicographic order
+// ARGS  : ne  : no. elements in each direction
+//         ndim: dimension
+//         x   : centroids; resized here
+//**********************************************************************************
+void lattice(const GINT ne[], GINT ndim, GTVector<GTPoint<Ftype>> &x) {
+    GSIZET n = ne[0] * ne[1] * (ndim == 3 ? ne[2] : 1);
+
+    x.resize(n);
+    for (GSIZET l = 0; l < n; l++) {
+        x[l].resize(ndim);
+        x[l].x1 = ((l % ne[0]) + 0.5) / ne[0];
+        x[l].x2 = (((l / ne[0]) % ne[1]) + 0.5) / ne[1];
+        if (ndim == 3) x[l].x3 = ((l / (ne[0] * ne[1])) + 0.5) / ne[2];
+    }
+
+}  // end, lattice
+
+//**********************************************************************************
+//**********************************************************************************
+// METHOD: face_cut
+// DESC  : Count faces between lattice elements owned by different tasks
+// ARGS  : ne   : no. elements in each direction
+//         ndim : dimension
+//         iproc: owning task of each element
+// RETURNS: no. cut faces
+//**********************************************************************************
+GSIZET face_cut(const GINT ne[], GINT ndim, GTVector<GINT> &iproc) {
+    GSIZET ncut = 0, l, nk = ndim == 3 ? ne[2] : 1;
+
+    for (GSIZET k = 0; k < nk; k++) {
+        for (GSIZET j = 0; j < ne[1]; j++) {
+            for (GSIZET i = 0; i < ne[0]; i++) {
+                l = i + ne[0] * (j + ne[1] * k);
+                if (i + 1 < ne[0]) ncut += iproc[l] != iproc[l + 1];
+                if (j + 1 < ne[1]) ncut += iproc[l] != iproc[l + ne[0]];
+                if (k + 1 < nk) ncut += iproc[l] != iproc[l + ne[0] * ne[1]];
+            }
+        }
+    }
+
+    return ncut;
+
+}  // end, face_cut
+
+//**********************************************************************************
+//**********************************************************************************
+// METHOD: check_dd
+// DESC  : Check SFC partition of lattice
+// ARGS  : itype: curve type
+//         ne   : no. elements in each direction
+//         ndim : dimension
+//         np   : no. partitions
+// RETURNS: 0 on success; else error code
+//**********************************************************************************
+GINT check_dd(GSFC_TYPE itype, const GINT ne[], GINT ndim, GINT np) {
+    GTVector<GTPoint<Ftype>> x;
+    GTVector<GINT> iproc, iret, icount;
+    GSFC_DD<Ftype> gdd(np, itype);
+    GDD_base<Ftype> gdef(np);
+    GSIZET ncut, ndef;
+
+    lattice(ne, ndim, x);
+
+    // Each element must belong to exactly one task,
+    // and tasks must have equal no. elements:
+    icount.resize(x.size());
+    icount = 0;
+    for (auto r = 0; r < np; r++) {
+        gdd.doDD(x, r, iret);
+        if (iret.size() != x.size() / np) return 1;
+        for (auto j = 0; j < iret.size(); j++) icount[iret[j]]++;
+    }
+    if (icount.min() != 1 || icount.max() != 1) return 1;
+
+    // Partitions must be more compact than default slices:
+    gdd.partition(x, iproc);
+    ncut = face_cut(ne, ndim, iproc);
+    for (auto r = 0; r < np; r++) {
+        gdef.doDD(x, r, iret);
+        for (auto j = 0; j < iret.size(); j++) iproc[iret[j]] = r;
+    }
+    ndef = face_cut(ne, ndim, iproc);
+    if (GComm::WorldRank(comm_) == 0) {
+        cout << "check_dd: curve=" << itype << " ndim=" << ndim
+             << ": faces cut=" << ncut << "; default=" << ndef << endl;
+    }
+    if (ncut >= ndef) return 2;
+
+    // Single partition must hold everything:
+    GSFC_DD<Ftype> gone(1, itype);
+    if (gone.doDD(x, 0, iret) != x.size()) return 3;
+
+    return 0;
+
+}  // end, check_dd
+
+//**********************************************************************************
+//**********************************************************************************
+// METHOD: check_grid
+// DESC  : Build grid with specified partitioner, and check that
+//         elements are balanced, that the area is correct, and that
+//         DSS leaves a continuous field unchanged
+// ARGS  : ptree: main prop tree
+//         spart: partitioner name
+//         area : analytic area
+// RETURNS: 0 on success; else error code
+//**********************************************************************************
+GINT check_grid(PropertyTree &ptree, const GString &spart, Ftype area) {
+    GString sgrid = ptree.getValue<GString>("grid_type");
+    GINT ierr = 0;
+    std::vector<GINT> pstd(GDIM);
+    GSIZET nel[2], gmin, gmax;
+    Ftype err, gerr, integral;
+    IOBasePtr pIO;
+    typename ObserverBase<Types>::Traits binobstraits;
+
+    ptree.setValue<GString>(sgrid + ".partitioner", spart);
+    pstd = ptree.getArray<GINT>("exp_order");
+
+    GTVector<GNBasis<GCTYPE, Ftype> *> gbasis(GDIM);
+    for (GSIZET k = 0; k < GDIM; k++) {
+        gbasis[k] = new GLLBasis<GCTYPE, Ftype>(pstd[k]);
+    }
+    ObserverFactory<Types>::get_traits(ptree, "gio_observer", binobstraits);
+    Grid *grid = GGridFactory<Types>::build(ptree, gbasis, pIO, binobstraits, comm_);
+
+    // Balance:
+    nel[0] = grid->nelems();
+    GComm::Allreduce(nel, &gmin, 1, T2GCDatatype<GSIZET>(), GC_OP_MIN, comm_);
+    GComm::Allreduce(nel, &gmax, 1, T2GCDatatype<GSIZET>(), GC_OP_MAX, comm_);
+    if ("default" != spart && gmax - gmin > (sgrid == "grid_box" ? 1 : 3)) ierr = 1;
+
+    // Area:
+    GTVector<Ftype> f(grid->ndof()), g(grid->ndof()), h(grid->ndof());
+    f = 1.0;
+    integral = grid->integrate(f, g);
+    if (fabs(integral - area) > 1.0e-10 * area) ierr = 2;
+
+    // DSS of continuous field:
+    GTVector<GTVector<Ftype>> *xnodes = &grid->xNodes();
+    for (auto j = 0; j < grid->ndof(); j++) {
+        f[j] = (*xnodes)[0][j] + 2.0 * (*xnodes)[1][j] * (*xnodes)[1][j];
+    }
+    h = f;
+    GGFX<Ftype> ggfx;
+    init_ggfx(*grid, ggfx);
+    ggfx.doOp(h, GGFX<Ftype>::Smooth());
+    err = 0.0;
+    for (auto j = 0; j < grid->ndof(); j++) err = MAX(err, fabs(h[j] - f[j]));
+    GComm::Allreduce(&err, &gerr, 1, T2GCDatatype<Ftype>(), GC_OP_MAX, comm_);
+    if (gerr > 1.0e-12) ierr = 3;
+
+    if (GComm::WorldRank(comm_) == 0) {
+        cout << "check_grid: " << sgrid << " partitioner=" << spart
+             << ": nelems min/max=" << gmin << "/" << gmax
+             << " area=" << integral << " dss err=" << gerr << endl;
+    }
+
+    delete grid;
+    for (auto k = 0; k < gbasis.size(); k++) delete gbasis[k];
+
+    return ierr;
+
+}  // end, check_grid
+
+//**********************************************************************************
+//**********************************************************************************
+// METHOD: init_ggfx
+// DESC  : Initialize GGFX operator from grid nodes
+// ARGS  : grid: grid
+//         ggfx: GGFX operator, initialized on exit
+//**********************************************************************************
+void init_ggfx(Grid &grid, GGFX<Ftype> &ggfx) {
+    const auto ndof = grid.ndof();
+    const auto nxyz = grid.xNodes().size();
+    ASSERT(nxyz <= GGFX<Ftype>::NDIM);
+    std::vector<std::array<Ftype, GGFX<Ftype>::NDIM>> xyz(ndof);
+    for (std::size_t i = 0; i < ndof; i++) {
+        for (std::size_t d = 0; d < nxyz; d++) {
+            xyz[i][d] = grid.xNodes()[d][i];
+        }
+        for (std::size_t d = nxyz; d < GGFX<Ftype>::NDIM; d++) {
+            xyz[i][d] = 0;
+        }
+    }
+
+    // Max duplicate points: 6 in 2d, 12 in 3d
+    ggfx.init(GDIM == 3 ? 12 : 6, 0.25 * grid.minnodedist(), xyz);
+
+}  // end method init_ggfx